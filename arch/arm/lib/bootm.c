@@ -80,6 +80,8 @@ static void announce_and_cleanup(int fake)
 #ifdef CONFIG_BOOTSTAGE_REPORT
 	bootstage_report();
 #endif
+	/* the OS sets up the UART again, so send any output still waiting */
+	flush();
 
 #ifdef CONFIG_USB_DEVICE
 	udc_disconnect();
@@ -88,4 +88,16 @@ long sandbox_i2c_rtc_get_set_base_time(struct udevice *dev, long base_time);
 
 int sandbox_usb_keyb_add_string(struct udevice *dev, const char *str);
 
+/**
+ * sandbox_serial_set_tx_space() - limit the output the serial port can take
+ *
+ * This acts like a transmit FIFO which does not empty, so that tests can
+ * check what happens when the UART is busy. Each character written through
+ * the puts() method uses up one byte of space.
+ *
+ * @dev:	Sandbox serial device to adjust
+ * @space:	Number of characters which puts() can take, -1 for no limit
+ */
+void sandbox_serial_set_tx_space(struct udevice *dev, int space);
+
 #endif
@@ -5,6 +5,8 @@
  */
 
 #include <common.h>
+#include <errno.h>
+#include <mapmem.h>
 
 static int do_bootstage_report(cmd_tbl_t *cmdtp, int flag, int argc,
 			       char * const argv[])
@@ -58,10 +60,38 @@ static int do_bootstage_stash(cmd_tbl_t *cmdtp, int flag, int argc,
 	return 0;
 }
 
+static int do_bootstage_chrome(cmd_tbl_t *cmdtp, int flag, int argc,
+			       char * const argv[])
+{
+	unsigned int needed;
+	ulong base, size;
+	void *buff;
+	int ret;
+
+	if (argc < 3 || get_base_size(argc, argv, &base, &size))
+		return CMD_RET_USAGE;
+
+	buff = map_sysmem(base, size);
+	ret = bootstage_chrome_trace(buff, size, &needed);
+	unmap_sysmem(buff);
+	if (ret == -ENOSPC) {
+		printf("Error: truncated (%#x bytes needed)\n", needed);
+		return 1;
+	} else if (ret) {
+		printf("Cannot write trace (err=%d)\n", ret);
+		return 1;
+	}
+	printf("Chrome trace written to %08lx, size %#x\n", base, needed);
+	setenv_hex("filesize", needed);
+
+	return 0;
+}
+
 static cmd_tbl_t cmd_bootstage_sub[] = {
 	U_BOOT_CMD_MKENT(report, 2, 1, do_bootstage_report, "", ""),
 	U_BOOT_CMD_MKENT(stash, 4, 0, do_bootstage_stash, "", ""),
 	U_BOOT_CMD_MKENT(unstash, 4, 0, do_bootstage_stash, "", ""),
+	U_BOOT_CMD_MKENT(chrome, 4, 0, do_bootstage_chrome, "", ""),
 };
 
 /*
@@ -91,5 +121,6 @@ U_BOOT_CMD(bootstage, 4, 1, do_boostage,
 	" - check boot progress and timing\n"
 	"report                      - Print a report\n"
 	"stash [<start> [<size>]]    - Stash data into memory\n"
-	"unstash [<start> [<size>]]  - Unstash data from memory"
+	"unstash [<start> [<size>]]  - Unstash data from memory\n"
+	"chrome <start> <size>       - Write Chrome trace JSON to memory"
 );
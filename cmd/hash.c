@@ -17,6 +17,9 @@
 
 static int do_hash(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
 {
+#ifdef CONFIG_PARTITIONS
+	struct hash_algo *algo;
+#endif
 	char *s;
 	int flags = HASH_FLAG_ENV;
 
@@ -34,6 +37,15 @@ static int do_hash(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
 	argv++;
 	for (s = *argv; *s; s++)
 		*s = tolower(*s);
+#ifdef CONFIG_PARTITIONS
+	/* hash [-v] interface dev[:part] algorithm ... */
+	if (argc >= 3 && hash_lookup_algo(argv[0], &algo)) {
+		for (s = argv[2]; *s; s++)
+			*s = tolower(*s);
+		if (!hash_lookup_algo(argv[2], &algo))
+			return hash_blk_command(flags, argc, argv);
+	}
+#endif
 	return hash_command(*argv, flags, cmdtp, flag, argc - 1, argv + 1);
 }
 
@@ -53,4 +65,12 @@ U_BOOT_CMD(
 		"    - verify message digest of memory area to immediate value, \n"
 		"      env var or *address"
 #endif
+#ifdef CONFIG_PARTITIONS
+	"\nhash interface dev[:part] algorithm [[*]hash_dest]\n"
+		"    - compute message digest of a whole device or partition"
+#ifdef CONFIG_HASH_VERIFY
+	"\nhash -v interface dev[:part] algorithm [*]hash\n"
+		"    - verify message digest of a device or partition"
+#endif
+#endif
 );
@@ -78,6 +78,38 @@ static int create_call_list(int argc, char * const argv[])
 	return 0;
 }
 
+static int set_option(int argc, char * const argv[])
+{
+	const char *cmd = argv[1];
+	int ret;
+
+	if (*cmd == 'a') {
+		if (argc < 4)
+			return CMD_RET_USAGE;
+		ret = trace_set_range(simple_strtoul(argv[2], NULL, 16),
+				      simple_strtoul(argv[3], NULL, 16));
+	} else if (*cmd == 'd') {
+		if (argc < 3)
+			return CMD_RET_USAGE;
+		ret = trace_set_depth_limit(simple_strtoul(argv[2], NULL, 10));
+	} else {
+		int mode;
+
+		if (argc < 3)
+			return CMD_RET_USAGE;
+		mode = trace_lookup_mode(argv[2]);
+		if (mode < 0)
+			return CMD_RET_USAGE;
+		ret = trace_set_mode(mode);
+	}
+	if (ret) {
+		printf("Cannot change trace options\n");
+		return CMD_RET_FAILURE;
+	}
+
+	return 0;
+}
+
 int do_trace(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
 {
 	const char *cmd = argc < 2 ? NULL : argv[1];
@@ -102,6 +134,10 @@ int do_trace(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
 	case 's':
 		trace_print_stats();
 		break;
+	case 'a':
+	case 'd':
+	case 'm':
+		return set_option(argc, argv);
 	default:
 		return CMD_RET_USAGE;
 	}
@@ -117,5 +153,10 @@ U_BOOT_CMD(
 	"trace resume                       - resume tracing\n"
 	"trace funclist [<addr> <size>]     - dump function list into buffer\n"
 	"trace calls  [<addr> <size>]       "
-		"- dump function call trace into buffer"
+		"- dump function call trace into buffer\n"
+	"trace mode <calls|ring|funcs>      - record calls, keep the latest\n"
+	"                                     calls, or only count functions\n"
+	"trace depth <n>                    - set call depth limit\n"
+	"trace addr <start> <end>           - only trace functions in this\n"
+	"                                     range of code offsets (0 0: all)"
 );
@@ -43,6 +43,7 @@
 #endif
 #include <mmc.h>
 #include <nand.h>
+#include <of_live.h>
 #include <onenand_uboot.h>
 #include <scsi.h>
 #include <serial.h>
@@ -286,6 +287,13 @@ static int initr_barrier(void)
 static int initr_malloc(void)
 {
 	ulong malloc_start;
+#if CONFIG_IS_ENABLED(SYS_MALLOC_F_POOL)
+	struct malloc_heap_info info;
+
+	malloc_simple_info(&info);
+	debug("Pre-reloc malloc() pool has %#lx bytes in use in %u blocks\n",
+	      info.used, info.used_blocks);
+#endif
 
 #ifdef CONFIG_SYS_MALLOC_F_LEN
 	debug("Pre-reloc malloc() used %#lx bytes (%ld KB)\n", gd->malloc_ptr,
@@ -315,6 +323,24 @@ static int initr_noncached(void)
 }
 #endif
 
+#ifdef CONFIG_OF_LIVE
+static int initr_of_live(void)
+{
+	struct of_live *live;
+	int ret;
+
+	/* The flat tree still works, it is just slower */
+	ret = of_live_build(gd->fdt_blob, &live);
+	if (ret) {
+		debug("Cannot build live tree (err=%d)\n", ret);
+		return 0;
+	}
+	gd->of_live = live;
+
+	return 0;
+}
+#endif
+
 #ifdef CONFIG_DM
 static int initr_dm(void)
 {
@@ -794,7 +820,13 @@ init_fnc_t init_sequence_r[] = {
 	initr_noncached,
 #endif
 	bootstage_relocate,
+#ifdef CONFIG_OF_LIVE
+	initr_of_live,
+#endif
 #ifdef CONFIG_DM
+#ifdef CONFIG_DM_KEEP_PRE_RELOC
+	stdio_init_tables,	/* Kept serial ports register with stdio */
+#endif
 	initr_dm,
 #endif
 	initr_bootstage,
@@ -810,7 +842,9 @@ init_fnc_t init_sequence_r[] = {
 #ifdef CONFIG_CLOCKS
 	set_cpu_clk_info, 			/* Setup clock information */
 #endif
+#ifndef CONFIG_DM_KEEP_PRE_RELOC
 	stdio_init_tables,			/* stdio相关初始化 */
+#endif
 	initr_serial,				/* 函数，初始化串口 */
 	initr_announce,
 	INIT_FUNC_WATCHDOG_RESET
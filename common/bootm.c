@@ -69,6 +69,10 @@ static inline void boot_start_lmb(bootm_headers_t *images) { }
 static int bootm_start(cmd_tbl_t *cmdtp, int flag, int argc,
 		       char * const argv[])
 {
+#ifdef CONFIG_LMB
+	/* Free any regions allocated by an earlier bootm which failed */
+	lmb_uninit(&images.lmb);
+#endif
 	memset((void *)&images, 0, sizeof(images));
 	images.verify = getenv_yesno("verify");
 
@@ -695,9 +699,15 @@ int do_bootm_states(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[],
 	}
 
 	/* Now run the OS! We hope this doesn't return */
-	if (!ret && (states & BOOTM_STATE_OS_GO))
+	if (!ret && (states & BOOTM_STATE_OS_GO)) {
+#ifdef CONFIG_MALLOC_TRACE
+		malloc_trace_report();
+#endif
+		/* the OS takes over the UART, so send what is still waiting */
+		flush();
 		ret = boot_selected_os(argc, argv, BOOTM_STATE_OS_GO,
 				images, boot_fn);
+	}
 
 	/* Deal with any fallout */
 err:
@@ -891,7 +901,8 @@ void memmove_wd(void *to, void *from, size_t len, ulong chunksz)
 	memmove(to, from, len);
 }
 
-static int bootm_host_load_image(const void *fit, int req_image_type)
+static int bootm_host_load_image(const void *fit, int req_image_type,
+				 int verify)
 {
 	const char *fit_uname_config = NULL;
 	ulong data, len;
@@ -904,7 +915,7 @@ static int bootm_host_load_image(const void *fit, int req_image_type)
 	int ret;
 
 	memset(&images, '\0', sizeof(images));
-	images.verify = 1;
+	images.verify = verify;
 	noffset = fit_image_load(&images, (ulong)fit,
 		NULL, &fit_uname_config,
 		IH_ARCH_DEFAULT, req_image_type, -1,
@@ -934,7 +945,7 @@ static int bootm_host_load_image(const void *fit, int req_image_type)
 	return 0;
 }
 
-int bootm_host_load_images(const void *fit, int cfg_noffset)
+int bootm_host_load_images(const void *fit, int cfg_noffset, int verify)
 {
 	static uint8_t image_types[] = {
 		IH_TYPE_KERNEL,
@@ -947,7 +958,7 @@ int bootm_host_load_images(const void *fit, int cfg_noffset)
 	for (i = 0; i < ARRAY_SIZE(image_types); i++) {
 		int ret;
 
-		ret = bootm_host_load_image(fit, image_types[i]);
+		ret = bootm_host_load_image(fit, image_types[i], verify);
 		if (!err && ret && ret != -ENOENT)
 			err = ret;
 	}
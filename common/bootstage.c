@@ -13,8 +13,11 @@
  */
 
 #include <common.h>
+#include <errno.h>
 #include <libfdt.h>
 #include <malloc.h>
+#include <trace.h>
+#include <dm/util.h>
 #include <linux/compiler.h>
 
 DECLARE_GLOBAL_DATA_PTR;
@@ -34,6 +37,10 @@ enum {
 	BOOTSTAGE_VERSION	= 0,
 	BOOTSTAGE_MAGIC		= 0xb00757a3,
 	BOOTSTAGE_DIGITS	= 9,
+
+	/* Chrome trace thread IDs, used to show each kind of record apart */
+	BOOTSTAGE_TID_STAGES	= 1,
+	BOOTSTAGE_TID_DURATIONS,
 };
 
 struct bootstage_hdr {
@@ -150,6 +157,28 @@ uint32_t bootstage_accum(enum bootstage_id id)
 	return duration;
 }
 
+uint32_t bootstage_add_duration(const char *name, uint32_t start_us)
+{
+	uint32_t duration;
+	int id = next_id;
+
+	duration = (uint32_t)timer_get_boot_us() - start_us;
+	bootstage_add_record(BOOTSTAGE_ID_ALLOC, name,
+			     BOOTSTAGEF_ALLOC | BOOTSTAGEF_ACCUM, duration);
+
+	/* Keep the start time so that the activity can be placed on a timeline */
+	if (id < BOOTSTAGE_ID_COUNT)
+		record[id].start_us = start_us;
+
+	return duration;
+}
+
+/* Check whether a record holds a duration rather than a time stamp */
+static bool is_accum_record(struct bootstage_record *rec)
+{
+	return rec->start_us || (rec->flags & BOOTSTAGEF_ACCUM);
+}
+
 /**
  * Get a record name as a printable string
  *
@@ -242,11 +271,16 @@ static int add_bootstages_devicetree(struct fdt_header *blob)
 
 		/* Check if this is a 'mark' or 'accum' record */
 		if (fdt_setprop_cell(blob, node,
-				rec->start_us ? "accum" : "mark",
+				is_accum_record(rec) ? "accum" : "mark",
 				rec->time_us))
 			return -1;
 	}
 
+#if CONFIG_IS_ENABLED(DM_TIMING)
+	if (dm_timing_fdt_report(blob, bootstage))
+		return -1;
+#endif
+
 	return 0;
 }
 
@@ -277,7 +311,7 @@ void bootstage_report(void)
 	qsort(record, ARRAY_SIZE(record), sizeof(*rec), h_compare_record);
 
 	for (id = 0; id < BOOTSTAGE_ID_COUNT; id++, rec++) {
-		if (rec->time_us != 0 && !rec->start_us)
+		if (rec->time_us != 0 && !is_accum_record(rec))
 			prev = print_time_record(rec->id, rec, prev);
 	}
 	if (next_id > BOOTSTAGE_ID_COUNT)
@@ -287,22 +321,155 @@ void bootstage_report(void)
 
 	puts("\nAccumulated time:\n");
 	for (id = 0, rec = record; id < BOOTSTAGE_ID_COUNT; id++, rec++) {
-		if (rec->start_us)
+		if (is_accum_record(rec))
 			prev = print_time_record(id, rec, -1);
 	}
 }
 
+/**
+ * Append formatted text to a memory buffer
+ *
+ * This works like append_data(), in that the buffer pointer is incremented
+ * even if there is no space for the text.
+ *
+ * @param ptrp	Pointer to buffer, updated by this function
+ * @param end	Pointer to end of buffer
+ * @param fmt	printf() format string
+ */
+static void append_printf(char **ptrp, char *end, const char *fmt, ...)
+		__attribute__ ((format (__printf__, 3, 4)));
+
+static void append_printf(char **ptrp, char *end, const char *fmt, ...)
+{
+	char *ptr = *ptrp;
+	va_list args;
+
+	va_start(args, fmt);
+	*ptrp += vsnprintf(ptr, ptr < end ? end - ptr : 0, fmt, args);
+	va_end(args);
+}
+
+/**
+ * Append a Chrome trace 'complete' event to a memory buffer
+ *
+ * Quotes and backslashes in the name are escaped. Other characters which
+ * are not valid in a JSON string are replaced with '?'.
+ *
+ * @param ptrp	Pointer to buffer, updated by this function
+ * @param end	Pointer to end of buffer
+ * @param name	Name of event
+ * @param tid	Thread ID to put the event in
+ * @param ts	Start time of event in microseconds
+ * @param dur	Duration of event in microseconds
+ */
+static void append_chrome_event(char **ptrp, char *end, const char *name,
+				int tid, ulong ts, ulong dur)
+{
+	const char *p;
+
+#ifdef CONFIG_TRACE
+	/* Function trace records only hold this many bits of the time */
+	ts &= FUNCF_TIMESTAMP_MASK;
+#endif
+	append_printf(ptrp, end, ",\n{\"name\":\"");
+	for (p = name; *p; p++) {
+		if (*p == '"' || *p == '\\')
+			append_printf(ptrp, end, "\\%c", *p);
+		else
+			append_printf(ptrp, end, "%c", *p < ' ' ? '?' : *p);
+	}
+	append_printf(ptrp, end, "\",\"cat\":\"bootstage\",\"ph\":\"X\","
+		      "\"ts\":%lu,\"dur\":%lu,\"pid\":1,\"tid\":%d}",
+		      ts, dur, tid);
+}
+
+int bootstage_chrome_trace(void *buff, int buff_size, unsigned int *needed)
+{
+	struct bootstage_record *sorted, *rec;
+	char *ptr = buff, *end = ptr + buff_size;
+	char buf[20];
+	ulong offset, prev;
+	int id;
+
+	/*
+	 * Convert to the time base of timer_get_us(), which is what the
+	 * function trace uses, so that the two line up in the viewer.
+	 */
+	offset = timer_get_us() - timer_get_boot_us();
+
+	/* Sort a copy of the records, since the report sorts them in place */
+	sorted = malloc(sizeof(record));
+	if (!sorted)
+		return -ENOMEM;
+	memcpy(sorted, record, sizeof(record));
+
+	/* The first record stands for reset, as in bootstage_report() */
+	sorted->time_us = 0;
+	qsort(sorted, ARRAY_SIZE(record), sizeof(*rec), h_compare_record);
+
+	append_printf(&ptr, end, "{\"traceEvents\":[\n"
+		      "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+		      "\"args\":{\"name\":\"U-Boot\"}}");
+	for (id = BOOTSTAGE_TID_STAGES; id <= BOOTSTAGE_TID_DURATIONS; id++) {
+		append_printf(&ptr, end, ",\n{\"name\":\"thread_name\","
+			      "\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+			      "\"args\":{\"name\":\"%s\"}}", id,
+			      id == BOOTSTAGE_TID_STAGES ? "boot stages" :
+			      "durations");
+	}
+
+	/*
+	 * Each boot stage runs from the previous mark (or reset) to its own,
+	 * which matches the 'Elapsed' column of the report
+	 */
+	for (id = 0, rec = sorted, prev = 0; id < BOOTSTAGE_ID_COUNT;
+	     id++, rec++) {
+		if (!rec->time_us || is_accum_record(rec))
+			continue;
+		append_chrome_event(&ptr, end,
+				    get_record_name(buf, sizeof(buf), rec),
+				    BOOTSTAGE_TID_STAGES, prev + offset,
+				    rec->time_us - prev);
+		prev = rec->time_us;
+	}
+
+	/*
+	 * Only durations have a known start time. Accumulators cover several
+	 * separate periods so cannot be shown on a timeline.
+	 */
+	for (id = 0, rec = sorted; id < BOOTSTAGE_ID_COUNT; id++, rec++) {
+		if (rec->flags & BOOTSTAGEF_ACCUM) {
+			append_chrome_event(&ptr, end,
+					    get_record_name(buf, sizeof(buf),
+							    rec),
+					    BOOTSTAGE_TID_DURATIONS,
+					    rec->start_us + offset,
+					    rec->time_us);
+		}
+	}
+	append_printf(&ptr, end, "\n],\"displayTimeUnit\":\"ms\"}\n");
+	free(sorted);
+
+	/* Leave room for the terminator added by vsnprintf() */
+	*needed = ptr - (char *)buff;
+	if (ptr >= end)
+		return -ENOSPC;
+
+	return 0;
+}
+
 ulong __timer_get_boot_us(void)
 {
 	static ulong base_time;
 
 	/*
 	 * We can't implement this properly. Return 0 on the first call and
-	 * larger values after that.
+	 * larger values after that. Use the microsecond timer, since many
+	 * stages (e.g. initcalls) take less than a millisecond.
 	 */
 	if (base_time)
-		return get_timer(base_time) * 1000;
-	base_time = get_timer(0);
+		return timer_get_us() - base_time;
+	base_time = timer_get_us();
 	return 0;
 }
 
@@ -84,9 +84,13 @@
 #include <cli.h>
 #include <cli_hush.h>
 #include <command.h>        /* find_cmd */
+#include <u-boot/crc.h>
 #ifndef CONFIG_SYS_PROMPT_HUSH_PS2
 #define CONFIG_SYS_PROMPT_HUSH_PS2	"> "
 #endif
+#ifndef CONFIG_HUSH_PARSE_CACHE_ENTRIES
+#define CONFIG_HUSH_PARSE_CACHE_ENTRIES	16
+#endif
 #endif
 #ifndef __U_BOOT__
 #include <ctype.h>     /* isalpha, isdigit */
@@ -479,7 +483,9 @@ static int parse_string(o_string *dest, struct p_context *ctx, const char *src);
 #endif
 static int parse_stream(o_string *dest, struct p_context *ctx, struct in_str *input0, int end_trigger);
 /*   setup: */
-static int parse_stream_outer(struct in_str *inp, int flag);
+struct hush_script;
+static int parse_stream_outer(struct in_str *inp, int flag,
+			      struct hush_script *script);
 #ifndef __U_BOOT__
 static int parse_string_outer(const char *s, int flag);
 static int parse_file_outer(FILE *f);
@@ -1589,6 +1595,9 @@ static int run_pipe_real(struct pipe *pi)
 #endif
 		return rcode;
 	} else if (pi->num_progs == 1 && pi->progs[0].argv != NULL) {
+		/* don't change the pipe, as a cached script runs it again */
+		int sp = child->sp;
+
 		for (i=0; is_assignment(child->argv[i]); i++) { /* nothing */ }
 		if (i!=0 && child->argv[i]==NULL) {
 			/* assignments, but no command: set the local environment */
@@ -1627,11 +1636,11 @@ static int run_pipe_real(struct pipe *pi)
 			set_local_var(p, 0);
 #endif
 			if (p != child->argv[i]) {
-				child->sp--;
+				sp--;
 				free(p);
 			}
 		}
-		if (child->sp) {
+		if (sp) {
 			char * str = NULL;
 
 			str = make_string(child->argv + i,
@@ -1764,7 +1773,7 @@ static int run_list_real(struct pipe *pi)
 	char *save_name = NULL;
 	char **list = NULL;
 	char **save_list = NULL;
-	struct pipe *rpipe;
+	struct pipe *rpipe, *for_pipe = NULL;
 	int flag_rep = 0;
 #ifndef __U_BOOT__
 	int save_num_progs;
@@ -1803,7 +1812,8 @@ static int run_list_real(struct pipe *pi)
 				/* check Ctrl-C */
 				ctrlc();
 				if ((had_ctrlc())) {
-					return 1;
+					rcode = 1;
+					goto out;
 				}
 #endif
 				flag_restore = 0;
@@ -1832,6 +1842,7 @@ static int run_list_real(struct pipe *pi)
 				list = make_list_in(pi->next->progs->argv,
 					pi->progs->argv[0]);
 				save_list = list;
+				for_pipe = pi;
 				save_name = pi->progs->argv[0];
 				pi->progs->argv[0] = NULL;
 				flag_rep = 1;
@@ -1903,7 +1914,8 @@ static int run_list_real(struct pipe *pi)
 #else
 		if (rcode < -1) {
 			last_return_code = -rcode - 2;
-			return -2;	/* exit */
+			rcode = -2;	/* exit */
+			goto out;
 		}
 		last_return_code=(rcode == 0) ? 0 : 1;
 #endif
@@ -1923,6 +1935,17 @@ static int run_list_real(struct pipe *pi)
 		checkjobs(NULL);
 #endif
 	}
+#ifdef __U_BOOT__
+out:
+	/* put back the "for" variable, as a cached script runs it again */
+	if (list) {
+		while (*list)
+			free(*list++);
+		free(for_pipe->progs->argv[0]);
+		for_pipe->progs->argv[0] = save_name;
+		free(save_list);
+	}
+#endif
 	return rcode;
 }
 
@@ -3180,9 +3203,190 @@ static void update_ifs_map(void)
 	mapset(ifs, 2);            /* also flow through if quoted */
 }
 
+#ifdef CONFIG_HUSH_PARSE_CACHE
+/*
+ * A script which has been parsed, kept as the list of statements which
+ * parse_stream_outer() produced for it. Statements are parsed and run one
+ * at a time the first time a script is seen, as usual. If all of them parse
+ * and none exits, the statements are kept so that running the same text
+ * again only needs run_list_real(). Scripts are found by their text, so a
+ * variable which is changed and then run again is simply a new script.
+ */
+struct hush_script {
+	char *text;		/* copy of the script */
+	u32 hash;		/* crc32 of the text */
+	int flag;		/* flags passed to parse_string_outer() */
+	struct pipe **list;	/* parsed statements */
+	int count;		/* number of statements */
+	int size;		/* number of entries allocated in list */
+	ulong used;		/* tick when last run, for eviction */
+	bool busy;		/* being run now */
+	bool bad;		/* could not be parsed, or did not finish */
+};
+
+static struct hush_script *hush_cache[CONFIG_HUSH_PARSE_CACHE_ENTRIES];
+static ulong hush_cache_tick;
+static bool hush_cache_off;
+
+static void hush_script_free(struct hush_script *script)
+{
+	int i;
+
+	for (i = 0; i < script->count; i++)
+		free_pipe_list(script->list[i], 0);
+	free(script->list);
+	free(script->text);
+	free(script);
+}
+
+/* Run a statement which has just been parsed and keep it in the script */
+static int hush_script_run_new(struct hush_script *script, struct pipe *pi)
+{
+	struct pipe **list;
+	int code;
+
+	code = run_list_real(pi);
+	if (code == -2)
+		script->bad = true;	/* exit, so the rest was not parsed */
+	if (!script->bad && script->count == script->size) {
+		list = realloc(script->list,
+			       (script->size + 8) * sizeof(*list));
+		if (list) {
+			script->list = list;
+			script->size += 8;
+		} else {
+			script->bad = true;
+		}
+	}
+	if (script->bad)
+		free_pipe_list(pi, 0);
+	else
+		script->list[script->count++] = pi;
+
+	return code;
+}
+
+/* Run all the statements of a cached script, as parse_stream_outer() does */
+static int hush_script_run(struct hush_script *script)
+{
+	int code = 1;
+	int i;
+
+	script->busy = true;
+	script->used = ++hush_cache_tick;
+	for (i = 0; i < script->count; i++) {
+		code = run_list_real(script->list[i]);
+		if (code == -2) {	/* exit */
+			code = 0;
+			break;
+		}
+		if (code == -1)
+			flag_repeat = 0;
+	}
+	script->busy = false;
+
+	return (code != 0) ? 1 : 0;
+}
+
+/*
+ * Run a script from the cache if it is there. Otherwise set up *scriptp to
+ * collect the statements as the script is parsed, if possible.
+ *
+ * Returns the result of the script, or -1 if it was not run.
+ */
+static int hush_cache_run(const char *s, int flag, struct hush_script **scriptp)
+{
+	struct hush_script *script;
+	u32 hash;
+	int i;
+
+	*scriptp = NULL;
+	if (hush_cache_off)
+		return -1;
+	hash = crc32(0, (const uchar *)s, strlen(s));
+	for (i = 0; i < CONFIG_HUSH_PARSE_CACHE_ENTRIES; i++) {
+		script = hush_cache[i];
+		if (script && script->hash == hash && script->flag == flag &&
+		    !strcmp(script->text, s)) {
+			/* a script which runs itself is parsed again */
+			if (script->busy)
+				return -1;
+			return hush_script_run(script);
+		}
+	}
+
+	script = calloc(1, sizeof(*script));
+	if (!script)
+		return -1;
+	script->text = strdup(s);
+	if (!script->text) {
+		free(script);
+		return -1;
+	}
+	script->hash = hash;
+	script->flag = flag;
+	*scriptp = script;
+
+	return -1;
+}
+
+/* Add a newly parsed script to the cache, replacing the oldest idle one */
+static void hush_cache_add(struct hush_script *script)
+{
+	struct hush_script *old;
+	int i, slot = -1;
+
+	if (!script)
+		return;
+	if (hush_cache_off || script->bad)
+		goto discard;
+	for (i = 0; i < CONFIG_HUSH_PARSE_CACHE_ENTRIES; i++) {
+		old = hush_cache[i];
+		if (!old) {
+			slot = i;
+			break;
+		}
+		/* the same text may have been added while this one ran */
+		if (old->hash == script->hash && old->flag == script->flag &&
+		    !strcmp(old->text, script->text))
+			goto discard;
+		if (old->busy)
+			continue;
+		if (slot < 0 || old->used < hush_cache[slot]->used)
+			slot = i;
+	}
+	if (slot < 0)
+		goto discard;
+	if (hush_cache[slot])
+		hush_script_free(hush_cache[slot]);
+	script->used = ++hush_cache_tick;
+	hush_cache[slot] = script;
+	return;
+
+discard:
+	hush_script_free(script);
+}
+
+void hush_cache_enable(bool enable)
+{
+	int i;
+
+	hush_cache_off = !enable;
+	if (enable)
+		return;
+	for (i = 0; i < CONFIG_HUSH_PARSE_CACHE_ENTRIES; i++) {
+		if (hush_cache[i] && !hush_cache[i]->busy) {
+			hush_script_free(hush_cache[i]);
+			hush_cache[i] = NULL;
+		}
+	}
+}
+#endif /* CONFIG_HUSH_PARSE_CACHE */
+
 /* most recursion does not come through here, the exeception is
  * from builtin_source() */
-static int parse_stream_outer(struct in_str *inp, int flag)
+static int parse_stream_outer(struct in_str *inp, int flag,
+			      struct hush_script *script)
 {
 
 	struct p_context ctx;
@@ -3214,6 +3418,12 @@ static int parse_stream_outer(struct in_str *inp, int flag)
 #ifndef __U_BOOT__
 			run_list(ctx.list_head);
 #else
+#ifdef CONFIG_HUSH_PARSE_CACHE
+			if (script)
+				code = hush_script_run_new(script,
+							   ctx.list_head);
+			else
+#endif
 			code = run_list(ctx.list_head);				//执行命令
 			if (code == -2) {	/* exit */
 				b_free(&temp);
@@ -3241,6 +3451,10 @@ static int parse_stream_outer(struct in_str *inp, int flag)
 			temp.quote = 0;
 			inp->p = NULL;
 			free_pipe_list(ctx.list_head,0);
+#ifdef CONFIG_HUSH_PARSE_CACHE
+			if (script)
+				script->bad = true;
+#endif
 		}
 		b_free(&temp);
 	/* loop on syntax errors, return on EOF */
@@ -3261,26 +3475,39 @@ int parse_string_outer(const char *s, int flag)
 {
 	struct in_str input;
 #ifdef __U_BOOT__
+	struct hush_script *script = NULL;
 	char *p = NULL;
 	int rcode;
 	if (!s)
 		return 1;
 	if (!*s)
 		return 0;
+#ifdef CONFIG_HUSH_PARSE_CACHE
+	/* only whole scripts, not commands rebuilt after substitution */
+	if (!(flag & FLAG_REPARSING)) {
+		rcode = hush_cache_run(s, flag, &script);
+		if (rcode >= 0)
+			return rcode;
+	}
+#endif
 	if (!(p = strchr(s, '\n')) || *++p) {
 		p = xmalloc(strlen(s) + 2);
 		strcpy(p, s);
 		strcat(p, "\n");
 		setup_string_in_str(&input, p);
-		rcode = parse_stream_outer(&input, flag);
+		rcode = parse_stream_outer(&input, flag, script);
 		free(p);
-		return rcode;
 	} else {
+		setup_string_in_str(&input, s);
+		rcode = parse_stream_outer(&input, flag, script);
+	}
+#ifdef CONFIG_HUSH_PARSE_CACHE
+	hush_cache_add(script);
 #endif
+	return rcode;
+#else
 	setup_string_in_str(&input, s);
-	return parse_stream_outer(&input, flag);
-#ifdef __U_BOOT__
-	}
+	return parse_stream_outer(&input, flag, NULL);
 #endif
 }
 
@@ -3301,7 +3528,7 @@ int parse_file_outer(void)
  * 这个函数就是 hush shell的命令解释器，负责接收命令行输入，
  * 然后解析并执行相应的命令，函数 parse_stream_outer定义在文件 common/cli_hush.c
  */
-	rcode = parse_stream_outer(&input, FLAG_PARSE_SEMICOLON);
+	rcode = parse_stream_outer(&input, FLAG_PARSE_SEMICOLON, NULL);
 	return rcode;
 }
 
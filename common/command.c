@@ -12,8 +12,12 @@
 #include <common.h>
 #include <command.h>
 #include <console.h>
+#include <errno.h>
+#include <malloc.h>
 #include <linux/ctype.h>
 
+DECLARE_GLOBAL_DATA_PTR;
+
 /*
  * Use puts() instead of printf() to avoid printf buffer overflow
  * for long help messages
@@ -115,10 +119,87 @@ cmd_tbl_t *find_cmd_tbl(const char *cmd, cmd_tbl_t *table, int table_len)
 	return NULL;	/* not found or ambiguous command */
 }
 
+/*
+ * Index of the commands in the linker list, sorted by name. The linker
+ * already sorts the list by section name, which is the command name for
+ * nearly all commands, so building this costs little.
+ */
+static cmd_tbl_t **cmd_index;
+static int cmd_index_count;
+
+static int cmd_index_compare(const void *p1, const void *p2)
+{
+	const cmd_tbl_t *cmd1 = *(cmd_tbl_t **)p1;
+	const cmd_tbl_t *cmd2 = *(cmd_tbl_t **)p2;
+	int ret;
+
+	ret = strcmp(cmd1->name, cmd2->name);
+	if (ret)
+		return ret;
+
+	/* keep duplicate names in table order, as find_cmd_tbl() sees them */
+	return cmd1 < cmd2 ? -1 : cmd1 > cmd2;
+}
+
+static int cmd_index_build(void)
+{
+	cmd_tbl_t *start = ll_entry_start(cmd_tbl_t, cmd);
+	const int count = ll_entry_count(cmd_tbl_t, cmd);
+	int i;
+
+	cmd_index = malloc(count * sizeof(*cmd_index));
+	if (!cmd_index)
+		return -ENOMEM;
+	for (i = 0; i < count; i++)
+		cmd_index[i] = start + i;
+	qsort(cmd_index, count, sizeof(*cmd_index), cmd_index_compare);
+	cmd_index_count = count;
+
+	return 0;
+}
+
+/*
+ * Find a command in the index, with the same rules as find_cmd_tbl(). All
+ * names starting with the command are next to each other in the index, with
+ * an exact match first, so a binary search finds both.
+ */
+static cmd_tbl_t *find_cmd_index(const char *cmd)
+{
+	int low = 0, high = cmd_index_count;
+	const char *p;
+	int len;
+
+	len = ((p = strchr(cmd, '.')) == NULL) ? strlen(cmd) : (p - cmd);
+	while (low < high) {
+		int mid = (low + high) / 2;
+
+		if (strncmp(cmd_index[mid]->name, cmd, len) < 0)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	if (low == cmd_index_count ||
+	    strncmp(cmd_index[low]->name, cmd, len))
+		return NULL;			/* not found */
+	if (strlen(cmd_index[low]->name) == len)
+		return cmd_index[low];		/* full match */
+	if (low + 1 < cmd_index_count &&
+	    !strncmp(cmd_index[low + 1]->name, cmd, len))
+		return NULL;			/* ambiguous command */
+
+	return cmd_index[low];			/* abbreviated command */
+}
+
 cmd_tbl_t *find_cmd(const char *cmd)
 {
 	cmd_tbl_t *start = ll_entry_start(cmd_tbl_t, cmd);	//获取命令cmd的头地址
 	const int len = ll_entry_count(cmd_tbl_t, cmd);		//获取长度
+
+	/* the index lives in BSS, which is not usable before relocation */
+	if (cmd && (gd->flags & GD_FLG_RELOC) &&
+	    (cmd_index || !cmd_index_build()))
+		return find_cmd_index(cmd);
+
 	return find_cmd_tbl(cmd, start, len);				//查找命令cmd对应的cmd_tbl_t结构体指针
 }
 
@@ -433,8 +514,6 @@ int cmd_get_data_size(char* arg, int default_size)
 #endif
 
 #if defined(CONFIG_NEEDS_MANUAL_RELOC)
-DECLARE_GLOBAL_DATA_PTR;
-
 void fixup_cmdtable(cmd_tbl_t *cmdtp, int size)
 {
 	int	i;
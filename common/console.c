@@ -227,6 +227,18 @@ static void console_puts(int file, const char *s)
 	}
 }
 
+static void console_flush(int file)
+{
+	int i;
+	struct stdio_dev *dev;
+
+	for (i = 0; i < cd_count[file]; i++) {
+		dev = console_devices[file][i];
+		if (dev->flush != NULL)
+			dev->flush(dev);
+	}
+}
+
 static inline void console_doenv(int file, struct stdio_dev *dev)
 {
 	iomux_doenv(file, dev->name);
@@ -260,6 +272,12 @@ static inline void console_puts(int file, const char *s)
 	stdio_devices[file]->puts(stdio_devices[file], s);
 }
 
+static inline void console_flush(int file)
+{
+	if (stdio_devices[file]->flush)
+		stdio_devices[file]->flush(stdio_devices[file]);
+}
+
 static inline void console_doenv(int file, struct stdio_dev *dev)
 {
 	console_setfile(file, dev);
@@ -337,6 +355,12 @@ void fputs(int file, const char *s)
 		console_puts(file, s);
 }
 
+void fflush(int file)
+{
+	if (file < MAX_FILES)
+		console_flush(file);
+}
+
 int fprintf(int file, const char *fmt, ...)
 {
 	va_list args;
@@ -548,6 +572,22 @@ void puts(const char *s)
 	}
 }
 
+/* wait until output written with putc() and puts() has been sent */
+void flush(void)
+{
+	if (!gd->have_console)
+		return;
+
+	if (gd->flags & GD_FLG_DEVINIT) {
+		fflush(stdout);
+		fflush(stderr);
+	} else {
+#ifdef CONFIG_DM_SERIAL
+		serial_flush();
+#endif
+	}
+}
+
 #ifdef CONFIG_CONSOLE_RECORD
 int console_record_init(void)
 {
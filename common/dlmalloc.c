@@ -2452,6 +2452,13 @@ void fREe(mem) Void_t* mem;
   int       islr;      /* track whether merging with last_remainder */
 
 #ifdef CONFIG_SYS_MALLOC_F_LEN
+#if CONFIG_IS_ENABLED(SYS_MALLOC_F_POOL)
+	/* Memory from before relocation goes back to its pool */
+	if (malloc_simple_owns(mem)) {
+		free_simple(mem);
+		return;
+	}
+#endif
 	/* free() is a no-op - all the memory will be freed on relocation */
 	if (!(gd->flags & GD_FLG_FULL_MALLOC_INIT))
 		return;
@@ -2609,6 +2616,21 @@ Void_t* rEALLOc(oldmem, bytes) Void_t* oldmem; size_t bytes;
   if (oldmem == NULL) return mALLOc(bytes);
 
 #ifdef CONFIG_SYS_MALLOC_F_LEN
+#if CONFIG_IS_ENABLED(SYS_MALLOC_F_POOL)
+	if (malloc_simple_owns(oldmem)) {
+		if (!(gd->flags & GD_FLG_FULL_MALLOC_INIT))
+			return realloc_simple(oldmem, bytes);
+
+		/* Move memory from before relocation to the heap */
+		newmem = mALLOc(bytes);
+		if (newmem) {
+			oldsize = malloc_simple_usable_size(oldmem);
+			MALLOC_COPY(newmem, oldmem, min(bytes, oldsize));
+			free_simple(oldmem);
+		}
+		return newmem;
+	}
+#endif
 	if (!(gd->flags & GD_FLG_FULL_MALLOC_INIT)) {
 		/* This is harder to support and should not be needed */
 		panic("pre-reloc realloc() is not supported");
@@ -2816,6 +2838,11 @@ Void_t* mEMALIGn(alignment, bytes) size_t alignment; size_t bytes;
 
   if ((long)bytes < 0) return NULL;
 
+#ifdef CONFIG_SYS_MALLOC_F_LEN
+	if (!(gd->flags & GD_FLG_FULL_MALLOC_INIT))
+		return memalign_simple(alignment, bytes);
+#endif
+
   /* If need less alignment than we give anyway, just relay to malloc */
 
   if (alignment <= MALLOC_ALIGNMENT) return mALLOc(bytes);
@@ -3135,6 +3162,10 @@ size_t malloc_usable_size(mem) Void_t* mem;
 #endif
 {
   mchunkptr p;
+#if CONFIG_IS_ENABLED(SYS_MALLOC_F_POOL)
+	if (malloc_simple_owns(mem))
+		return malloc_simple_usable_size(mem);
+#endif
   if (mem == NULL)
     return 0;
   else
@@ -3241,6 +3272,86 @@ struct mallinfo mALLINFo()
 }
 #endif	/* DEBUG */
 
+void malloc_heap_info(struct malloc_heap_info *info)
+{
+	INTERNAL_SIZE_T size;
+	ulong misalign;
+	mchunkptr p;
+
+	memset(info, '\0', sizeof(*info));
+	info->size = mem_malloc_end - mem_malloc_start;
+
+	/* The top chunk can grow into the space not yet taken by sbrk() */
+	size = mem_malloc_end - mem_malloc_brk;
+	if (sbrk_base != (char *)(-1)) {
+		p = (mchunkptr)sbrk_base;
+		misalign = (ulong)chunk2mem(p) & MALLOC_ALIGN_MASK;
+		if (misalign)
+			p = chunk_at_offset(p, MALLOC_ALIGNMENT - misalign);
+		for (; p < top; p = next_chunk(p)) {
+			if (inuse(p)) {
+				info->used_blocks++;
+				continue;
+			}
+			info->free += chunksize(p);
+			info->largest_free = max_t(ulong, info->largest_free,
+						   chunksize(p));
+			info->free_blocks++;
+		}
+		size += chunksize(top);
+	}
+	if (size) {
+		info->free += size;
+		info->largest_free = max_t(ulong, info->largest_free, size);
+		info->free_blocks++;
+	}
+	info->used = info->size - info->free;
+}
+
+int malloc_run_in_arena(void *mem, size_t size, int (*func)(void *priv),
+			void *priv)
+{
+	ulong start = mem_malloc_start, end = mem_malloc_end;
+	ulong brk = mem_malloc_brk;
+	struct mallinfo info = current_mallinfo;
+	ulong max_sbrked = max_sbrked_mem, max_total = max_total_mem;
+	char *base = sbrk_base;
+	mbinptr *bins;
+	int i, ret;
+
+	bins = mALLOc(sizeof(av_));
+	if (!bins)
+		return -ENOMEM;
+	memcpy(bins, av_, sizeof(av_));
+
+	/* Empty bins and no top chunk, as set up by the initialiser of av_ */
+	av_[0] = NULL;
+	av_[1] = NULL;
+	for (i = 0; i < NAV; i++) {
+		av_[2 * i + 2] = bin_at(i);
+		av_[2 * i + 3] = bin_at(i);
+	}
+	sbrk_base = (char *)(-1);
+	memset(&current_mallinfo, '\0', sizeof(current_mallinfo));
+	mem_malloc_start = (ulong)mem;
+	mem_malloc_end = mem_malloc_start + size;
+	mem_malloc_brk = mem_malloc_start;
+
+	ret = func(priv);
+
+	memcpy(av_, bins, sizeof(av_));
+	sbrk_base = base;
+	current_mallinfo = info;
+	max_sbrked_mem = max_sbrked;
+	max_total_mem = max_total;
+	mem_malloc_start = start;
+	mem_malloc_end = end;
+	mem_malloc_brk = brk;
+	fREe(bins);
+
+	return ret;
+}
+
 
 
 
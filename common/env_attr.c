@@ -304,3 +304,262 @@ int env_attr_lookup(const char *attr_list, const char *name, char *attributes)
 	return -ENOENT;
 }
 #endif
+
+#ifndef USE_HOSTCC
+struct env_attr_entry {
+	const char *name;
+	const char *attributes;
+	int pos;		/* position in the combined list */
+};
+
+struct env_attr_regex {
+	const char *attributes;
+	int pos;		/* position in the combined list */
+#if defined(CONFIG_REGEX)
+	struct slre slre;
+#endif
+};
+
+#if defined(CONFIG_REGEX)
+/*
+ * Check whether a regex can only match one string, i.e. it has no special
+ * characters other than escaped ones such as "\."
+ */
+static int regex_is_plain(const char *name)
+{
+	for (; *name; name++) {
+		if (*name == '\\') {
+			name++;
+			if (!*name || strchr("0Ssd", *name))
+				return 0;
+		} else if (strchr("|.^$*+?()[", *name)) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/*
+ * Convert a regex accepted by regex_is_plain() into the string it matches
+ */
+static void regex_unescape(char *name)
+{
+	char *out = name;
+
+	for (; *name; name++) {
+		if (*name == '\\') {
+			name++;
+			if (*name == 'n')
+				*name = '\n';
+			else if (*name == 'r')
+				*name = '\r';
+			else if (*name == 't')
+				*name = '\t';
+		}
+		*out++ = *name;
+	}
+	*out = '\0';
+}
+
+/*
+ * Move entries which need a regex match out of the plain list and compile
+ * them. This is done once per index, not once per lookup.
+ */
+static int env_attr_index_compile(struct env_attr_index *index)
+{
+	struct env_attr_entry *entry;
+	struct env_attr_regex *re;
+	int i, count = 0;
+
+	for (i = 0; i < index->plain_count; i++) {
+		if (!regex_is_plain(index->plain[i].name))
+			index->regex_count++;
+	}
+	if (index->regex_count) {
+		index->regex = malloc(index->regex_count *
+				      sizeof(struct env_attr_regex));
+		if (!index->regex)
+			return -ENOMEM;
+	}
+
+	re = index->regex;
+	for (i = 0; i < index->plain_count; i++) {
+		entry = &index->plain[i];
+		if (regex_is_plain(entry->name)) {
+			regex_unescape((char *)entry->name);
+			index->plain[count++] = *entry;
+			continue;
+		}
+
+		char regex[strlen(entry->name) + 3];
+
+		/* Require the whole string to be described by the regex */
+		sprintf(regex, "^%s$", entry->name);
+		if (!slre_compile(&re->slre, regex)) {
+			printf("Error compiling regex: %s\n", re->slre.err_str);
+			index->regex_count--;
+			continue;
+		}
+		re->attributes = entry->attributes;
+		re->pos = entry->pos;
+		re++;
+	}
+	index->plain_count = count;
+
+	return 0;
+}
+#endif
+
+static int env_attr_entry_compare(const void *p1, const void *p2)
+{
+	const struct env_attr_entry *entry1 = p1;
+	const struct env_attr_entry *entry2 = p2;
+	int ret;
+
+	ret = strcmp(entry1->name, entry2->name);
+	if (ret)
+		return ret;
+
+	return entry1->pos - entry2->pos;
+}
+
+void env_attr_index_free(struct env_attr_index *index)
+{
+	free(index->list);
+	free(index->buf);
+	free(index->plain);
+	free(index->regex);
+	memset(index, '\0', sizeof(*index));
+}
+
+int env_attr_index_update(struct env_attr_index *index,
+	const char *static_list, const char *attr_list)
+{
+	struct env_attr_entry *entry;
+	char *ptr, *next, *name, *attributes;
+	int static_len, max_count, count, i;
+
+	/* nothing to do if the dynamic list has not changed */
+	if (index->buf && (attr_list ? index->list &&
+			   !strcmp(attr_list, index->list) : !index->list))
+		return 0;
+
+	env_attr_index_free(index);
+	if (attr_list) {
+		index->list = strdup(attr_list);
+		if (!index->list)
+			goto err;
+	} else {
+		attr_list = "";
+	}
+
+	/* later entries win, so the dynamic list goes after the static one */
+	static_len = strlen(static_list);
+	index->buf = malloc(static_len + 1 + strlen(attr_list) + 1);
+	if (!index->buf)
+		goto err;
+	strcpy(index->buf, static_list);
+	index->buf[static_len] = ENV_ATTR_LIST_DELIM;
+	strcpy(index->buf + static_len + 1, attr_list);
+
+	max_count = 1;
+	for (ptr = index->buf; *ptr; ptr++) {
+		if (*ptr == ENV_ATTR_LIST_DELIM)
+			max_count++;
+	}
+	index->plain = malloc(max_count * sizeof(struct env_attr_entry));
+	if (!index->plain)
+		goto err;
+
+	/* split the lists in place, as env_attr_walk() does with a copy */
+	count = 0;
+	for (ptr = index->buf; ptr; ptr = next) {
+		next = strchr(ptr, ENV_ATTR_LIST_DELIM);
+		if (next)
+			*next++ = '\0';
+		attributes = strchr(ptr, ENV_ATTR_SEP);
+		if (attributes) {
+			*attributes++ = '\0';
+#if defined(CONFIG_REGEX)
+			attributes = strim(attributes);
+#else
+			/* as env_attr_lookup(), stop at the first space */
+			while (*attributes == ' ')
+				attributes++;
+			attributes[strcspn(attributes, " ")] = '\0';
+#endif
+		} else {
+			attributes = "";
+		}
+		name = strim(ptr);
+		if (!*name)
+			continue;
+
+		entry = &index->plain[count];
+		entry->name = name;
+		entry->attributes = attributes;
+		entry->pos = count++;
+	}
+	index->plain_count = count;
+
+#if defined(CONFIG_REGEX)
+	if (env_attr_index_compile(index))
+		goto err;
+#endif
+
+	/* sort by name, keeping only the last entry for each name */
+	qsort(index->plain, index->plain_count, sizeof(struct env_attr_entry),
+	      env_attr_entry_compare);
+	for (i = 0, count = 0; i < index->plain_count; i++) {
+		entry = &index->plain[i];
+		if (count && !strcmp(index->plain[count - 1].name, entry->name))
+			count--;
+		index->plain[count++] = *entry;
+	}
+	index->plain_count = count;
+
+	return 0;
+
+err:
+	env_attr_index_free(index);
+	return -ENOMEM;
+}
+
+const char *env_attr_index_lookup(const struct env_attr_index *index,
+	const char *name)
+{
+	const struct env_attr_entry *found = NULL;
+	int low = 0, high = index->plain_count;
+
+	while (low < high) {
+		int mid = (low + high) / 2;
+		int ret = strcmp(name, index->plain[mid].name);
+
+		if (!ret) {
+			found = &index->plain[mid];
+			break;
+		}
+		if (ret < 0)
+			high = mid;
+		else
+			low = mid + 1;
+	}
+
+#if defined(CONFIG_REGEX)
+	/* a regex which comes later in the list overrides an exact match */
+	int i;
+
+	for (i = index->regex_count - 1; i >= 0; i--) {
+		const struct env_attr_regex *re = &index->regex[i];
+
+		if (found && re->pos < found->pos)
+			break;
+		if (slre_match(&re->slre, name, strlen(name), NULL))
+			return re->attributes;
+	}
+#endif
+
+	return found ? found->attributes : NULL;
+}
+#endif /* !USE_HOSTCC */
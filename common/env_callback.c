@@ -35,8 +35,8 @@ static struct env_clbk_tbl *find_env_callback(const char *name)
 	return NULL;
 }
 
-static int first_call = 1;
-static const char *callback_list;
+/* The static and ".callbacks" lists, compiled for fast lookup */
+static struct env_attr_index callback_index;
 
 /*
  * Look for a possible callback for a newly added variable
@@ -45,27 +45,18 @@ static const char *callback_list;
  */
 void env_callback_init(ENTRY *var_entry)
 {
-	const char *var_name = var_entry->key;
-	char callback_name[256] = "";
+	const char *callback_name;
 	struct env_clbk_tbl *clbkp;
-	int ret = 1;
 
-	if (first_call) {
-		callback_list = getenv(ENV_CALLBACK_VAR);
-		first_call = 0;
-	}
-
-	/* look in the ".callbacks" var for a reference to this variable */
-	if (callback_list != NULL)
-		ret = env_attr_lookup(callback_list, var_name, callback_name);
+	/* rebuild the index only if ".callbacks" has changed */
+	env_attr_index_update(&callback_index, ENV_CALLBACK_LIST_STATIC,
+			      getenv(ENV_CALLBACK_VAR));
 
-	/* only if not found there, look in the static list */
-	if (ret)
-		ret = env_attr_lookup(ENV_CALLBACK_LIST_STATIC, var_name,
-			callback_name);
+	/* ".callbacks" takes precedence over the static list */
+	callback_name = env_attr_index_lookup(&callback_index, var_entry->key);
 
 	/* if an association was found, set the callback pointer */
-	if (!ret && strlen(callback_name)) {
+	if (callback_name && strlen(callback_name)) {
 		clbkp = find_env_callback(callback_name);
 		if (clbkp != NULL)
 #if defined(CONFIG_NEEDS_MANUAL_RELOC)
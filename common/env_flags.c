@@ -277,6 +277,7 @@ static int _env_flags_validate_type(const char *value,
 	return 0;
 }
 
+#ifdef USE_HOSTCC /* Functions only used from tools/env */
 /*
  * Look for flags in a provided list and failing that the static list
  */
@@ -300,7 +301,6 @@ static inline int env_flags_lookup(const char *flags_list, const char *name,
 	return ret;
 }
 
-#ifdef USE_HOSTCC /* Functions only used from tools/env */
 /*
  * Look up any flags directly from the .flags variable and the static list
  * and convert them to the vartype enum.
@@ -410,8 +410,8 @@ static int env_parse_flags_to_bin(const char *flags)
 	return binflags;
 }
 
-static int first_call = 1;
-static const char *flags_list;
+/* The static and ".flags" lists, compiled for fast lookup */
+static struct env_attr_index flags_index;
 
 /*
  * Look for possible flags for a newly added variable
@@ -420,19 +420,17 @@ static const char *flags_list;
  */
 void env_flags_init(ENTRY *var_entry)
 {
-	const char *var_name = var_entry->key;
-	char flags[ENV_FLAGS_ATTR_MAX_LEN + 1] = "";
-	int ret = 1;
+	const char *flags;
+
+	/* rebuild the index only if ".flags" has changed */
+	env_attr_index_update(&flags_index, ENV_FLAGS_LIST_STATIC,
+			      getenv(ENV_FLAGS_VAR));
 
-	if (first_call) {
-		flags_list = getenv(ENV_FLAGS_VAR);
-		first_call = 0;
-	}
 	/* look in the ".flags" and static for a reference to this variable */
-	ret = env_flags_lookup(flags_list, var_name, flags);
+	flags = env_attr_index_lookup(&flags_index, var_entry->key);
 
 	/* if any flags were found, set the binary form to the entry */
-	if (!ret && strlen(flags))
+	if (flags && strlen(flags))
 		var_entry->flags = env_parse_flags_to_bin(flags);
 }
 
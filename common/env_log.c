@@ -0,0 +1,436 @@
+/*
+ * Append-log environment storage, see include/env_log.h
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <env_log.h>
+#include <environment.h>
+#include <errno.h>
+#include <malloc.h>
+#include <memalign.h>
+#include <spi_flash.h>
+
+/* Size of a record with @size bytes of data, including padding */
+static uint env_log_rec_size(uint size)
+{
+	return sizeof(struct env_log_rec) + ALIGN(size, 4);
+}
+
+static ulong env_log_slot_offset(struct env_log *log, int slot)
+{
+	return log->offset + slot * log->slot_size;
+}
+
+static u32 env_log_slot_crc(const struct env_log_slot *hdr)
+{
+	return crc32(0, (const uchar *)hdr, offsetof(struct env_log_slot, crc));
+}
+
+static u32 env_log_rec_crc(u32 seq, const struct env_log_rec *rec,
+			   const void *data)
+{
+	u32 crc;
+
+	crc = crc32(seq, (const uchar *)&rec->size,
+		    sizeof(*rec) - offsetof(struct env_log_rec, size));
+
+	return crc32(crc, data, le32_to_cpu(rec->size));
+}
+
+/* Write a record at the end of the current slot */
+static int env_log_append(struct env_log *log, enum env_log_type type,
+			  const char *data, uint size)
+{
+	uint rec_size = env_log_rec_size(size);
+	struct env_log_rec *rec;
+	int ret;
+
+	if (log->used + rec_size > log->slot_size)
+		return -ENOSPC;
+	rec = calloc(1, rec_size);
+	if (!rec)
+		return -ENOMEM;
+	rec->size = cpu_to_le32(size);
+	rec->type = type;
+	memcpy(rec + 1, data, size);
+	rec->crc = cpu_to_le32(env_log_rec_crc(log->seq, rec, rec + 1));
+
+	ret = log->ops->write(log, env_log_slot_offset(log, log->slot) +
+			      log->used, rec_size, rec);
+	free(rec);
+	if (ret) {
+		/* we don't know what is there now, so start a new slot */
+		log->full = true;
+		return ret;
+	}
+	log->used += rec_size;
+
+	return 0;
+}
+
+/* Start the next slot with the whole environment */
+static int env_log_compact(struct env_log *log, const char *env, uint size)
+{
+	struct env_log_slot hdr;
+	ulong offset;
+	int slot;
+	int ret;
+
+	if (sizeof(hdr) + env_log_rec_size(size) > log->slot_size)
+		return -ENOSPC;
+	slot = log->slot < 0 ? 0 : (log->slot + 1) % log->slots;
+	offset = env_log_slot_offset(log, slot);
+	if (log->ops->erase) {
+		ret = log->ops->erase(log, offset, log->slot_size);
+		if (ret)
+			return ret;
+	}
+
+	/* the old slot remains valid until the full record is written */
+	hdr.magic = cpu_to_le32(ENV_LOG_MAGIC);
+	hdr.seq = cpu_to_le32(log->seq + 1);
+	hdr.crc = cpu_to_le32(env_log_slot_crc(&hdr));
+	ret = log->ops->write(log, offset, sizeof(hdr), &hdr);
+	if (ret)
+		return ret;
+	log->slot = slot;
+	log->seq++;
+	log->used = sizeof(hdr);
+	log->full = false;
+
+	return env_log_append(log, ENV_LOG_FULL, env, size);
+}
+
+/* Compare the names of two "name=value" strings, as strcmp() would */
+static int env_log_namecmp(const char *s1, const char *s2)
+{
+	int c1, c2;
+
+	for (; *s1 == *s2 && *s1 != '=' && *s1; s1++, s2++)
+		;
+	c1 = *s1 == '=' ? 0 : (uchar)*s1;
+	c2 = *s2 == '=' ? 0 : (uchar)*s2;
+
+	return c1 - c2;
+}
+
+/*
+ * Work out the changes between two exported environments, both sorted by
+ * name, in a form which himport_r() can apply. Returns the size of the
+ * changes, including the terminating nul, or 0 if there are none.
+ */
+static uint env_log_delta(const char *old, const char *new, char *out)
+{
+	char *p = out;
+	int cmp;
+
+	while (*old || *new) {
+		if (!*old)
+			cmp = 1;
+		else if (!*new)
+			cmp = -1;
+		else
+			cmp = env_log_namecmp(old, new);
+
+		if (cmp < 0) {
+			/* deleted, so just give the name */
+			while (*old != '=')
+				*p++ = *old++;
+			*p++ = '\0';
+		} else if (cmp > 0 || strcmp(old, new)) {
+			/* added or changed */
+			strcpy(p, new);
+			p += strlen(new) + 1;
+		}
+		if (cmp <= 0)
+			old += strlen(old) + 1;
+		if (cmp >= 0)
+			new += strlen(new) + 1;
+	}
+	if (p == out)
+		return 0;
+	*p++ = '\0';
+
+	return p - out;
+}
+
+int env_log_save(struct env_log *log, struct hsearch_data *htab)
+{
+	char *env = NULL, *delta = NULL;
+	uint delta_size = 0;
+	ssize_t size;
+	int ret;
+
+	size = hexport_r(htab, '\0', 0, &env, 0, 0, NULL);
+	if (size < 0)
+		return -ENOMEM;
+
+	if (log->slot >= 0 && !log->full && log->saved) {
+		delta = malloc(log->saved_size + size);
+		if (!delta) {
+			ret = -ENOMEM;
+			goto err;
+		}
+		delta_size = env_log_delta(log->saved, env, delta);
+		if (!delta_size) {
+			ret = 0;
+			goto err;
+		}
+	}
+
+	ret = -ENOSPC;
+	if (delta_size && delta_size < size)
+		ret = env_log_append(log, ENV_LOG_DELTA, delta, delta_size);
+	if (ret == -ENOSPC)
+		ret = env_log_compact(log, env, size);
+	if (ret)
+		goto err;
+	free(delta);
+	free(log->saved);
+	log->saved = env;
+	log->saved_size = size;
+
+	return 0;
+
+err:
+	free(delta);
+	free(env);
+	return ret;
+}
+
+/*
+ * Import the records in a slot. Returns 0 if OK, -EINVAL if the slot does
+ * not start with a valid full record.
+ */
+static int env_log_replay(struct env_log *log, const char *buf, u32 seq,
+			  struct hsearch_data *htab, int flag)
+{
+	uint pos = sizeof(struct env_log_slot);
+	bool found = false;
+
+	while (pos + sizeof(struct env_log_rec) <= log->slot_size) {
+		const struct env_log_rec *rec = (void *)(buf + pos);
+		const char *data = (const char *)(rec + 1);
+		uint size = le32_to_cpu(rec->size);
+
+		if (size > log->slot_size - pos - sizeof(*rec) ||
+		    env_log_rec_crc(seq, rec, data) != le32_to_cpu(rec->crc))
+			break;
+		if (!found && rec->type != ENV_LOG_FULL)
+			return -EINVAL;
+		if (rec->type == ENV_LOG_FULL) {
+			if (!himport_r(htab, data, size, '\0',
+				       flag & ~H_NOCLEAR, 0, 0, NULL))
+				return -EINVAL;
+			found = true;
+		} else if (rec->type == ENV_LOG_DELTA) {
+			/* write-once variables may have been set since */
+			himport_r(htab, data, size, '\0',
+				  flag | H_NOCLEAR | H_FORCE, 0, 0, NULL);
+		}
+		pos += env_log_rec_size(size);
+	}
+	if (!found)
+		return -EINVAL;
+	log->used = pos;
+
+	/* on flash we can only append if the rest of the slot is erased */
+	log->full = false;
+	if (log->ops->erase) {
+		for (; pos < log->slot_size; pos++) {
+			if (buf[pos] != (char)0xff) {
+				log->full = true;
+				break;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Import an environment which was saved in the old format (env_t) at the
+ * start of the log area before CONFIG_ENV_LOG was enabled. The next save
+ * then goes to slot 1, so the old copy stays intact until that succeeds.
+ */
+static int env_log_load_legacy(struct env_log *log, char *buf,
+			       struct hsearch_data *htab, int flag)
+{
+	env_t *env = (env_t *)buf;
+
+	if (log->slot_size < CONFIG_ENV_SIZE)
+		return -ENOENT;
+	if (log->ops->read(log, log->offset, CONFIG_ENV_SIZE, buf))
+		return -EIO;
+	if (crc32(0, env->data, ENV_SIZE) != env->crc)
+		return -ENOENT;
+	if (!himport_r(htab, (char *)env->data, ENV_SIZE, '\0',
+		       flag & ~H_NOCLEAR, 0, 0, NULL))
+		return -EINVAL;
+	log->slot = 0;
+	log->full = true;
+
+	return 0;
+}
+
+int env_log_load(struct env_log *log, struct hsearch_data *htab, int flag)
+{
+	struct env_log_slot hdr;
+	u32 seq[log->slots];
+	bool valid[log->slots];
+	bool found = false;
+	ssize_t size;
+	char *buf;
+	int ret = -ENOENT;
+	int i, slot;
+
+	log->slot = -1;
+	log->seq = 0;
+	log->full = false;
+	for (i = 0; i < log->slots; i++) {
+		valid[i] = false;
+		if (log->ops->read(log, env_log_slot_offset(log, i),
+				   sizeof(hdr), &hdr))
+			continue;
+		if (le32_to_cpu(hdr.magic) != ENV_LOG_MAGIC ||
+		    le32_to_cpu(hdr.crc) != env_log_slot_crc(&hdr))
+			continue;
+		valid[i] = true;
+		seq[i] = le32_to_cpu(hdr.seq);
+
+		/* never reuse a sequence number, even from a bad slot */
+		if (!found || (s32)(seq[i] - log->seq) > 0)
+			log->seq = seq[i];
+		found = true;
+	}
+
+	buf = malloc_cache_aligned(log->slot_size);
+	if (!buf)
+		return -ENOMEM;
+
+	/* try the slots from newest to oldest */
+	for (;;) {
+		slot = -1;
+		for (i = 0; i < log->slots; i++) {
+			if (valid[i] && (slot < 0 ||
+					 (s32)(seq[i] - seq[slot]) > 0))
+				slot = i;
+		}
+		if (slot < 0)
+			break;
+		valid[slot] = false;
+		if (log->ops->read(log, env_log_slot_offset(log, slot),
+				   log->slot_size, buf))
+			continue;
+		ret = env_log_replay(log, buf, seq[slot], htab, flag);
+		if (!ret) {
+			/*
+			 * Records are checked against their slot's sequence
+			 * number, so if a newer slot was bad we cannot append
+			 * with log->seq here. Start a new slot instead.
+			 */
+			if (seq[slot] != log->seq)
+				log->full = true;
+			log->slot = slot;
+			break;
+		}
+	}
+	if (!found)
+		ret = env_log_load_legacy(log, buf, htab, flag);
+	free(buf);
+	if (log->slot < 0)
+		return ret;
+
+	free(log->saved);
+	log->saved = NULL;
+	size = hexport_r(htab, '\0', 0, &log->saved, 0, 0, NULL);
+	if (size < 0)
+		return -ENOMEM;
+	log->saved_size = size;
+
+	return 0;
+}
+
+void env_log_free(struct env_log *log)
+{
+	free(log->saved);
+	log->saved = NULL;
+}
+
+#ifdef CONFIG_SPI_FLASH
+static int env_log_sf_read(struct env_log *log, ulong offset, size_t size,
+			   void *buf)
+{
+	return spi_flash_read(log->priv, offset, size, buf);
+}
+
+static int env_log_sf_write(struct env_log *log, ulong offset, size_t size,
+			    const void *buf)
+{
+	return spi_flash_write(log->priv, offset, size, buf);
+}
+
+static int env_log_sf_erase(struct env_log *log, ulong offset, size_t size)
+{
+	return spi_flash_erase(log->priv, offset, size);
+}
+
+const struct env_log_ops env_log_sf_ops = {
+	.read	= env_log_sf_read,
+	.write	= env_log_sf_write,
+	.erase	= env_log_sf_erase,
+};
+#endif
+
+/*
+ * Read or write a byte range on a block device. Partial blocks are read
+ * first and written back with the new data.
+ */
+static int env_log_blk_rw(struct env_log *log, ulong offset, size_t size,
+			  void *buf, bool write)
+{
+	block_dev_desc_t *desc = log->priv;
+	ulong start = offset / desc->blksz;
+	ulong end = DIV_ROUND_UP(offset + size, desc->blksz);
+	ulong count = end - start;
+	char *bounce;
+	int ret = 0;
+
+	bounce = malloc_cache_aligned(count * desc->blksz);
+	if (!bounce)
+		return -ENOMEM;
+	if (desc->block_read(desc, start, count, bounce) != count) {
+		ret = -EIO;
+		goto out;
+	}
+	if (write) {
+		memcpy(bounce + offset % desc->blksz, buf, size);
+		if (desc->block_write(desc, start, count, bounce) != count)
+			ret = -EIO;
+	} else {
+		memcpy(buf, bounce + offset % desc->blksz, size);
+	}
+out:
+	free(bounce);
+
+	return ret;
+}
+
+static int env_log_blk_read(struct env_log *log, ulong offset, size_t size,
+			    void *buf)
+{
+	return env_log_blk_rw(log, offset, size, buf, false);
+}
+
+static int env_log_blk_write(struct env_log *log, ulong offset, size_t size,
+			     const void *buf)
+{
+	return env_log_blk_rw(log, offset, size, (void *)buf, true);
+}
+
+const struct env_log_ops env_log_blk_ops = {
+	.read	= env_log_blk_read,
+	.write	= env_log_blk_write,
+};
@@ -10,6 +10,7 @@
 
 #include <command.h>
 #include <environment.h>
+#include <env_log.h>
 #include <linux/stddef.h>
 #include <malloc.h>
 #include <memalign.h>
@@ -123,6 +124,88 @@ static void fini_mmc_for_env(struct mmc *mmc)
 #endif
 }
 
+#ifdef CONFIG_ENV_LOG
+#ifndef CONFIG_ENV_LOG_SLOTS
+#define CONFIG_ENV_LOG_SLOTS	2
+#endif
+
+static struct env_log env_log = {
+	.ops		= &env_log_blk_ops,
+	.slot_size	= CONFIG_ENV_SIZE,
+	.slots		= CONFIG_ENV_LOG_SLOTS,
+	.slot		= -1,
+};
+
+/* Set up the log for the MMC device, returning NULL on success */
+static const char *env_log_init(struct mmc *mmc)
+{
+	const char *errmsg;
+	u32 offset;
+
+	errmsg = init_mmc_for_env(mmc);
+	if (errmsg)
+		return errmsg;
+	if (mmc_get_env_addr(mmc, 0, &offset)) {
+		fini_mmc_for_env(mmc);
+		return "!No environment area";
+	}
+	env_log.priv = &mmc->block_dev;
+	env_log.offset = offset;
+
+	return NULL;
+}
+
+#ifdef CONFIG_CMD_SAVEENV
+int saveenv(void)
+{
+	int dev = mmc_get_env_dev();
+	struct mmc *mmc = find_mmc_device(dev);
+	const char *errmsg;
+	int ret;
+
+	errmsg = env_log_init(mmc);
+	if (errmsg) {
+		printf("%s\n", errmsg);
+		return 1;
+	}
+
+	printf("Writing to MMC(%d)... ", dev);
+	ret = env_log_save(&env_log, &env_htab);
+	fini_mmc_for_env(mmc);
+	if (ret) {
+		printf("failed (err=%d)\n", ret);
+		return 1;
+	}
+	printf("done (slot %d, %u bytes used)\n", env_log.slot, env_log.used);
+
+	return 0;
+}
+#endif /* CONFIG_CMD_SAVEENV */
+
+void env_relocate_spec(void)
+{
+	int dev = mmc_get_env_dev();
+	struct mmc *mmc;
+	const char *errmsg;
+
+#ifdef CONFIG_SPL_BUILD
+	dev = 0;
+#endif
+	mmc = find_mmc_device(dev);
+	errmsg = env_log_init(mmc);
+	if (errmsg) {
+		set_default_env(errmsg);
+		return;
+	}
+
+	if (env_log_load(&env_log, &env_htab, H_ARENA))
+		set_default_env("!bad CRC");
+	else
+		gd->flags |= GD_FLG_ENV_READY;
+	fini_mmc_for_env(mmc);
+}
+#else /* !CONFIG_ENV_LOG */
+
 #ifdef CONFIG_CMD_SAVEENV
 static inline int write_env(struct mmc *mmc, unsigned long size,
 			    unsigned long offset, const void *buffer)
@@ -340,3 +423,4 @@ err:
 #endif
 }
 #endif /* CONFIG_ENV_OFFSET_REDUND */
+#endif /* CONFIG_ENV_LOG */
@@ -11,6 +11,7 @@
  */
 #include <common.h>
 #include <environment.h>
+#include <env_log.h>
 #include <malloc.h>
 #include <spi.h>
 #include <spi_flash.h>
@@ -45,7 +46,66 @@ char *env_name_spec = "SPI Flash";
 
 static struct spi_flash *env_flash;
 
-#if defined(CONFIG_ENV_OFFSET_REDUND)
+#if defined(CONFIG_ENV_LOG)
+#ifndef CONFIG_ENV_LOG_SLOTS
+# define CONFIG_ENV_LOG_SLOTS	2
+#endif
+
+static struct env_log env_log = {
+	.ops		= &env_log_sf_ops,
+	.offset		= CONFIG_ENV_OFFSET,
+	.slot_size	= ALIGN(CONFIG_ENV_SIZE, CONFIG_ENV_SECT_SIZE),
+	.slots		= CONFIG_ENV_LOG_SLOTS,
+	.slot		= -1,
+};
+
+int saveenv(void)
+{
+	int ret;
+
+	env_flash = spi_flash_probe(CONFIG_ENV_SPI_BUS, CONFIG_ENV_SPI_CS,
+			CONFIG_ENV_SPI_MAX_HZ, CONFIG_ENV_SPI_MODE);
+	if (!env_flash) {
+		puts("SPI probe failed\n");
+		return 1;
+	}
+
+	puts("Writing to SPI flash...");
+	env_log.priv = env_flash;
+	ret = env_log_save(&env_log, &env_htab);
+	spi_flash_free(env_flash);
+	env_flash = NULL;
+	if (ret) {
+		printf("failed (err=%d)\n", ret);
+		return 1;
+	}
+	printf("done (slot %d, %u bytes used)\n", env_log.slot, env_log.used);
+
+	return 0;
+}
+
+void env_relocate_spec(void)
+{
+	int ret;
+
+	env_flash = spi_flash_probe(CONFIG_ENV_SPI_BUS, CONFIG_ENV_SPI_CS,
+			CONFIG_ENV_SPI_MAX_HZ, CONFIG_ENV_SPI_MODE);
+	if (!env_flash) {
+		set_default_env("!spi_flash_probe() failed");
+		return;
+	}
+
+	env_log.priv = env_flash;
+	ret = env_log_load(&env_log, &env_htab, H_ARENA);
+	if (ret)
+		set_default_env("!bad CRC");
+	else
+		gd->flags |= GD_FLG_ENV_READY;
+
+	spi_flash_free(env_flash);
+	env_flash = NULL;
+}
+#elif defined(CONFIG_ENV_OFFSET_REDUND)
 int saveenv(void)
 {
 	env_t	env_new;
@@ -13,8 +13,10 @@
 #ifndef USE_HOSTCC
 #include <common.h>
 #include <command.h>
+#include <console.h>
 #include <malloc.h>
 #include <mapmem.h>
+#include <part.h>
 #include <hw_sha.h>
 #include <asm/io.h>
 #include <asm/errno.h>
@@ -107,7 +109,8 @@ static int hash_finish_crc32(struct hash_algo *algo, void *ctx, void *dest_buf,
 	if (size < algo->digest_size)
 		return -1;
 
-	*((uint32_t *)dest_buf) = *((uint32_t *)ctx);
+	/* Big-endian, to match the digest produced by crc32_wd_buf() */
+	*((uint32_t *)dest_buf) = cpu_to_be32(*((uint32_t *)ctx));
 	free(ctx);
 	return 0;
 }
@@ -473,5 +476,197 @@ int hash_command(const char *algo_name, int flags, cmd_tbl_t *cmdtp, int flag,
 
 	return 0;
 }
+
+#if defined(CONFIG_CMD_HASH) && defined(CONFIG_PARTITIONS)
+/* Bytes read from the device for each update of the hash */
+#define HASH_BLK_CHUNK		(1 << 20)
+
+/* Minimum time between two progress updates, in milliseconds */
+#define HASH_BLK_PROGRESS_MS	1000
+
+/**
+ * hash_blk_lookup_algo() - Find an algorithm which can hash a block device
+ *
+ * hash_blk_dev() reuses one bounce buffer for every chunk, so the algorithm
+ * must consume the data in hash_update(). The progressive hardware engine
+ * (CONFIG_SHA_PROG_HW_ACCEL) only records the buffer addresses until
+ * hash_finish(), so its entries are skipped in favour of the software ones.
+ *
+ * @algo_name:	Hash algorithm to look up
+ * @algop:	Returns the algorithm found
+ * @return 0 if ok, -EPROTONOSUPPORT if no suitable algorithm was found
+ */
+static int hash_blk_lookup_algo(const char *algo_name,
+				struct hash_algo **algop)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(hash_algo); i++) {
+		if (strcmp(algo_name, hash_algo[i].name) ||
+		    !hash_algo[i].hash_init)
+			continue;
+#ifdef CONFIG_SHA_PROG_HW_ACCEL
+		if (hash_algo[i].hash_init == hw_sha_init)
+			continue;
+#endif
+		*algop = &hash_algo[i];
+		return 0;
+	}
+
+	return -EPROTONOSUPPORT;
+}
+
+/**
+ * hash_blk_dev() - Hash a range of blocks without loading it all into RAM
+ *
+ * The blocks are read into a bounce buffer of HASH_BLK_CHUNK bytes and fed
+ * to the progressive hash interface of @algo, so any size of partition can
+ * be hashed. Progress is printed at most once every HASH_BLK_PROGRESS_MS,
+ * and only for ranges which take that long to process.
+ *
+ * @algo:	Hash algorithm to use, from hash_blk_lookup_algo()
+ * @desc:	Block device to read from
+ * @start:	First block to hash
+ * @count:	Number of blocks to hash
+ * @output:	Returns the digest (algo->digest_size bytes)
+ * @return 0 if ok, -EINTR if interrupted by Ctrl-C, -ENOMEM if the buffer
+ * could not be allocated, -EIO on a read error, other -ve on hash error
+ */
+static int hash_blk_dev(struct hash_algo *algo, block_dev_desc_t *desc,
+			lbaint_t start, lbaint_t count, uint8_t *output)
+{
+	lbaint_t chunk_blks, done, todo;
+	ulong progress_time;
+	int progress = 0;
+	void *ctx, *buf;
+	int ret;
+
+	chunk_blks = HASH_BLK_CHUNK / desc->blksz;
+	if (!chunk_blks)
+		chunk_blks = 1;
+	buf = memalign(ARCH_DMA_MINALIGN, chunk_blks * desc->blksz);
+	if (!buf)
+		return -ENOMEM;
+
+	ret = algo->hash_init(algo, &ctx);
+	if (ret) {
+		free(buf);
+		return ret;
+	}
+
+	progress_time = get_timer(0);
+	for (done = 0; done < count; done += todo) {
+		todo = min(count - done, chunk_blks);
+		if (desc->block_read(desc, start + done, todo, buf) != todo) {
+			printf("\nRead error at block " LBAF "\n", start + done);
+			ret = -EIO;
+			break;
+		}
+
+		/* The context is freed by hash_update() on failure */
+		ret = algo->hash_update(algo, ctx, buf, todo * desc->blksz,
+					done + todo == count);
+		if (ret)
+			goto err_ctx;
+
+		if (ctrlc()) {
+			puts("\nAbort\n");
+			ret = -EINTR;
+			break;
+		}
+		if (get_timer(progress_time) >= HASH_BLK_PROGRESS_MS) {
+			printf("\r%s: " LBAFU " / " LBAFU " blocks (%llu%%)",
+			       algo->name, done + todo, count,
+			       (unsigned long long)(done + todo) * 100 / count);
+			progress_time = get_timer(0);
+			progress = 1;
+		}
+	}
+	if (progress)
+		puts("\n");
+
+	if (!ret) {
+		ret = algo->hash_finish(algo, ctx, output, algo->digest_size);
+	} else {
+		/* Throw away the partial digest, which also frees the context */
+		uint8_t dummy[HASH_MAX_DIGEST_SIZE];
+
+		algo->hash_finish(algo, ctx, dummy, sizeof(dummy));
+	}
+err_ctx:
+	free(buf);
+
+	return ret;
+}
+
+int hash_blk_command(int flags, int argc, char * const argv[])
+{
+	uint8_t output[HASH_MAX_DIGEST_SIZE];
+	const char *ifname, *dev_part_str;
+	block_dev_desc_t *desc;
+	struct hash_algo *algo;
+	disk_partition_t info;
+	int i, ret;
+
+	if ((argc < 3) || ((flags & HASH_FLAG_VERIFY) && (argc < 4)))
+		return CMD_RET_USAGE;
+
+	ifname = *argv++;
+	dev_part_str = *argv++;
+	if (hash_blk_lookup_algo(*argv, &algo)) {
+		printf("Hash algorithm '%s' cannot hash a block device\n",
+		       *argv);
+		return CMD_RET_USAGE;
+	}
+	argv++;
+	argc -= 3;
+
+	if (get_device_and_partition(ifname, dev_part_str, &desc, &info, 1) < 0)
+		return CMD_RET_FAILURE;
+	if (!info.size) {
+		printf("%s %s is empty\n", ifname, dev_part_str);
+		return CMD_RET_FAILURE;
+	}
+
+	ret = hash_blk_dev(algo, desc, info.start, info.size, output);
+	if (ret) {
+		printf("Hashing %s %s failed (err=%d)\n", ifname, dev_part_str,
+		       ret);
+		return CMD_RET_FAILURE;
+	}
+
+	printf("%s for %s %s (blocks " LBAF " ... " LBAF ") ==> ", algo->name,
+	       ifname, dev_part_str, info.start, info.start + info.size - 1);
+	for (i = 0; i < algo->digest_size; i++)
+		printf("%02x", output[i]);
+
+#ifdef CONFIG_HASH_VERIFY
+	if (flags & HASH_FLAG_VERIFY) {
+		uint8_t vsum[HASH_MAX_DIGEST_SIZE];
+
+		if (parse_verify_sum(algo, *argv, vsum,
+				     flags & HASH_FLAG_ENV)) {
+			printf("\nERROR: %s does not contain a valid %s sum\n",
+			       *argv, algo->name);
+			return CMD_RET_FAILURE;
+		}
+		if (memcmp(output, vsum, algo->digest_size) != 0) {
+			printf(" != ");
+			for (i = 0; i < algo->digest_size; i++)
+				printf("%02x", vsum[i]);
+			puts(" ** ERROR **\n");
+			return CMD_RET_FAILURE;
+		}
+		puts("\n");
+		return CMD_RET_SUCCESS;
+	}
+#endif
+	puts("\n");
+	if (argc)
+		store_result(algo, output, *argv, flags & HASH_FLAG_ENV);
+
+	return CMD_RET_SUCCESS;
+}
+#endif
 #endif
 #endif
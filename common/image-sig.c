@@ -13,6 +13,7 @@
 DECLARE_GLOBAL_DATA_PTR;
 #endif /* !USE_HOSTCC*/
 #include <image.h>
+#include <u-boot/ecdsa.h>
 #include <u-boot/rsa.h>
 #include <u-boot/rsa-checksum.h>
 
@@ -85,6 +86,13 @@ struct image_sig_algo image_sig_algos[] = {
 		rsa_add_verify_data,
 		rsa_verify,
 		&checksum_algos[2],
+	},
+	{
+		"sha256,ecdsa256",
+		ecdsa_sign,
+		ecdsa_add_verify_data,
+		ecdsa_verify,
+		&checksum_algos[1],
 	}
 
 };
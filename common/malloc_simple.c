@@ -13,6 +13,301 @@
 
 DECLARE_GLOBAL_DATA_PTR;
 
+#if CONFIG_IS_ENABLED(SYS_MALLOC_F_POOL)
+/*
+ * With CONFIG_SYS_MALLOC_F_POOL, blocks are carved from the arena as before
+ * but each starts with its size, so that free() can put it on the free list
+ * for its size class and a later allocation of that class can use it again.
+ * Sizes are not rounded up to the class, since the arena is small and most
+ * requests are for the same few structures. The lists are kept in a struct
+ * malloc_f_pool at the start of the arena. Blocks are never split or
+ * merged, except that freeing the block at the top of the arena gives its
+ * space back. gd->malloc_ptr is the high-water mark.
+ */
+
+/* Alignment of the memory returned, as for dlmalloc */
+#define POOL_ALIGN	8
+
+/* Largest block size, including the header, for each free list */
+static const u16 pool_class_size[] = {
+	16, 24, 32, 48, 64, 96, 128, 192, 256, 384, 512,
+};
+
+#define POOL_CLASSES	ARRAY_SIZE(pool_class_size)
+
+/**
+ * struct pool_block - A block in the arena
+ *
+ * @size:	Size of the block in bytes, including this header
+ * @next:	Next block in the same free list. This is the first word of the
+ *		memory returned for a block which is allocated.
+ */
+struct pool_block {
+	ulong size;
+	struct pool_block *next;
+};
+
+#define POOL_HDR	offsetof(struct pool_block, next)
+
+/**
+ * struct malloc_f_pool - State of the pool used before relocation
+ *
+ * @top:	Offset in the arena of the space which has not been used
+ * @free:	Free blocks in each size class. The last list holds larger
+ *		blocks.
+ * @used:	Bytes in allocated blocks
+ * @used_blocks: Number of allocated blocks
+ * @free_blocks: Number of blocks in the free lists
+ */
+struct malloc_f_pool {
+	ulong top;
+	struct pool_block *free[POOL_CLASSES + 1];
+	ulong used;
+	uint used_blocks;
+	uint free_blocks;
+};
+
+static struct malloc_f_pool *pool_get(void)
+{
+	struct malloc_f_pool *pool = gd->malloc_f_pool;
+	ulong start;
+
+	if (pool)
+		return pool;
+	if (sizeof(*pool) + POOL_ALIGN > gd->malloc_limit)
+		return NULL;
+
+	/* Put the pool first, then align the memory after each header */
+	pool = map_sysmem(gd->malloc_base, gd->malloc_limit);
+	memset(pool, '\0', sizeof(*pool));
+	start = (ulong)pool + sizeof(*pool) + POOL_HDR;
+	pool->top = ALIGN(start, POOL_ALIGN) - POOL_HDR - (ulong)pool;
+	gd->malloc_f_pool = pool;
+	gd->malloc_ptr = max(gd->malloc_ptr, pool->top);
+
+	return pool;
+}
+
+/* Get the free list to use for a block size */
+static int pool_class(ulong size)
+{
+	int i;
+
+	for (i = 0; i < POOL_CLASSES; i++) {
+		if (size <= pool_class_size[i])
+			return i;
+	}
+
+	return POOL_CLASSES;
+}
+
+/* Get the block size to use for a request, or 0 if it is too large */
+static ulong pool_block_size(size_t bytes)
+{
+	if (bytes > gd->malloc_limit)
+		return 0;
+
+	return ALIGN(max(bytes + POOL_HDR, sizeof(struct pool_block)),
+		     POOL_ALIGN);
+}
+
+static void *pool_use(struct malloc_f_pool *pool, struct pool_block *block)
+{
+	pool->used += block->size;
+	pool->used_blocks++;
+
+	return &block->next;
+}
+
+/* Take a block from the free list for @size, if there is one */
+static struct pool_block *pool_take(struct malloc_f_pool *pool, ulong size)
+{
+	struct pool_block **linkp, *block;
+
+	linkp = &pool->free[pool_class(size)];
+	for (block = *linkp; block; linkp = &block->next, block = *linkp) {
+		if (block->size >= size) {
+			*linkp = block->next;
+			pool->free_blocks--;
+			return block;
+		}
+	}
+
+	return NULL;
+}
+
+static void pool_put(struct malloc_f_pool *pool, struct pool_block *block)
+{
+	struct pool_block **linkp = &pool->free[pool_class(block->size)];
+
+	block->next = *linkp;
+	*linkp = block;
+	pool->free_blocks++;
+}
+
+/* Allocate a block of @size from the top, with its memory aligned */
+static struct pool_block *pool_carve(struct malloc_f_pool *pool, ulong size,
+				     ulong align)
+{
+	struct pool_block *block;
+	ulong start, gap;
+
+	start = ALIGN((ulong)pool + pool->top + POOL_HDR, align) - POOL_HDR;
+	gap = start - ((ulong)pool + pool->top);
+	if (pool->top + gap + size > gd->malloc_limit)
+		return NULL;
+
+	/* Keep any gap left by alignment, if it is large enough to use */
+	if (gap >= sizeof(struct pool_block)) {
+		block = (struct pool_block *)((ulong)pool + pool->top);
+		block->size = gap;
+		pool_put(pool, block);
+	}
+	block = (struct pool_block *)start;
+	block->size = size;
+	pool->top += gap + size;
+	gd->malloc_ptr = max(gd->malloc_ptr, pool->top);
+
+	return block;
+}
+
+void *malloc_simple(size_t bytes)
+{
+	struct malloc_f_pool *pool = pool_get();
+	struct pool_block *block;
+	ulong size;
+
+	size = pool_block_size(bytes);
+	if (!pool || !size)
+		return NULL;
+	block = pool_take(pool, size);
+	if (!block)
+		block = pool_carve(pool, size, POOL_ALIGN);
+	debug("%s: size=%zx, block=%p, top=%lx, limit=%lx\n", __func__, bytes,
+	      block, pool->top, gd->malloc_limit);
+	if (!block)
+		return NULL;
+
+	return pool_use(pool, block);
+}
+
+void *memalign_simple(size_t align, size_t bytes)
+{
+	struct malloc_f_pool *pool;
+	struct pool_block *block;
+	ulong size;
+
+	if (align <= POOL_ALIGN)
+		return malloc_simple(bytes);
+	pool = pool_get();
+	size = pool_block_size(bytes);
+	if (!pool || !size)
+		return NULL;
+	block = pool_carve(pool, size, align);
+	if (!block)
+		return NULL;
+
+	return pool_use(pool, block);
+}
+
+void free_simple(void *ptr)
+{
+	struct malloc_f_pool *pool = gd->malloc_f_pool;
+	struct pool_block *block;
+
+	if (!ptr || !pool)
+		return;
+	block = container_of(ptr, struct pool_block, next);
+	pool->used -= block->size;
+	pool->used_blocks--;
+
+	/* The block at the top goes back to the space not used yet */
+	if ((ulong)block + block->size == (ulong)pool + pool->top)
+		pool->top -= block->size;
+	else
+		pool_put(pool, block);
+}
+
+void *realloc_simple(void *ptr, size_t bytes)
+{
+	struct malloc_f_pool *pool = gd->malloc_f_pool;
+	struct pool_block *block;
+	ulong size, old_size;
+	void *new_ptr;
+
+	if (!ptr)
+		return malloc_simple(bytes);
+	block = container_of(ptr, struct pool_block, next);
+	size = pool_block_size(bytes);
+	if (!size)
+		return NULL;
+	if (size <= block->size)
+		return ptr;
+
+	/* Grow the block at the top in place, if there is room */
+	old_size = block->size;
+	if ((ulong)block + old_size == (ulong)pool + pool->top &&
+	    pool->top - old_size + size <= gd->malloc_limit) {
+		block->size = size;
+		pool->top += size - old_size;
+		pool->used += size - old_size;
+		gd->malloc_ptr = max(gd->malloc_ptr, pool->top);
+		return ptr;
+	}
+	new_ptr = malloc_simple(bytes);
+	if (!new_ptr)
+		return NULL;
+	memcpy(new_ptr, ptr, old_size - POOL_HDR);
+	free_simple(ptr);
+
+	return new_ptr;
+}
+
+bool malloc_simple_owns(const void *ptr)
+{
+	ulong pool = (ulong)gd->malloc_f_pool;
+
+	return pool && (ulong)ptr >= pool &&
+		(ulong)ptr < pool + gd->malloc_limit;
+}
+
+size_t malloc_simple_usable_size(const void *ptr)
+{
+	const struct pool_block *block;
+
+	block = container_of(ptr, struct pool_block, next);
+
+	return block->size - POOL_HDR;
+}
+
+void malloc_simple_info(struct malloc_heap_info *info)
+{
+	struct malloc_f_pool *pool = gd->malloc_f_pool;
+	struct pool_block *block;
+	int i;
+
+	memset(info, '\0', sizeof(*info));
+	info->size = gd->malloc_limit;
+	if (!pool) {
+		info->free = info->size;
+		info->largest_free = info->size;
+		return;
+	}
+	info->used = pool->used;
+	info->used_blocks = pool->used_blocks;
+	info->free_blocks = pool->free_blocks;
+	info->free = info->size - info->used;
+	info->largest_free = gd->malloc_limit - pool->top;
+	for (i = 0; i <= POOL_CLASSES; i++) {
+		for (block = pool->free[i]; block; block = block->next) {
+			info->largest_free = max(info->largest_free,
+						 block->size - POOL_HDR);
+		}
+	}
+}
+
+#else /* !SYS_MALLOC_F_POOL */
+
 void *malloc_simple(size_t bytes)
 {
 	ulong new_ptr;
@@ -44,6 +339,8 @@ void *memalign_simple(size_t align, size_t bytes)
 	return ptr;
 }
 
+#endif /* SYS_MALLOC_F_POOL */
+
 #if CONFIG_IS_ENABLED(SYS_MALLOC_SIMPLE)
 void *calloc(size_t nmemb, size_t elem_size)
 {
@@ -0,0 +1,253 @@
+/*
+ * malloc() and friends using the TLSF allocator
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <malloc.h>
+#include <tlsf.h>
+
+DECLARE_GLOBAL_DATA_PTR;
+
+/* SPL may use malloc_simple() for everything instead */
+#if !CONFIG_IS_ENABLED(SYS_MALLOC_SIMPLE)
+ulong mem_malloc_start;
+ulong mem_malloc_end;
+ulong mem_malloc_brk;
+
+static struct tlsf *malloc_pool;
+
+void mem_malloc_init(ulong start, ulong size)
+{
+	mem_malloc_start = start;
+	mem_malloc_end = start + size;
+	/* The whole area belongs to the pool from the start */
+	mem_malloc_brk = mem_malloc_end;
+
+	debug("using memory %#lx-%#lx for malloc()\n", mem_malloc_start,
+	      mem_malloc_end);
+#ifdef CONFIG_SYS_MALLOC_CLEAR_ON_INIT
+	memset((void *)mem_malloc_start, 0x0, size);
+#endif
+	malloc_pool = tlsf_create((void *)start, size);
+}
+
+/* Check whether memory came from the pool, rather than before relocation */
+static bool malloc_in_pool(void *ptr)
+{
+	return (ulong)ptr >= mem_malloc_start && (ulong)ptr < mem_malloc_end;
+}
+
+/*
+ * The functions use dlmalloc's names, such as mALLOc(), which malloc.h
+ * maps to the public names or, with CONFIG_MALLOC_TRACE, to the names of
+ * the functions which malloc_trace.c calls
+ */
+void *mALLOc(size_t bytes)
+{
+#ifdef CONFIG_SYS_MALLOC_F_LEN
+	if (!(gd->flags & GD_FLG_FULL_MALLOC_INIT))
+		return malloc_simple(bytes);
+#endif
+	if (!malloc_pool)
+		return NULL;
+
+	return tlsf_malloc(malloc_pool, bytes);
+}
+
+void fREe(void *mem)
+{
+#if CONFIG_IS_ENABLED(SYS_MALLOC_F_POOL)
+	/* Memory from before relocation goes back to its pool */
+	if (malloc_simple_owns(mem)) {
+		free_simple(mem);
+		return;
+	}
+#endif
+	/*
+	 * free() is a no-op before relocation, and memory allocated then is
+	 * left alone afterwards
+	 */
+	if (!malloc_pool || !malloc_in_pool(mem))
+		return;
+	tlsf_free(malloc_pool, mem);
+}
+
+void *rEALLOc(void *oldmem, size_t bytes)
+{
+	if (!oldmem)
+		return mALLOc(bytes);
+#if CONFIG_IS_ENABLED(SYS_MALLOC_F_POOL)
+	if (malloc_simple_owns(oldmem)) {
+		void *newmem;
+
+		if (!(gd->flags & GD_FLG_FULL_MALLOC_INIT))
+			return realloc_simple(oldmem, bytes);
+
+		/* Move memory from before relocation to the heap */
+		newmem = mALLOc(bytes);
+		if (newmem) {
+			memcpy(newmem, oldmem,
+			       min(bytes, malloc_simple_usable_size(oldmem)));
+			free_simple(oldmem);
+		}
+		return newmem;
+	}
+#endif
+#ifdef CONFIG_SYS_MALLOC_F_LEN
+	if (!(gd->flags & GD_FLG_FULL_MALLOC_INIT)) {
+		/* This is harder to support and should not be needed */
+		panic("pre-reloc realloc() is not supported");
+	}
+#endif
+	if (!malloc_pool || !malloc_in_pool(oldmem))
+		return NULL;
+
+	return tlsf_realloc(malloc_pool, oldmem, bytes);
+}
+
+void *mEMALIGn(size_t alignment, size_t bytes)
+{
+#ifdef CONFIG_SYS_MALLOC_F_LEN
+	if (!(gd->flags & GD_FLG_FULL_MALLOC_INIT))
+		return memalign_simple(alignment, bytes);
+#endif
+	if (!malloc_pool)
+		return NULL;
+
+	return tlsf_memalign(malloc_pool, alignment, bytes);
+}
+
+void *valloc(size_t bytes)
+{
+	return mEMALIGn(malloc_getpagesize, bytes);
+}
+
+void *pvalloc(size_t bytes)
+{
+	return mEMALIGn(malloc_getpagesize,
+			ALIGN(bytes, malloc_getpagesize));
+}
+
+void *cALLOc(size_t n, size_t elem_size)
+{
+	size_t size = n * elem_size;
+	void *mem;
+
+	if (elem_size && size / elem_size != n)
+		return NULL;
+	mem = mALLOc(size);
+	if (mem)
+		memset(mem, '\0', size);
+
+	return mem;
+}
+
+void cfree(void *mem)
+{
+	fREe(mem);
+}
+
+int malloc_trim(size_t pad)
+{
+	return 0;
+}
+
+size_t malloc_usable_size(void *mem)
+{
+#if CONFIG_IS_ENABLED(SYS_MALLOC_F_POOL)
+	if (malloc_simple_owns(mem))
+		return malloc_simple_usable_size(mem);
+#endif
+	if (!mem || !malloc_in_pool(mem))
+		return 0;
+
+	return tlsf_block_size(mem);
+}
+
+int mallopt(int param_number, int value)
+{
+	return 0;
+}
+
+void malloc_heap_info(struct malloc_heap_info *info)
+{
+	struct tlsf_info tinfo;
+
+	memset(info, '\0', sizeof(*info));
+	if (!malloc_pool)
+		return;
+	tlsf_get_info(malloc_pool, &tinfo);
+	info->size = tinfo.size;
+	info->used = tinfo.used;
+	info->free = tinfo.free;
+	info->largest_free = tinfo.largest_free;
+	info->used_blocks = tinfo.used_blocks;
+	info->free_blocks = tinfo.free_blocks;
+}
+
+int malloc_run_in_arena(void *mem, size_t size, int (*func)(void *priv),
+			void *priv)
+{
+	ulong start = mem_malloc_start, end = mem_malloc_end;
+	ulong brk = mem_malloc_brk;
+	struct tlsf *pool = malloc_pool;
+	int ret = -ENOMEM;
+
+	mem_malloc_init((ulong)mem, size);
+	if (malloc_pool)
+		ret = func(priv);
+
+	malloc_pool = pool;
+	mem_malloc_start = start;
+	mem_malloc_end = end;
+	mem_malloc_brk = brk;
+
+	return ret;
+}
+
+struct mallinfo mallinfo(void)
+{
+	struct mallinfo info;
+	struct tlsf_info tinfo;
+
+	memset(&info, '\0', sizeof(info));
+	if (malloc_pool) {
+		tlsf_get_info(malloc_pool, &tinfo);
+		info.arena = tinfo.size;
+		info.ordblks = tinfo.free_blocks;
+		info.uordblks = tinfo.used;
+		info.fordblks = tinfo.free;
+		info.usmblks = tinfo.max_used;
+	}
+
+	return info;
+}
+
+void malloc_stats(void)
+{
+	struct tlsf_info info;
+
+	if (!malloc_pool)
+		return;
+	tlsf_get_info(malloc_pool, &info);
+	printf("system bytes     = %10lu\n", (ulong)info.size);
+	printf("in use bytes     = %10lu\n", (ulong)info.used);
+	printf("max in use bytes = %10lu\n", (ulong)info.max_used);
+	printf("free bytes       = %10lu in %u blocks, largest %lu\n",
+	       (ulong)info.free, info.free_blocks, (ulong)info.largest_free);
+}
+
+#endif /* !SYS_MALLOC_SIMPLE */
+
+int initf_malloc(void)
+{
+#ifdef CONFIG_SYS_MALLOC_F_LEN
+	assert(gd->malloc_base);	/* Set up by crt0.S */
+	gd->malloc_limit = CONFIG_SYS_MALLOC_F_LEN;
+	gd->malloc_ptr = 0;
+#endif
+
+	return 0;
+}
@@ -0,0 +1,420 @@
+/*
+ * Record the callers of malloc() and friends
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+/*
+ * With CONFIG_MALLOC_TRACE, malloc.h renames the allocator's functions to
+ * malloc_impl() etc. and the public ones here call them and record each
+ * call. Before relocation the caller and size go in global data. After
+ * relocation each live allocation has a record in a hash table, keyed by
+ * its address, and totals are kept for each caller. Nothing is allocated
+ * for the records, so their memory use is fixed.
+ */
+
+#include <common.h>
+#include <errno.h>
+#include <malloc.h>
+
+DECLARE_GLOBAL_DATA_PTR;
+
+/* Number of callers shown in each list */
+#define TRACE_TOP	10
+
+/**
+ * struct trace_live - An allocation which has not been freed
+ *
+ * @ptr:	Address of the allocation, 0 if this record is not used
+ * @caller:	Address the allocation was made from
+ * @size:	Number of bytes requested
+ * @time:	Time of the allocation (ms)
+ */
+struct trace_live {
+	ulong ptr;
+	ulong caller;
+	u32 size;
+	u32 time;
+};
+
+/**
+ * struct trace_caller - Totals for a caller
+ *
+ * @caller:	Address the allocations were made from, 0 if not used
+ * @calls:	Number of allocations made
+ * @frees:	Number of those which have been freed
+ * @bytes:	Total bytes requested
+ * @live_bytes:	Bytes in allocations still live
+ * @peak_bytes:	Highest value of @live_bytes
+ * @lifetime:	Total time for which the freed allocations were live (ms)
+ */
+struct trace_caller {
+	ulong caller;
+	uint calls;
+	uint frees;
+	ulong bytes;
+	ulong live_bytes;
+	ulong peak_bytes;
+	ulong lifetime;
+};
+
+/**
+ * struct trace_state - Overall totals
+ *
+ * @calls:	Number of allocations made after relocation
+ * @frees:	Number of those which have been freed
+ * @live:	Number of live allocations recorded
+ * @dropped:	Number of allocations not recorded as the table was full
+ * @unknown:	Number of frees of allocations not recorded
+ * @bytes:	Bytes in live allocations which are recorded
+ * @peak:	Highest value of @bytes
+ * @peak_time:	Time when @peak was reached (ms)
+ * @busy:	true while reading the timer, which might allocate memory
+ */
+struct trace_state {
+	uint calls;
+	uint frees;
+	uint live;
+	uint dropped;
+	uint unknown;
+	ulong bytes;
+	ulong peak;
+	ulong peak_time;
+	bool busy;
+};
+
+static struct trace_live trace_live[CONFIG_MALLOC_TRACE_COUNT];
+static struct trace_caller trace_callers[CONFIG_MALLOC_TRACE_CALLERS];
+static struct trace_caller trace_other;
+static struct trace_state trace;
+
+#define trace_ret_addr()	((ulong)__builtin_return_address(0))
+
+static uint trace_hash(ulong val, uint count)
+{
+	return (u32)((val >> 3) * 0x9e3779b1) % count;
+}
+
+static ulong trace_time(void)
+{
+	ulong time;
+
+	/* A driver-model timer may allocate memory when first used */
+	if (trace.busy)
+		return 0;
+	trace.busy = true;
+	time = get_timer(0);
+	trace.busy = false;
+
+	return time;
+}
+
+static struct trace_caller *trace_find_caller(ulong caller)
+{
+	struct trace_caller *tc;
+	uint i, probe;
+
+	i = trace_hash(caller, CONFIG_MALLOC_TRACE_CALLERS);
+	for (probe = 0; probe < CONFIG_MALLOC_TRACE_CALLERS; probe++) {
+		tc = &trace_callers[i];
+		if (tc->caller == caller)
+			return tc;
+		if (!tc->caller) {
+			tc->caller = caller;
+			return tc;
+		}
+		if (++i == CONFIG_MALLOC_TRACE_CALLERS)
+			i = 0;
+	}
+
+	return &trace_other;
+}
+
+static struct trace_live *trace_find_live(ulong ptr)
+{
+	struct trace_live *rec;
+	uint i;
+
+	i = trace_hash(ptr, CONFIG_MALLOC_TRACE_COUNT);
+	for (;;) {
+		rec = &trace_live[i];
+		if (rec->ptr == ptr || !rec->ptr)
+			return rec;
+		if (++i == CONFIG_MALLOC_TRACE_COUNT)
+			i = 0;
+	}
+}
+
+/* Remove a record, moving up any later ones which would not be found */
+static void trace_remove_live(struct trace_live *rec)
+{
+	uint hole = rec - trace_live;
+	uint i = hole, home;
+
+	for (;;) {
+		if (++i == CONFIG_MALLOC_TRACE_COUNT)
+			i = 0;
+		if (!trace_live[i].ptr)
+			break;
+		home = trace_hash(trace_live[i].ptr, CONFIG_MALLOC_TRACE_COUNT);
+		if ((i > hole && (home <= hole || home > i)) ||
+		    (i < hole && home <= hole && home > i)) {
+			trace_live[hole] = trace_live[i];
+			hole = i;
+		}
+	}
+	trace_live[hole].ptr = 0;
+}
+
+static void trace_alloc(void *ptr, size_t size, ulong caller)
+{
+	struct trace_caller *tc;
+	struct trace_live *rec;
+	ulong time;
+
+	if (!ptr)
+		return;
+	if (!(gd->flags & GD_FLG_FULL_MALLOC_INIT)) {
+#ifdef CONFIG_MALLOC_TRACE_F_COUNT
+		uint i = gd->malloc_trace_f_count++;
+
+		/* Keep the offset from here, since the code may move */
+		if (i < CONFIG_MALLOC_TRACE_F_COUNT) {
+			gd->malloc_trace_f_caller[i] = caller - (ulong)malloc;
+			gd->malloc_trace_f_size[i] = size;
+		}
+#endif
+		return;
+	}
+
+	time = trace_time();
+	tc = trace_find_caller(caller);
+	tc->calls++;
+	tc->bytes += size;
+	trace.calls++;
+
+	/* Keep the table no more than 3/4 full so that lookups stay short */
+	if (trace.live >= CONFIG_MALLOC_TRACE_COUNT * 3 / 4) {
+		trace.dropped++;
+		return;
+	}
+	rec = trace_find_live((ulong)ptr);
+	rec->ptr = (ulong)ptr;
+	rec->caller = caller;
+	rec->size = size;
+	rec->time = time;
+	trace.live++;
+
+	tc->live_bytes += size;
+	tc->peak_bytes = max(tc->peak_bytes, tc->live_bytes);
+	trace.bytes += size;
+	if (trace.bytes > trace.peak) {
+		trace.peak = trace.bytes;
+		trace.peak_time = time;
+	}
+}
+
+static void trace_free(void *ptr)
+{
+	struct trace_caller *tc;
+	struct trace_live *rec;
+	ulong time;
+
+	/* Memory allocated before relocation is never freed */
+	if (!ptr || !(gd->flags & GD_FLG_FULL_MALLOC_INIT) ||
+	    (ulong)ptr < mem_malloc_start || (ulong)ptr >= mem_malloc_end)
+		return;
+	trace.frees++;
+	rec = trace_find_live((ulong)ptr);
+	if (!rec->ptr) {
+		trace.unknown++;
+		return;
+	}
+	time = trace_time();
+	tc = trace_find_caller(rec->caller);
+	tc->frees++;
+	tc->live_bytes -= rec->size;
+	if (time >= rec->time)
+		tc->lifetime += time - rec->time;
+	trace.bytes -= rec->size;
+	trace.live--;
+	trace_remove_live(rec);
+}
+
+void *malloc(size_t bytes)
+{
+	void *ptr = malloc_impl(bytes);
+
+	trace_alloc(ptr, bytes, trace_ret_addr());
+
+	return ptr;
+}
+
+void free(void *mem)
+{
+	trace_free(mem);
+	free_impl(mem);
+}
+
+void *realloc(void *oldmem, size_t bytes)
+{
+	void *ptr = realloc_impl(oldmem, bytes);
+
+	/* Count this as a new allocation from the caller of realloc() */
+	if (ptr) {
+		trace_free(oldmem);
+		trace_alloc(ptr, bytes, trace_ret_addr());
+	}
+
+	return ptr;
+}
+
+void *memalign(size_t alignment, size_t bytes)
+{
+	void *ptr = memalign_impl(alignment, bytes);
+
+	trace_alloc(ptr, bytes, trace_ret_addr());
+
+	return ptr;
+}
+
+void *calloc(size_t n, size_t elem_size)
+{
+	void *ptr = calloc_impl(n, elem_size);
+
+	trace_alloc(ptr, n * elem_size, trace_ret_addr());
+
+	return ptr;
+}
+
+int malloc_trace_get(const void *ptr, struct malloc_trace_rec *trec)
+{
+	struct trace_live *rec;
+
+	rec = trace_find_live((ulong)ptr);
+	if (!ptr || !rec->ptr)
+		return -ENOENT;
+	trec->caller = rec->caller;
+	trec->size = rec->size;
+	trec->time = rec->time;
+
+	return 0;
+}
+
+static ulong trace_peak_bytes(struct trace_caller *tc)
+{
+	return tc->peak_bytes;
+}
+
+static ulong trace_live_bytes(struct trace_caller *tc)
+{
+	return tc->live_bytes;
+}
+
+/* Print the callers with the highest values of @key */
+static void trace_show_top(ulong (*key)(struct trace_caller *tc))
+{
+	struct trace_caller *top[TRACE_TOP + 1];
+	struct trace_caller *tc;
+	int count = 0;
+	int i, j;
+
+	for (i = 0; i <= CONFIG_MALLOC_TRACE_CALLERS; i++) {
+		tc = i < CONFIG_MALLOC_TRACE_CALLERS ? &trace_callers[i] :
+			&trace_other;
+		if (!tc->calls || !key(tc))
+			continue;
+		for (j = count; j > 0 && key(top[j - 1]) < key(tc); j--)
+			top[j] = top[j - 1];
+		top[j] = tc;
+		if (count < TRACE_TOP)
+			count++;
+	}
+
+	printf("%-18s %7s %10s %10s %10s %8s\n", "caller", "calls", "bytes",
+	       "live", "peak", "life ms");
+	for (i = 0; i < count; i++) {
+		tc = top[i];
+		printf("[<%0*lx>] %7u %10lu %10lu %10lu %8lu\n",
+		       (int)sizeof(ulong) * 2, tc->caller, tc->calls, tc->bytes,
+		       tc->live_bytes, tc->peak_bytes,
+		       tc->frees ? tc->lifetime / tc->frees : 0);
+	}
+}
+
+/* Show where the addresses are, so that tools can match them to the ELF */
+static void trace_show_base(void)
+{
+	printf("malloc_trace_info() at %#lx\n", (ulong)malloc_trace_info);
+}
+
+void malloc_trace_info(void)
+{
+	struct malloc_heap_info info;
+
+	trace_show_base();
+	malloc_heap_info(&info);
+	printf("Heap:    %lu bytes, %lu used in %u blocks, %lu free in %u blocks (largest %lu)\n",
+	       info.size, info.used, info.used_blocks, info.free,
+	       info.free_blocks, info.largest_free);
+#ifdef CONFIG_MALLOC_TRACE_F_COUNT
+	{
+		uint count = gd->malloc_trace_f_count;
+		uint i;
+
+		printf("Before relocation: %lu of %lu bytes in %u calls\n",
+		       gd->malloc_ptr, gd->malloc_limit, count);
+#if CONFIG_IS_ENABLED(SYS_MALLOC_F_POOL)
+		malloc_simple_info(&info);
+		printf("Pool:    %lu bytes used in %u blocks, %u blocks free\n",
+		       info.used, info.used_blocks, info.free_blocks);
+#endif
+		for (i = 0; i < min(count, (uint)CONFIG_MALLOC_TRACE_F_COUNT);
+		     i++) {
+			printf("[<%0*lx>] %10lu\n", (int)sizeof(ulong) * 2,
+			       (ulong)malloc + gd->malloc_trace_f_caller[i],
+			       gd->malloc_trace_f_size[i]);
+		}
+		if (count > CONFIG_MALLOC_TRACE_F_COUNT)
+			printf("(%u not recorded)\n",
+			       count - CONFIG_MALLOC_TRACE_F_COUNT);
+	}
+#endif
+	printf("After relocation: %u calls, %u frees, %u live using %lu bytes\n",
+	       trace.calls, trace.frees, trace.live, trace.bytes);
+	printf("Peak:    %lu bytes at %lu ms\n", trace.peak, trace.peak_time);
+	if (trace.dropped || trace.unknown)
+		printf("Not recorded: %u calls (table full), %u frees\n",
+		       trace.dropped, trace.unknown);
+	printf("\nCallers using the most memory at their peak:\n");
+	trace_show_top(trace_peak_bytes);
+}
+
+void malloc_trace_dump(void)
+{
+	struct trace_live *rec;
+	ulong now = get_timer(0);
+	int i;
+
+	trace_show_base();
+	printf("%-*s %10s %8s  %s\n", (int)sizeof(ulong) * 2, "address",
+	       "size", "age ms", "caller");
+	for (i = 0; i < CONFIG_MALLOC_TRACE_COUNT; i++) {
+		rec = &trace_live[i];
+		if (!rec->ptr)
+			continue;
+		printf("%0*lx %10u %8lu  [<%0*lx>]\n", (int)sizeof(ulong) * 2,
+		       rec->ptr, rec->size, now - rec->time,
+		       (int)sizeof(ulong) * 2, rec->caller);
+	}
+	printf("%u live allocations using %lu bytes\n", trace.live,
+	       trace.bytes);
+}
+
+void malloc_trace_report(void)
+{
+	printf("malloc: %u allocations using %lu bytes still live, peak %lu bytes\n",
+	       trace.live, trace.bytes, trace.peak);
+	trace_show_base();
+	trace_show_top(trace_live_bytes);
+}
@@ -5,4 +5,10 @@
  * Licensed under the GPL-2 or later.
  */
 
-const char const system_map[] = SYSTEM_MAP;
+/*
+ * Each entry is "<address> <name>" with a nul terminator. The list is
+ * generated by the top-level Makefile when linking U-Boot.
+ */
+const char system_map[] =
+#include "system_map.inc"
+	"";
@@ -62,6 +62,15 @@ endif
 
 ifdef FTRACE
 PLATFORM_CPPFLAGS += -finstrument-functions -DFTRACE
+# Comma-separated lists of functions / source files not to instrument
+ifdef FTRACE_EXCLUDE_FUNCS
+PLATFORM_CPPFLAGS += \
+	-finstrument-functions-exclude-function-list=$(FTRACE_EXCLUDE_FUNCS)
+endif
+ifdef FTRACE_EXCLUDE_FILES
+PLATFORM_CPPFLAGS += \
+	-finstrument-functions-exclude-file-list=$(FTRACE_EXCLUDE_FILES)
+endif
 endif
 
 # Allow use of stdint.h if available
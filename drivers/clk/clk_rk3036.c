@@ -427,5 +427,6 @@ U_BOOT_DRIVER(clk_rk3036) = {
 	.platdata_auto_alloc_size = sizeof(struct rk3036_clk_plat),
 	.ops		= &rk3036_clk_ops,
 	.bind		= rk3036_clk_bind,
+	.bind_uclass	= UCLASS_RESET,
 	.probe		= rk3036_clk_probe,
 };
@@ -897,5 +897,6 @@ U_BOOT_DRIVER(clk_rk3288) = {
 	.platdata_auto_alloc_size = sizeof(struct rk3288_clk_plat),
 	.ops		= &rk3288_clk_ops,
 	.bind		= rk3288_clk_bind,
+	.bind_uclass	= UCLASS_RESET,
 	.probe		= rk3288_clk_probe,
 };
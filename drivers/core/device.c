@@ -26,18 +26,21 @@
 
 DECLARE_GLOBAL_DATA_PTR;
 
-int device_bind(struct udevice *parent, const struct driver *drv,
-		const char *name, void *platdata, int of_offset,
-		struct udevice **devp)
+static int device_bind_common(struct udevice *parent,
+			      const struct driver *drv, const char *name,
+			      void *platdata, int of_offset,
+			      uint of_platdata_size, struct udevice **devp)
 {
 	struct udevice *dev;   	//udevice指针，需要动态分配空间
 	struct uclass *uc;		//uclass指针
+	struct dm_timing timing;
 	int size, ret = 0;
 
 	if (devp)				//如果devp不为NULL,则用其保存最后udevice指针
 		*devp = NULL;
 	if (!name)
 		return -EINVAL;
+	dm_timing_start(&timing);
 
 	ret = uclass_get(drv->id, &uc);	//获取driver对应的uclass
 	if (ret) {
@@ -79,12 +82,29 @@ int device_bind(struct udevice *parent, const struct driver *drv,
 		}
 	}
 	//分配平台数据空间
-	if (!dev->platdata && drv->platdata_auto_alloc_size) {
-		dev->flags |= DM_FLAG_ALLOC_PDATA;
-		dev->platdata = calloc(1, drv->platdata_auto_alloc_size);
-		if (!dev->platdata) {
-			ret = -ENOMEM;
-			goto fail_alloc1;
+	if (CONFIG_IS_ENABLED(OF_PLATDATA) && of_platdata_size)
+		dev->flags |= DM_FLAG_OF_PLATDATA;
+	if (drv->platdata_auto_alloc_size) {
+		bool alloc = !platdata;
+
+		/*
+		 * With of-platdata the driver's platdata starts with the
+		 * generated struct, followed by anything the driver adds
+		 */
+		if (CONFIG_IS_ENABLED(OF_PLATDATA) && of_platdata_size &&
+		    of_platdata_size < drv->platdata_auto_alloc_size)
+			alloc = true;
+		if (alloc) {
+			dev->flags |= DM_FLAG_ALLOC_PDATA;
+			dev->platdata = calloc(1,
+					       drv->platdata_auto_alloc_size);
+			if (!dev->platdata) {
+				ret = -ENOMEM;
+				goto fail_alloc1;
+			}
+			if (CONFIG_IS_ENABLED(OF_PLATDATA) && platdata)
+				memcpy(dev->platdata, platdata,
+				       of_platdata_size);
 		}
 	}
 	//分配该uclass的平台数据
@@ -145,6 +165,7 @@ int device_bind(struct udevice *parent, const struct driver *drv,
 		*devp = dev;
 
 	dev->flags |= DM_FLAG_BOUND;
+	dm_timing_bound(dev, &timing);
 
 	return 0;
 
@@ -191,19 +212,66 @@ fail_alloc1:
 	return ret;
 }
 
+int device_bind(struct udevice *parent, const struct driver *drv,
+		const char *name, void *platdata, int of_offset,
+		struct udevice **devp)
+{
+	return device_bind_common(parent, drv, name, platdata, of_offset, 0,
+				  devp);
+}
+
+static struct driver *device_info_driver(const struct driver_info *info,
+					 const struct udevice_id **of_idp)
+{
+#if CONFIG_IS_ENABLED(OF_PLATDATA)
+	const char *compat;
+	struct driver *drv;
+
+	/* Entries generated by dtoc are matched like device tree nodes */
+	if (info->compat) {
+		for (compat = info->compat; *compat;
+		     compat += strlen(compat) + 1) {
+			if (!lists_driver_lookup_compat(compat, true, &drv,
+							of_idp))
+				return drv;
+		}
+
+		return NULL;
+	}
+#endif
+
+	return lists_driver_lookup_name(info->name);
+}
+
 int device_bind_by_name(struct udevice *parent, bool pre_reloc_only,
 			const struct driver_info *info, struct udevice **devp)
 {
+	const struct udevice_id *of_id = NULL;
+	uint platdata_size = 0;
 	struct driver *drv;
+	struct udevice *dev;
+	int ret;
 
-	drv = lists_driver_lookup_name(info->name);
+	drv = device_info_driver(info, &of_id);
 	if (!drv)
 		return -ENOENT;
 	if (pre_reloc_only && !(drv->flags & DM_FLAG_PRE_RELOC))
 		return -EPERM;
 
-	return device_bind(parent, drv, info->name, (void *)info->platdata,
-			   -1, devp);
+#if CONFIG_IS_ENABLED(OF_PLATDATA)
+	platdata_size = info->platdata_size;
+#endif
+	ret = device_bind_common(parent, drv, info->name,
+				 (void *)info->platdata, -1, platdata_size,
+				 &dev);
+	if (ret)
+		return ret;
+	if (of_id)
+		dev->driver_data = of_id->data;
+	if (devp)
+		*devp = dev;
+
+	return 0;
 }
 
 static void *alloc_priv(int size, uint flags)
@@ -224,6 +292,7 @@ static void *alloc_priv(int size, uint flags)
 int device_probe(struct udevice *dev)
 {
 	const struct driver *drv;
+	struct dm_timing timing;
 	int size = 0;
 	int ret;
 	int seq;
@@ -233,6 +302,7 @@ int device_probe(struct udevice *dev)
 
 	if (dev->flags & DM_FLAG_ACTIVATED)
 		return 0;
+	dm_timing_start(&timing);
 
 	drv = dev->driver;
 	assert(drv);
@@ -287,7 +357,7 @@ int device_probe(struct udevice *dev)
 		ret = seq;
 		goto fail;
 	}
-	dev->seq = seq;
+	uclass_set_seq(dev, seq);
 
 	dev->flags |= DM_FLAG_ACTIVATED;
 
@@ -310,7 +380,8 @@ int device_probe(struct udevice *dev)
 			goto fail;
 	}
 
-	if (drv->ofdata_to_platdata && dev->of_offset >= 0) {
+	if (drv->ofdata_to_platdata &&
+	    (dev->of_offset >= 0 || (dev->flags & DM_FLAG_OF_PLATDATA))) {
 		ret = drv->ofdata_to_platdata(dev);
 		if (ret)
 			goto fail;
@@ -327,6 +398,7 @@ int device_probe(struct udevice *dev)
 	ret = uclass_post_probe_device(dev);
 	if (ret)
 		goto fail_uclass;
+	dm_timing_probed(dev, &timing);
 
 	return 0;
 fail_uclass:
@@ -337,12 +409,282 @@ fail_uclass:
 fail:
 	dev->flags &= ~DM_FLAG_ACTIVATED;
 
-	dev->seq = -1;
+	uclass_set_seq(dev, -1);
 	device_free(dev);
 
 	return ret;
 }
 
+#if CONFIG_IS_ENABLED(DM_KEEP_PRE_RELOC)
+/* Check whether a pointer is into the pre-relocation U-Boot image */
+static bool in_image_f(const void *ptr)
+{
+	ulong start = gd->relocaddr - gd->reloc_off;
+
+	return ptr && (ulong)ptr >= start && (ulong)ptr < start + gd->mon_len;
+}
+
+/* Move a pointer into the pre-relocation image by @offset */
+static void *reloc_ptr(const void *ptr, ulong offset)
+{
+	if (in_image_f(ptr))
+		return (void *)ptr + offset;
+
+	return (void *)ptr;
+}
+
+/* Copy data which was allocated by driver model before relocation */
+static void *reloc_copy(const void *data, int size, uint flags)
+{
+	void *copy;
+
+	copy = alloc_priv(size, flags);
+	if (copy)
+		memcpy(copy, data, size);
+
+	return copy;
+}
+
+/*
+ * Find the new name for a device. The name of a device bound from a device
+ * tree node is in the relocated device tree. Other names are copied unless
+ * they are in the image.
+ */
+static const char *reloc_name(struct udevice *old, ulong offset,
+			      bool *allocedp)
+{
+	const char *name;
+
+	*allocedp = false;
+	if (in_image_f(old->name))
+		return reloc_ptr(old->name, offset);
+	if (old->of_offset >= 0) {
+		name = fdt_get_name(gd->fdt_blob, old->of_offset, NULL);
+		if (name && !strcmp(name, old->name))
+			return name;
+	}
+	*allocedp = true;
+
+	return strdup(old->name);
+}
+
+/*
+ * Find the relocated driver of a device bound before relocation, and the
+ * offset to add to other pointers into the image. Sandbox does not move its
+ * code, although gd->reloc_off is set.
+ */
+static const struct driver *reloc_driver(struct udevice *old, ulong *offsetp)
+{
+	struct driver *drivers = ll_entry_start(struct driver, driver);
+	const int n_ents = ll_entry_count(struct driver, driver);
+	const struct driver *drv = old->driver;
+	ulong offset;
+
+	offset = drv >= drivers && drv < drivers + n_ents ? 0 : gd->reloc_off;
+	drv = (void *)drv + offset;
+	if (drv < drivers || drv >= drivers + n_ents)
+		return NULL;
+	*offsetp = offset;
+
+	return drv;
+}
+
+bool device_can_relocate(struct udevice *old)
+{
+	const struct driver *drv, *parent_drv;
+	struct uclass_driver *uc_drv;
+	ulong offset;
+	int size;
+
+	drv = reloc_driver(old, &offset);
+	uc_drv = drv ? lists_uclass_lookup(drv->id) : NULL;
+	if (!uc_drv)
+		return false;
+	if (old->platdata && !(old->flags & DM_FLAG_ALLOC_PDATA))
+		return false;
+	if (old->uclass_platdata &&
+	    !(old->flags & DM_FLAG_ALLOC_UCLASS_PDATA))
+		return false;
+	if (old->parent_platdata &&
+	    !(old->flags & DM_FLAG_ALLOC_PARENT_PDATA))
+		return false;
+	if (old->priv && !drv->priv_auto_alloc_size)
+		return false;
+	if (old->uclass_priv && !uc_drv->per_device_auto_alloc_size)
+		return false;
+	if (old->parent_priv) {
+		parent_drv = old->parent ? reloc_driver(old->parent, &offset) :
+				NULL;
+		if (!parent_drv)
+			return false;
+		size = parent_drv->per_child_auto_alloc_size;
+		uc_drv = lists_uclass_lookup(parent_drv->id);
+		if (!size && uc_drv)
+			size = uc_drv->per_child_auto_alloc_size;
+		if (!size)
+			return false;
+	}
+
+	return true;
+}
+
+int device_relocate(struct udevice *parent, struct udevice *old,
+		    struct udevice **devp)
+{
+	const struct driver *drv;
+	struct udevice *dev;
+	struct uclass *uc;
+	bool probed = false;
+	bool name_alloced;
+	ulong offset;
+	int size, ret;
+
+	*devp = NULL;
+	drv = reloc_driver(old, &offset);
+	if (!drv)
+		return -ENOENT;
+	if (!device_can_relocate(old))
+		return -EPERM;
+	ret = uclass_get(drv->id, &uc);
+	if (ret)
+		return ret;
+
+	dev = calloc(1, sizeof(struct udevice));
+	if (!dev)
+		return -ENOMEM;
+	INIT_LIST_HEAD(&dev->sibling_node);
+	INIT_LIST_HEAD(&dev->child_head);
+	INIT_LIST_HEAD(&dev->uclass_node);
+#ifdef CONFIG_DEVRES
+	INIT_LIST_HEAD(&dev->devres_head);
+#endif
+	dev->driver = drv;
+	dev->of_offset = old->of_offset;
+	/* This is often a pointer to data in the image, from of_match */
+	dev->driver_data = (ulong)reloc_ptr((void *)old->driver_data, offset);
+	dev->parent = parent;
+	dev->uclass = uc;
+	dev->seq = -1;
+	dev->req_seq = old->req_seq;
+#if CONFIG_IS_ENABLED(DM_TIMING)
+	dev->bind_time = old->bind_time;
+	dev->probe_time = old->probe_time;
+#endif
+	dev->flags = old->flags & (DM_FLAG_ALLOC_PDATA |
+				   DM_FLAG_ALLOC_PARENT_PDATA |
+				   DM_FLAG_ALLOC_UCLASS_PDATA |
+				   DM_FLAG_PRE_RELOC_CHILDREN);
+	dev->flags |= DM_FLAG_RELOCATED;
+	ret = -ENOMEM;
+	dev->name = reloc_name(old, offset, &name_alloced);
+	if (!dev->name)
+		goto fail;
+	if (name_alloced)
+		dev->flags |= DM_FLAG_NAME_ALLOCED;
+
+	if (dev->flags & DM_FLAG_ALLOC_PDATA) {
+		dev->platdata = reloc_copy(old->platdata,
+					   drv->platdata_auto_alloc_size, 0);
+		if (!dev->platdata)
+			goto fail;
+	}
+	if (dev->flags & DM_FLAG_ALLOC_UCLASS_PDATA) {
+		size = uc->uc_drv->per_device_platdata_auto_alloc_size;
+		dev->uclass_platdata = reloc_copy(old->uclass_platdata, size,
+						  0);
+		if (!dev->uclass_platdata)
+			goto fail;
+	}
+	if (dev->flags & DM_FLAG_ALLOC_PARENT_PDATA) {
+		size = parent->driver->per_child_platdata_auto_alloc_size;
+		if (!size) {
+			size = parent->uclass->uc_drv->
+					per_child_platdata_auto_alloc_size;
+		}
+		dev->parent_platdata = reloc_copy(old->parent_platdata, size,
+						  0);
+		if (!dev->parent_platdata)
+			goto fail;
+	}
+
+	/*
+	 * A device can only stay probed if its driver allows it and its
+	 * parent stayed probed too. Otherwise it is probed again when used.
+	 */
+	probed = device_active(old) && (drv->flags & DM_FLAG_KEEP_PROBED) &&
+		 (!parent || device_active(parent));
+	if (probed) {
+		size = drv->priv_auto_alloc_size;
+		if (size) {
+			dev->priv = reloc_copy(old->priv, size, drv->flags);
+			if (!dev->priv)
+				goto fail;
+		}
+		size = uc->uc_drv->per_device_auto_alloc_size;
+		if (size) {
+			dev->uclass_priv = reloc_copy(old->uclass_priv, size,
+						      0);
+			if (!dev->uclass_priv)
+				goto fail;
+		}
+		size = parent ? parent->driver->per_child_auto_alloc_size : 0;
+		if (parent && !size)
+			size = parent->uclass->uc_drv->per_child_auto_alloc_size;
+		if (size) {
+			dev->parent_priv = reloc_copy(old->parent_priv, size,
+						      drv->flags);
+			if (!dev->parent_priv)
+				goto fail;
+		}
+	}
+	if (parent)
+		list_add_tail(&dev->sibling_node, &parent->child_head);
+	ret = uclass_bind_device(dev);
+	if (ret)
+		goto fail;
+	dev->flags |= DM_FLAG_BOUND;
+	*devp = dev;
+
+	if (probed) {
+		uclass_set_seq(dev, old->seq);
+		dev->flags |= DM_FLAG_ACTIVATED;
+
+		/* Let the uclass announce the device in the relocated world */
+		ret = uclass_post_probe_device(dev);
+		if (ret) {
+			dm_warn("%s: Device '%s' must be probed again: %d\n",
+				__func__, dev->name, ret);
+			dev->flags &= ~DM_FLAG_ACTIVATED;
+			uclass_set_seq(dev, -1);
+			device_free(dev);
+		}
+	}
+	dm_dbg("Kept device %s\n", dev->name);
+
+	return 0;
+
+fail:
+	list_del(&dev->sibling_node);
+	if (probed) {
+		if (drv->priv_auto_alloc_size)
+			free(dev->priv);
+		free(dev->uclass_priv);
+		free(dev->parent_priv);
+	}
+	if (dev->flags & DM_FLAG_ALLOC_PARENT_PDATA)
+		free(dev->parent_platdata);
+	if (dev->flags & DM_FLAG_ALLOC_UCLASS_PDATA)
+		free(dev->uclass_platdata);
+	if (dev->flags & DM_FLAG_ALLOC_PDATA)
+		free(dev->platdata);
+	if (dev->flags & DM_FLAG_NAME_ALLOCED)
+		free((char *)dev->name);
+	free(dev);
+
+	return ret;
+}
+#endif
+
 void *dev_get_platdata(struct udevice *dev)
 {
 	if (!dev) {
@@ -680,10 +1022,15 @@ bool device_is_last_sibling(struct udevice *dev)
 
 int device_set_name(struct udevice *dev, const char *name)
 {
+	const char *old_name = dev->name;
+
 	name = strdup(name);
 	if (!name)
 		return -ENOMEM;
-	dev->name = name;
+	uclass_set_name(dev, name);
+	if (dev->flags & DM_FLAG_NAME_ALLOCED)
+		free((char *)old_name);
+	dev->flags |= DM_FLAG_NAME_ALLOCED;
 
 	return 0;
 }
@@ -47,6 +47,7 @@ void dm_dump_all(void)
 {
 	struct udevice *root;
 
+	dm_bind_pending_all();
 	root = dm_root();
 	if (root) {
 		printf(" Class       Probed   Name\n");
@@ -16,8 +16,11 @@
 #include <dm/uclass.h>
 #include <dm/util.h>
 #include <fdtdec.h>
+#include <malloc.h>
 #include <linux/compiler.h>
 
+DECLARE_GLOBAL_DATA_PTR;
+
 struct driver *lists_driver_lookup_name(const char *name)
 {
 	struct driver *drv =
@@ -49,6 +52,29 @@ struct uclass_driver *lists_uclass_lookup(enum uclass_id id)
 	return NULL;
 }
 
+/*
+ * Find the device kept from before relocation which was bound from @info.
+ * dm_reloc_devices() adds these at the start of the list of children, so
+ * only the first @count children are checked.
+ */
+static struct udevice *lists_find_kept(struct udevice *parent, int count,
+				       const struct driver_info *info)
+{
+	struct udevice *dev;
+
+	list_for_each_entry(dev, &parent->child_head, sibling_node) {
+		if (!count--)
+			break;
+		if (strcmp(dev->name, info->name))
+			continue;
+		if (dev->flags & DM_FLAG_ALLOC_PDATA ? !info->platdata :
+		    dev->platdata == info->platdata)
+			return dev;
+	}
+
+	return NULL;
+}
+
 int lists_bind_drivers(struct udevice *parent, bool pre_reloc_only)
 {
 	struct driver_info *info =
@@ -57,9 +83,28 @@ int lists_bind_drivers(struct udevice *parent, bool pre_reloc_only)
 	struct driver_info *entry;
 	struct udevice *dev;
 	int result = 0;
+	int kept = 0;
 	int ret;
 
+	if (CONFIG_IS_ENABLED(DM_KEEP_PRE_RELOC)) {
+		list_for_each_entry(dev, &parent->child_head, sibling_node) {
+			if (!(dev->flags & DM_FLAG_RELOCATED) ||
+			    dev->of_offset >= 0)
+				break;
+			kept++;
+		}
+	}
+
 	for (entry = info; entry != info + n_ents; entry++) {
+		/* Move kept devices to the end, to keep them in order */
+		dev = kept ? lists_find_kept(parent, kept, entry) : NULL;
+		if (dev) {
+			list_move_tail(&dev->sibling_node, &parent->child_head);
+			list_move_tail(&dev->uclass_node,
+				       &dev->uclass->dev_head);
+			kept--;
+			continue;
+		}
 		ret = device_bind_by_name(parent, pre_reloc_only, entry, &dev);
 		if (ret && ret != -EPERM) {
 			dm_warn("No match for driver '%s'\n", entry->name);
@@ -99,40 +144,172 @@ int device_bind_driver_to_node(struct udevice *parent, const char *drv_name,
 	return 0;
 }
 
-#if CONFIG_IS_ENABLED(OF_CONTROL)
+#if CONFIG_IS_ENABLED(OF_CONTROL) || CONFIG_IS_ENABLED(OF_PLATDATA)
+/**
+ * struct lists_compat - a compatible string supported by a driver
+ *
+ * @compatible:	Compatible string
+ * @driver:	Driver which supports it
+ * @of_id:	Entry in the driver's of_match table
+ */
+struct lists_compat {
+	const char *compatible;
+	struct driver *driver;
+	const struct udevice_id *of_id;
+};
+
 /**
- * driver_check_compatible() - Check if a driver is compatible with this node
+ * struct lists_compat_index - all compatible strings of all drivers
+ *
+ * The entries are sorted by compatible string and then by position in the
+ * driver linker list, so that a binary search finds the same driver as a
+ * walk through the linker list would.
  *
- * @param blob:		Device tree pointer
- * @param offset:	Offset of node in device tree
- * @param of_match:	List of compatible strings to match
- * @param of_idp:	Returns the match that was found
- * @return 0 if there is a match, -ENOENT if no match, -ENODEV if the node
- * does not have a compatible string, other error <0 if there is a device
- * tree error
+ * @count:	Number of entries
+ * @entry:	Sorted entries
  */
-static int driver_check_compatible(const void *blob, int offset,
-				   const struct udevice_id *of_match,
-				   const struct udevice_id **of_idp)
+struct lists_compat_index {
+	int count;
+	struct lists_compat entry[0];
+};
+
+static int h_compare_compat(const void *v1, const void *v2)
 {
+	const struct lists_compat *entry1 = v1;
+	const struct lists_compat *entry2 = v2;
 	int ret;
 
-	*of_idp = NULL;
-	if (!of_match)
-		return -ENOENT;
+	ret = strcmp(entry1->compatible, entry2->compatible);
+	if (ret)
+		return ret;
+	if (entry1->driver != entry2->driver)
+		return entry1->driver < entry2->driver ? -1 : 1;
+
+	return entry1->of_id < entry2->of_id ? -1 : 1;
+}
+
+/**
+ * lists_compat_get_index() - get the compatible-string index
+ *
+ * The index is built on first use. This needs a few KB, so it is not done
+ * before full malloc() is available. Before relocation only the few nodes
+ * marked "u-boot,dm-pre-reloc" are bound, so a linear search is fine.
+ *
+ * @return index, or NULL if not available
+ */
+static struct lists_compat_index *lists_compat_get_index(void)
+{
+	struct driver *driver = ll_entry_start(struct driver, driver);
+	const int n_ents = ll_entry_count(struct driver, driver);
+	struct lists_compat_index *index;
+	const struct udevice_id *of_id;
+	struct lists_compat *compat;
+	struct driver *entry;
+	int count = 0;
+
+	if (gd->dm_compat_index)
+		return gd->dm_compat_index;
+	if (!(gd->flags & GD_FLG_FULL_MALLOC_INIT))
+		return NULL;
 
-	while (of_match->compatible) {
-		ret = fdt_node_check_compatible(blob, offset,
-						of_match->compatible);
-		if (!ret) {
-			*of_idp = of_match;
+	for (entry = driver; entry != driver + n_ents; entry++) {
+		for (of_id = entry->of_match; of_id && of_id->compatible;
+		     of_id++)
+			count++;
+	}
+	index = malloc(sizeof(*index) + count * sizeof(*compat));
+	if (!index)
+		return NULL;
+
+	compat = index->entry;
+	for (entry = driver; entry != driver + n_ents; entry++) {
+		for (of_id = entry->of_match; of_id && of_id->compatible;
+		     of_id++, compat++) {
+			compat->compatible = of_id->compatible;
+			compat->driver = entry;
+			compat->of_id = of_id;
+		}
+	}
+	index->count = count;
+	qsort(index->entry, count, sizeof(*compat), h_compare_compat);
+	gd->dm_compat_index = index;
+
+	return index;
+}
+
+int lists_driver_lookup_compat(const char *compat, bool use_index,
+			       struct driver **drvp,
+			       const struct udevice_id **of_idp)
+{
+	struct driver *driver = ll_entry_start(struct driver, driver);
+	const int n_ents = ll_entry_count(struct driver, driver);
+	struct lists_compat_index *index = NULL;
+	const struct udevice_id *of_id;
+	struct driver *entry;
+
+	/* SPL binds only a few devices and has no qsort() for the index */
+	if (use_index && !IS_ENABLED(CONFIG_SPL_BUILD))
+		index = lists_compat_get_index();
+	if (index) {
+		int low = 0, high = index->count;
+
+		/* Find the first entry which is not less than compat */
+		while (low < high) {
+			int mid = (low + high) / 2;
+
+			if (strcmp(index->entry[mid].compatible, compat) < 0)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+		if (low < index->count &&
+		    !strcmp(index->entry[low].compatible, compat)) {
+			*drvp = index->entry[low].driver;
+			*of_idp = index->entry[low].of_id;
 			return 0;
-		} else if (ret == -FDT_ERR_NOTFOUND) {
-			return -ENODEV;
-		} else if (ret < 0) {
-			return -EINVAL;
 		}
-		of_match++;
+
+		return -ENOENT;
+	}
+
+	for (entry = driver; entry != driver + n_ents; entry++) {
+		for (of_id = entry->of_match; of_id && of_id->compatible;
+		     of_id++) {
+			if (!strcmp(of_id->compatible, compat)) {
+				*drvp = entry;
+				*of_idp = of_id;
+				return 0;
+			}
+		}
+	}
+
+	return -ENOENT;
+}
+#endif
+
+#if CONFIG_IS_ENABLED(OF_CONTROL)
+int lists_driver_lookup_fdt(const void *blob, int offset,
+			    struct driver **drvp,
+			    const struct udevice_id **of_idp)
+{
+	const char *compat_list, *compat;
+	int compat_length;
+	int i;
+
+	compat_list = fdt_getprop(blob, offset, "compatible", &compat_length);
+	if (!compat_list)
+		return compat_length == -FDT_ERR_NOTFOUND ? -ENODEV : -EINVAL;
+
+	/*
+	 * Try the compatible strings in order, the most specific first, and
+	 * use the first driver which supports one of them
+	 */
+	for (i = 0; i < compat_length; i += strlen(compat) + 1) {
+		compat = compat_list + i;
+		dm_dbg("   - attempt to match compatible string '%s'\n",
+		       compat);
+		if (!lists_driver_lookup_compat(compat, true, drvp, of_idp))
+			return 0;
 	}
 
 	return -ENOENT;
@@ -141,54 +318,39 @@ static int driver_check_compatible(const void *blob, int offset,
 int lists_bind_fdt(struct udevice *parent, const void *blob, int offset,
 		   struct udevice **devp)
 {
-	struct driver *driver = ll_entry_start(struct driver, driver);//获得驱动列表的起始地址
-	const int n_ents = ll_entry_count(struct driver, driver);//获得驱动列表的总数量
 	const struct udevice_id *id;
-	struct driver *entry;
+	struct driver *drv;
 	struct udevice *dev;
-	bool found = false;
 	const char *name;
-	int result = 0;
-	int ret = 0;
+	int ret;
 
-	dm_dbg("bind node %s\n", fdt_get_name(blob, offset, NULL));
+	name = fdt_get_name(blob, offset, NULL);
+	dm_dbg("bind node %s\n", name);
 	if (devp)
 		*devp = NULL;
-	for (entry = driver; entry != driver + n_ents; entry++) {
-		ret = driver_check_compatible(blob, offset, entry->of_match,//检查设备节点的compatible属性
-					      &id);
-		name = fdt_get_name(blob, offset, NULL);			//获取设备节点的name
-		if (ret == -ENOENT) {
-			continue;
-		} else if (ret == -ENODEV) {
-			dm_dbg("Device '%s' has no compatible string\n", name);
-			break;
-		} else if (ret) {
-			dm_warn("Device tree error at offset %d\n", offset);
-			result = ret;
-			break;
-		}
 
-		dm_dbg("   - found match at '%s'\n", entry->name);
-		ret = device_bind(parent, entry, name, NULL, offset, &dev);//调用device_bind来绑定设备
-		if (ret) {
-			dm_warn("Error binding driver '%s': %d\n", entry->name,
-				ret);
-			return ret;
-		} else {
-			dev->driver_data = id->data;
-			found = true;
-			if (devp)
-				*devp = dev;
-		}
-		break;
+	ret = lists_driver_lookup_fdt(blob, offset, &drv, &id);
+	if (ret == -ENODEV) {
+		dm_dbg("Device '%s' has no compatible string\n", name);
+		return 0;
+	} else if (ret == -ENOENT) {
+		dm_dbg("No match for node '%s'\n", name);
+		return 0;
+	} else if (ret) {
+		dm_warn("Device tree error at offset %d\n", offset);
+		return ret;
 	}
 
-	if (!found && !result && ret != -ENODEV) {
-		dm_dbg("No match for node '%s'\n",
-		       fdt_get_name(blob, offset, NULL));
+	dm_dbg("   - found match at '%s'\n", drv->name);
+	ret = device_bind(parent, drv, name, NULL, offset, &dev);
+	if (ret) {
+		dm_warn("Error binding driver '%s': %d\n", drv->name, ret);
+		return ret;
 	}
+	dev->driver_data = id->data;
+	if (devp)
+		*devp = dev;
 
-	return result;
+	return 0;
 }
 #endif
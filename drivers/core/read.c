@@ -0,0 +1,90 @@
+/*
+ * Functions for reading device properties from the device tree
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <dm.h>
+#include <errno.h>
+#include <fdtdec.h>
+#include <libfdt.h>
+#include <of_live.h>
+#include <dm/read.h>
+
+DECLARE_GLOBAL_DATA_PTR;
+
+const void *dev_read_prop(struct udevice *dev, const char *propname,
+			  int *lenp)
+{
+	struct of_live *live = of_live_get(gd->fdt_blob);
+
+	if (live) {
+		struct of_node *np = of_live_node(live, dev->of_offset);
+
+		if (np)
+			return of_live_getprop(np, propname, lenp);
+	}
+
+	return fdt_getprop(gd->fdt_blob, dev->of_offset, propname, lenp);
+}
+
+int dev_read_u32_default(struct udevice *dev, const char *propname, int def)
+{
+	const fdt32_t *cell;
+	int len;
+
+	cell = dev_read_prop(dev, propname, &len);
+	if (!cell || len < sizeof(*cell))
+		return def;
+
+	return fdt32_to_cpu(*cell);
+}
+
+int dev_read_u32_array(struct udevice *dev, const char *propname, u32 *out,
+		       int count)
+{
+	const fdt32_t *cell;
+	int len, i;
+
+	cell = dev_read_prop(dev, propname, &len);
+	if (!cell)
+		return -FDT_ERR_NOTFOUND;
+	if (len < count * sizeof(*cell))
+		return -FDT_ERR_BADLAYOUT;
+	for (i = 0; i < count; i++)
+		out[i] = fdt32_to_cpu(cell[i]);
+
+	return 0;
+}
+
+const char *dev_read_string(struct udevice *dev, const char *propname)
+{
+	return dev_read_prop(dev, propname, NULL);
+}
+
+bool dev_read_bool(struct udevice *dev, const char *propname)
+{
+	return dev_read_prop(dev, propname, NULL) != NULL;
+}
+
+int dev_read_phandle(struct udevice *dev, const char *propname)
+{
+	struct of_live *live = of_live_get(gd->fdt_blob);
+	const fdt32_t *cell;
+	int len;
+
+	cell = dev_read_prop(dev, propname, &len);
+	if (!cell || len < sizeof(*cell))
+		return -FDT_ERR_NOTFOUND;
+	if (live)
+		return of_live_node_by_phandle(live, fdt32_to_cpu(*cell));
+
+	return fdt_node_offset_by_phandle(gd->fdt_blob, fdt32_to_cpu(*cell));
+}
+
+int dev_read_alias_seq(struct udevice *dev, int *seqp)
+{
+	return fdtdec_get_alias_seq(gd->fdt_blob, dev->uclass->uc_drv->name,
+				    dev->of_offset, seqp);
+}
@@ -57,6 +57,15 @@ void dm_set_translation_offset(fdt_addr_t offs)
 	priv->translation_offset = offs;
 }
 
+/* Drop the nodes recorded by dm_scan_fdt_lazy() */
+static void dm_pending_free(void)
+{
+#if CONFIG_IS_ENABLED(DM_LAZY_BIND)
+	free(gd->dm_pending);
+	gd->dm_pending = NULL;
+#endif
+}
+
 #if defined(CONFIG_NEEDS_MANUAL_RELOC)
 void fix_drivers(void)
 {
@@ -134,6 +143,7 @@ int dm_init(void)
 		return -EINVAL;
 	}
 	INIT_LIST_HEAD(&DM_UCLASS_ROOT_NON_CONST); /* 初始化设备列表 */
+	dm_pending_free();
 
 #if defined(CONFIG_NEEDS_MANUAL_RELOC)
 	fix_drivers();
@@ -159,6 +169,7 @@ int dm_uninit(void)
 {
 	device_remove(dm_root());
 	device_unbind(dm_root());
+	dm_pending_free();
 
 	return 0;
 }
@@ -176,10 +187,69 @@ int dm_scan_platdata(bool pre_reloc_only)
 	return ret;
 }
 
+#if CONFIG_IS_ENABLED(OF_CONTROL) || CONFIG_IS_ENABLED(DM_KEEP_PRE_RELOC)
+/**
+ * dm_place_device() - move a device to where a full scan would bind it
+ *
+ * Devices are bound in device tree order by dm_scan_fdt(), so the lists of
+ * siblings and of devices in a uclass are ordered by node offset. Devices
+ * without a node (of_offset == -1) are left where they are. This is used
+ * for devices bound after others which come later in the device tree, i.e.
+ * with lazy binding or after devices were kept across relocation.
+ *
+ * @dev:	Device to move
+ * @siblings:	true to move it within its parent's children also, false
+ *		to only move it within its uclass
+ */
+static void dm_place_device(struct udevice *dev, bool siblings)
+{
+	struct udevice *pos, *child;
+
+	if (dev->of_offset < 0)
+		goto children;
+	if (siblings) {
+		list_del(&dev->sibling_node);
+		list_for_each_entry(pos, &dev->parent->child_head,
+				    sibling_node) {
+			if (pos->of_offset > dev->of_offset)
+				break;
+		}
+		list_add_tail(&dev->sibling_node, &pos->sibling_node);
+	}
+
+	list_del(&dev->uclass_node);
+	list_for_each_entry(pos, &dev->uclass->dev_head, uclass_node) {
+		if (pos->of_offset > dev->of_offset)
+			break;
+	}
+	list_add_tail(&dev->uclass_node, &pos->uclass_node);
+
+children:
+	list_for_each_entry(child, &dev->child_head, sibling_node)
+		dm_place_device(child, false);
+}
+#endif
+
 #if CONFIG_IS_ENABLED(OF_CONTROL)
+/*
+ * Check whether a subnode of a device kept from before relocation has been
+ * bound already
+ */
+static bool dm_node_kept(struct udevice *parent, int offset)
+{
+	struct udevice *dev;
+
+	return CONFIG_IS_ENABLED(DM_KEEP_PRE_RELOC) &&
+	       (parent->flags & DM_FLAG_PRE_RELOC_CHILDREN) &&
+	       !device_find_child_by_of_offset(parent, offset, &dev);
+}
+
 int dm_scan_fdt_node(struct udevice *parent, const void *blob, int offset,
 		     bool pre_reloc_only)
 {
+	bool kept = CONFIG_IS_ENABLED(DM_KEEP_PRE_RELOC) &&
+		    (parent->flags & DM_FLAG_PRE_RELOC_CHILDREN);
+	struct udevice *dev;
 	int ret = 0, err;
 
 	for (offset = fdt_first_subnode(blob, offset);
@@ -192,16 +262,24 @@ int dm_scan_fdt_node(struct udevice *parent, const void *blob, int offset,
 			dm_dbg("   - ignoring disabled device\n");
 			continue;
 		}
-		err = lists_bind_fdt(parent, blob, offset, NULL);
+		if (dm_node_kept(parent, offset))
+			continue;
+		err = lists_bind_fdt(parent, blob, offset, &dev);
 		if (err && !ret) {
 			ret = err;
 			debug("%s: ret=%d\n", fdt_get_name(blob, offset, NULL),
 			      ret);
 		}
+		if (kept && !err && dev)
+			dm_place_device(dev, true);
 	}
 
 	if (ret)
 		dm_warn("Some drivers failed to bind\n");
+	if (pre_reloc_only)
+		parent->flags |= DM_FLAG_PRE_RELOC_CHILDREN;
+	else
+		parent->flags &= ~DM_FLAG_PRE_RELOC_CHILDREN;
 
 	return ret;
 }
@@ -210,6 +288,301 @@ int dm_scan_fdt(const void *blob, bool pre_reloc_only)
 {
 	return dm_scan_fdt_node(gd->dm_root, blob, 0, pre_reloc_only);
 }
+
+#if CONFIG_IS_ENABLED(DM_LAZY_BIND)
+#define DM_UCLASS_MASK_WORDS	((UCLASS_COUNT + 31) / 32)
+
+/**
+ * struct dm_pending_node - a top-level device tree node not yet bound
+ *
+ * @of_offset:	Offset of the node
+ * @bound:	true once the node has been bound (or binding was attempted)
+ * @uclass_mask: Bitmap of the uclasses of the drivers in the node's subtree
+ */
+struct dm_pending_node {
+	int of_offset;
+	bool bound;
+	u32 uclass_mask[DM_UCLASS_MASK_WORDS];
+};
+
+/**
+ * struct dm_pending - device tree nodes recorded by dm_scan_fdt_lazy()
+ *
+ * @blob:	Device tree blob
+ * @count:	Number of nodes
+ * @unbound:	Number of nodes not yet bound
+ * @uclass_mask: Uclasses which may be provided by nodes not yet bound
+ * @node:	Nodes, in device tree order
+ */
+struct dm_pending {
+	const void *blob;
+	int count;
+	int unbound;
+	u32 uclass_mask[DM_UCLASS_MASK_WORDS];
+	struct dm_pending_node node[0];
+};
+
+static bool dm_uclass_mask_test(const u32 *mask, enum uclass_id id)
+{
+	return mask[id / 32] & (1U << (id % 32));
+}
+
+static void dm_uclass_mask_set(u32 *mask, enum uclass_id id)
+{
+	mask[id / 32] |= 1U << (id % 32);
+}
+
+/* Record the uclasses which binding a device with @drv can provide */
+static void dm_pending_add_driver(struct dm_pending_node *node,
+				  struct driver *drv)
+{
+	struct uclass_driver *uc_drv;
+
+	dm_uclass_mask_set(node->uclass_mask, drv->id);
+	if (drv->bind_uclass != UCLASS_ROOT)
+		dm_uclass_mask_set(node->uclass_mask, drv->bind_uclass);
+	uc_drv = lists_uclass_lookup(drv->id);
+	if (uc_drv && uc_drv->bind_uclass != UCLASS_ROOT)
+		dm_uclass_mask_set(node->uclass_mask, uc_drv->bind_uclass);
+}
+
+/**
+ * dm_pending_add() - record a top-level node and the uclasses it provides
+ *
+ * Only the compatible strings are looked up, nothing is allocated. Devices
+ * which a driver binds by name, such as a PMIC's regulators, are covered by
+ * the bind_uclass member of struct driver and struct uclass_driver. A
+ * subtree may provide fewer uclasses than recorded, e.g. if the node's
+ * driver does not bind its children, but never more.
+ *
+ * @pend:	Pending nodes to add to
+ * @offset:	Offset of the top-level node
+ */
+static void dm_pending_add(struct dm_pending *pend, int offset)
+{
+	struct dm_pending_node *node = &pend->node[pend->count];
+	const void *blob = pend->blob;
+	const struct udevice_id *id;
+	struct driver *drv;
+	int depth = 0;
+	int i;
+
+	if (lists_driver_lookup_fdt(blob, offset, &drv, &id))
+		return;
+	node->of_offset = offset;
+	do {
+		if (fdtdec_get_is_enabled(blob, offset) &&
+		    !lists_driver_lookup_fdt(blob, offset, &drv, &id))
+			dm_pending_add_driver(node, drv);
+		offset = fdt_next_node(blob, offset, &depth);
+	} while (offset >= 0 && depth > 0);
+
+	for (i = 0; i < DM_UCLASS_MASK_WORDS; i++)
+		pend->uclass_mask[i] |= node->uclass_mask[i];
+	pend->count++;
+	pend->unbound++;
+}
+
+int dm_scan_fdt_lazy(const void *blob)
+{
+	struct dm_pending *pend;
+	int offset;
+	int count = 0;
+
+	dm_pending_free();
+	fdt_for_each_subnode(blob, offset, 0)
+		count++;
+	pend = calloc(1, sizeof(*pend) + count * sizeof(pend->node[0]));
+	if (!pend)
+		return -ENOMEM;
+	pend->blob = blob;
+	fdt_for_each_subnode(blob, offset, 0) {
+		if (fdtdec_get_is_enabled(blob, offset) &&
+		    !dm_node_kept(gd->dm_root, offset))
+			dm_pending_add(pend, offset);
+	}
+	gd->dm_pending = pend;
+	gd->dm_root->flags &= ~DM_FLAG_PRE_RELOC_CHILDREN;
+
+	return 0;
+}
+
+/**
+ * dm_bind_pending_node() - bind a recorded node
+ *
+ * A failure to bind is reported but otherwise ignored, since the lookup
+ * which caused it may be for a different device.
+ *
+ * @pend:	Pending nodes
+ * @node:	Node to bind
+ */
+static void dm_bind_pending_node(struct dm_pending *pend,
+				 struct dm_pending_node *node)
+{
+	struct udevice *dev;
+	int ret;
+
+	/* Binding may look up devices, so mark the node first */
+	node->bound = true;
+	pend->unbound--;
+	ret = lists_bind_fdt(gd->dm_root, pend->blob, node->of_offset, &dev);
+	if (ret) {
+		dm_warn("%s: Failed to bind '%s': %d\n", __func__,
+			fdt_get_name(pend->blob, node->of_offset, NULL), ret);
+		return;
+	}
+	if (dev)
+		dm_place_device(dev, true);
+}
+
+int dm_bind_pending(enum uclass_id id)
+{
+	struct dm_pending *pend = gd->dm_pending;
+	struct dm_pending_node *node;
+
+	if (!pend || id < 0 || id >= UCLASS_COUNT ||
+	    !dm_uclass_mask_test(pend->uclass_mask, id))
+		return 0;
+
+	for (node = pend->node; node != pend->node + pend->count; node++) {
+		if (!node->bound && dm_uclass_mask_test(node->uclass_mask, id))
+			dm_bind_pending_node(pend, node);
+	}
+	pend->uclass_mask[id / 32] &= ~(1U << (id % 32));
+
+	return 0;
+}
+
+int dm_bind_pending_all(void)
+{
+	struct dm_pending *pend = gd->dm_pending;
+	struct dm_pending_node *node;
+
+	if (!pend)
+		return 0;
+
+	for (node = pend->node; node != pend->node + pend->count; node++) {
+		if (!node->bound)
+			dm_bind_pending_node(pend, node);
+	}
+	memset(pend->uclass_mask, '\0', sizeof(pend->uclass_mask));
+
+	return 0;
+}
+
+bool dm_has_pending(void)
+{
+	struct dm_pending *pend = gd->dm_pending;
+
+	return pend && pend->unbound;
+}
+#endif /* DM_LAZY_BIND */
+#endif
+
+#if CONFIG_IS_ENABLED(DM_KEEP_PRE_RELOC)
+/* Check that a device and all its children can be moved */
+static bool dm_reloc_subtree_ok(struct udevice *old)
+{
+	struct udevice *child;
+
+	if (!device_can_relocate(old))
+		return false;
+	list_for_each_entry(child, &old->child_head, sibling_node) {
+		if (!dm_reloc_subtree_ok(child))
+			return false;
+	}
+
+	return true;
+}
+
+/* Move a device and its children into the new driver model */
+static struct udevice *dm_reloc_subtree(struct udevice *parent,
+					struct udevice *old)
+{
+	struct udevice *dev, *child;
+	int ret;
+
+	ret = device_relocate(parent, old, &dev);
+	if (ret) {
+		dm_warn("%s: Device '%s' will be bound again: %d\n", __func__,
+			old->name, ret);
+		return NULL;
+	}
+	list_for_each_entry(child, &old->child_head, sibling_node)
+		dm_reloc_subtree(dev, child);
+
+	return dev;
+}
+
+/*
+ * Bind the children which were skipped before relocation, by running the
+ * uclass post_bind() method again, e.g. to scan a bus. The method must not
+ * bind subnodes which already have a device: dm_scan_fdt_node() takes care
+ * of this.
+ */
+static int dm_reloc_bind_children(struct udevice *dev)
+{
+	struct uclass_driver *uc_drv = dev->uclass->uc_drv;
+	struct udevice *child;
+	int ret;
+
+	if ((dev->flags & DM_FLAG_PRE_RELOC_CHILDREN) && uc_drv->post_bind) {
+		ret = uc_drv->post_bind(dev);
+		if (ret)
+			return ret;
+		dev->flags &= ~DM_FLAG_PRE_RELOC_CHILDREN;
+	}
+	list_for_each_entry(child, &dev->child_head, sibling_node) {
+		if (child->flags & DM_FLAG_RELOCATED) {
+			ret = dm_reloc_bind_children(child);
+			if (ret)
+				return ret;
+		}
+	}
+
+	return 0;
+}
+
+int dm_reloc_devices(struct udevice *root_f, bool of_nodes)
+{
+	struct udevice *old, *dev;
+	int ret;
+
+	if (!root_f)
+		return 0;
+	list_for_each_entry(old, &root_f->child_head, sibling_node) {
+		if ((old->of_offset >= 0) != of_nodes)
+			continue;
+		/*
+		 * A subtree is bound again by the scans which follow unless
+		 * all of it can be moved, since a bus which was kept would
+		 * not bind its children again
+		 */
+		if (!dm_reloc_subtree_ok(old)) {
+			dm_dbg("Device '%s' will be bound again\n", old->name);
+			continue;
+		}
+		/* Some nodes may have been bound out of order, e.g. timers */
+		dev = dm_reloc_subtree(gd->dm_root, old);
+		if (dev && of_nodes)
+			dm_place_device(dev, true);
+	}
+
+	/* The device tree scan must skip the nodes which were kept */
+	if (of_nodes)
+		gd->dm_root->flags |= DM_FLAG_PRE_RELOC_CHILDREN;
+
+	list_for_each_entry(dev, &gd->dm_root->child_head, sibling_node) {
+		if ((dev->flags & DM_FLAG_RELOCATED) &&
+		    (dev->of_offset >= 0) == of_nodes) {
+			ret = dm_reloc_bind_children(dev);
+			if (ret)
+				return ret;
+		}
+	}
+
+	return 0;
+}
 #endif
 
 __weak int dm_scan_other(bool pre_reloc_only)
@@ -226,6 +599,18 @@ int dm_init_and_scan(bool pre_reloc_only)
 		debug("dm_init() failed: %d\n", ret);
 		return ret;
 	}
+
+	/*
+	 * Devices kept from before relocation are moved in the order a full
+	 * scan would bind them, so that sequence numbers come out the same
+	 */
+	if (CONFIG_IS_ENABLED(DM_KEEP_PRE_RELOC) && !pre_reloc_only) {
+		ret = dm_reloc_devices(gd->dm_root_f, false);
+		if (ret) {
+			debug("dm_reloc_devices() failed: %d\n", ret);
+			return ret;
+		}
+	}
 	ret = dm_scan_platdata(pre_reloc_only);
 	if (ret) {
 		debug("dm_scan_platdata() failed: %d\n", ret);
@@ -233,7 +618,17 @@ int dm_init_and_scan(bool pre_reloc_only)
 	}
 
 	if (CONFIG_IS_ENABLED(OF_CONTROL)) {
-		ret = dm_scan_fdt(gd->fdt_blob, pre_reloc_only);
+		if (CONFIG_IS_ENABLED(DM_KEEP_PRE_RELOC) && !pre_reloc_only) {
+			ret = dm_reloc_devices(gd->dm_root_f, true);
+			if (ret) {
+				debug("dm_reloc_devices() failed: %d\n", ret);
+				return ret;
+			}
+		}
+		if (CONFIG_IS_ENABLED(DM_LAZY_BIND) && !pre_reloc_only)
+			ret = dm_scan_fdt_lazy(gd->fdt_blob);
+		else
+			ret = dm_scan_fdt(gd->fdt_blob, pre_reloc_only);
 		if (ret) {
 			debug("dm_scan_fdt() failed: %d\n", ret);
 			return ret;
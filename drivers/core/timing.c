@@ -0,0 +1,190 @@
+/*
+ * Recording of the time taken to bind and probe each device
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <dm.h>
+#include <errno.h>
+#include <libfdt.h>
+#include <malloc.h>
+#include <dm/device-internal.h>
+#include <dm/root.h>
+#include <dm/util.h>
+
+DECLARE_GLOBAL_DATA_PTR;
+
+static ulong dm_timing_now(void)
+{
+#if defined(CONFIG_TIMER) && !defined(CONFIG_TIMER_EARLY)
+	/* Reading the timer would probe it, which we would then time */
+	if (!gd->timer)
+		return 0;
+#endif
+	return timer_get_us();
+}
+
+void dm_timing_start(struct dm_timing *tm)
+{
+	tm->start = dm_timing_now();
+	tm->nested = gd->dm_timing_nested;
+}
+
+static uint dm_timing_end(struct dm_timing *tm)
+{
+	ulong elapsed, nested;
+
+	if (!tm->start)
+		return 0;
+	elapsed = dm_timing_now() - tm->start;
+	nested = gd->dm_timing_nested - tm->nested;
+
+	/* Our caller's time excludes all of this, including nested devices */
+	gd->dm_timing_nested = tm->nested + elapsed;
+
+	return elapsed > nested ? elapsed - nested : 0;
+}
+
+void dm_timing_bound(struct udevice *dev, struct dm_timing *tm)
+{
+	dev->bind_time = dm_timing_end(tm);
+}
+
+void dm_timing_probed(struct udevice *dev, struct dm_timing *tm)
+{
+	dev->probe_time = dm_timing_end(tm);
+}
+
+/* Add a device and its children to @list, returning the new count */
+static int dm_timing_collect(struct udevice *dev, struct udevice **list,
+			     int count)
+{
+	struct udevice *child;
+
+	if (list)
+		list[count] = dev;
+	count++;
+	list_for_each_entry(child, &dev->child_head, sibling_node)
+		count = dm_timing_collect(child, list, count);
+
+	return count;
+}
+
+static int dm_timing_compare(const void *p1, const void *p2)
+{
+	const struct udevice *dev1 = *(struct udevice **)p1;
+	const struct udevice *dev2 = *(struct udevice **)p2;
+	ulong time1 = dev1->bind_time + dev1->probe_time;
+	ulong time2 = dev2->bind_time + dev2->probe_time;
+
+	if (time1 != time2)
+		return time1 < time2 ? 1 : -1;
+
+	return 0;
+}
+
+/**
+ * dm_timing_list() - Get a list of all devices, most expensive first
+ *
+ * @listp:	Returns the list, which the caller must free
+ * @return number of devices, -ENODEV if driver model is not running, or
+ * -ENOMEM if out of memory
+ */
+static int dm_timing_list(struct udevice ***listp)
+{
+	struct udevice *root = dm_root();
+	struct udevice **list;
+	int count;
+
+	if (!root)
+		return -ENODEV;
+	count = dm_timing_collect(root, NULL, 0);
+	list = malloc(count * sizeof(*list));
+	if (!list)
+		return -ENOMEM;
+	dm_timing_collect(root, list, 0);
+	qsort(list, count, sizeof(*list), dm_timing_compare);
+	*listp = list;
+
+	return count;
+}
+
+void dm_dump_time(void)
+{
+	ulong total_bind = 0, total_probe = 0;
+	struct udevice **list;
+	char class_name[12];
+	int count, i;
+
+	count = dm_timing_list(&list);
+	if (count < 0) {
+		printf("Cannot list devices (err=%d)\n", count);
+		return;
+	}
+	printf("%10s %10s  %-11s %s\n", "Bind(us)", "Probe(us)", "Uclass",
+	       "Device");
+	for (i = 0; i < count; i++) {
+		struct udevice *dev = list[i];
+
+		strlcpy(class_name, dev->uclass->uc_drv->name,
+			sizeof(class_name));
+		printf("%10u %10u  %-11s %s\n", dev->bind_time,
+		       dev->probe_time, class_name, dev->name);
+		total_bind += dev->bind_time;
+		total_probe += dev->probe_time;
+	}
+	printf("%10lu %10lu  Total for %d devices\n", total_bind, total_probe,
+	       count);
+	free(list);
+}
+
+#ifdef CONFIG_OF_LIBFDT
+int dm_timing_fdt_report(void *blob, int parent)
+{
+	struct udevice **list;
+	int count, i;
+	int node;
+	int ret;
+
+	count = dm_timing_list(&list);
+	if (count < 0)
+		return count;
+	node = fdt_add_subnode(blob, parent, "dm");
+	if (node < 0) {
+		ret = node;
+		goto err;
+	}
+
+	/* Add in reverse, so that the most expensive device comes first */
+	for (i = count - 1; i >= 0; i--) {
+		struct udevice *dev = list[i];
+		int subnode;
+
+		if (!dev->bind_time && !dev->probe_time)
+			continue;
+		subnode = fdt_add_subnode(blob, node, simple_itoa(i));
+		if (subnode < 0) {
+			ret = subnode;
+			goto err;
+		}
+		ret = fdt_setprop_string(blob, subnode, "name", dev->name);
+		if (!ret)
+			ret = fdt_setprop_string(blob, subnode, "uclass",
+						 dev->uclass->uc_drv->name);
+		if (!ret)
+			ret = fdt_setprop_cell(blob, subnode, "bind",
+					       dev->bind_time);
+		if (!ret)
+			ret = fdt_setprop_cell(blob, subnode, "probe",
+					       dev->probe_time);
+		if (ret)
+			goto err;
+	}
+	ret = 0;
+err:
+	free(list);
+
+	return ret;
+}
+#endif
@@ -10,9 +10,11 @@
 #include <common.h>
 #include <errno.h>
 #include <malloc.h>
+#include <of_live.h>
 #include <dm/device.h>
 #include <dm/device-internal.h>
 #include <dm/lists.h>
+#include <dm/root.h>
 #include <dm/uclass.h>
 #include <dm/uclass-internal.h>
 #include <dm/util.h>
@@ -100,6 +102,345 @@ fail_mem:
 	return ret;
 }
 
+#if CONFIG_IS_ENABLED(DM_UCLASS_INDEX)
+/* Sequence numbers above this are looked up by walking the device list */
+#define UCLASS_SEQ_INDEX_MAX	128
+
+static uint uclass_hash_name(struct uclass *uc, const char *name)
+{
+	uint hash = 5381;
+
+	while (*name)
+		hash = hash * 33 + *name++;
+
+	return hash & (uc->hash_size - 1);
+}
+
+static uint uclass_hash_node(struct uclass *uc, int node)
+{
+	/* Node offsets are 4-byte aligned */
+	return ((uint)node >> 2) & (uc->hash_size - 1);
+}
+
+/**
+ * uclass_seq_slot() - get the lookup table entry for a sequence number
+ *
+ * @uc:		uclass to check
+ * @seq:	Sequence number
+ * @grow:	true to enlarge the table if needed
+ * @return entry, or NULL if the number is not in the table
+ */
+static struct uclass_seq_slot *uclass_seq_slot(struct uclass *uc, int seq,
+					       bool grow)
+{
+	struct uclass_seq_slot *tab;
+	int size;
+
+	if (seq < 0 || seq >= UCLASS_SEQ_INDEX_MAX)
+		return NULL;
+	if (seq >= uc->seq_size) {
+		if (!grow)
+			return NULL;
+		for (size = uc->seq_size ? uc->seq_size : 8; size <= seq;)
+			size *= 2;
+		tab = realloc(uc->seq_tab, size * sizeof(*tab));
+		if (!tab) {
+			uc->no_index = true;
+			return NULL;
+		}
+		memset(tab + uc->seq_size, '\0',
+		       (size - uc->seq_size) * sizeof(*tab));
+		uc->seq_tab = tab;
+		uc->seq_size = size;
+	}
+
+	return &uc->seq_tab[seq];
+}
+
+static void uclass_seq_add(struct udevice **slotp, struct udevice *dev)
+{
+	if (!*slotp)
+		*slotp = dev;
+	else if (*slotp != dev)
+		*slotp = UCLASS_INDEX_DUP;
+}
+
+static void uclass_seq_remove(struct udevice **slotp, struct udevice *dev)
+{
+	if (*slotp == dev)
+		*slotp = NULL;
+}
+
+static void uclass_hash_link(struct uclass *uc, struct udevice *dev)
+{
+	struct udevice **bucket;
+
+	bucket = &uc->name_hash[uclass_hash_name(uc, dev->name)];
+	dev->name_next = *bucket;
+	*bucket = dev;
+
+	if (dev->of_offset < 0) {
+		uc->unindexed_nodes++;
+		return;
+	}
+	bucket = &uc->node_hash[uclass_hash_node(uc, dev->of_offset)];
+	dev->node_next = *bucket;
+	*bucket = dev;
+}
+
+/* Remove a device from a hash chain, returning true if it was found */
+static bool uclass_hash_unlink(struct udevice **bucket, struct udevice *dev,
+			       bool name)
+{
+	struct udevice **nextp = bucket;
+
+	while (*nextp) {
+		if (*nextp == dev) {
+			*nextp = name ? dev->name_next : dev->node_next;
+			return true;
+		}
+		nextp = name ? &(*nextp)->name_next : &(*nextp)->node_next;
+	}
+
+	return false;
+}
+
+/**
+ * uclass_hash_remove() - remove a device from the hash tables
+ *
+ * The device's bucket is tried first. If its name or node has been changed
+ * behind our back, all buckets are searched so that nothing is left
+ * pointing at the device.
+ */
+static void uclass_hash_remove(struct uclass *uc, struct udevice *dev)
+{
+	int i;
+
+	if (!uclass_hash_unlink(&uc->name_hash[uclass_hash_name(uc,
+				dev->name)], dev, true)) {
+		for (i = 0; i < uc->hash_size; i++) {
+			if (uclass_hash_unlink(&uc->name_hash[i], dev, true))
+				break;
+		}
+	}
+
+	if (dev->of_offset >= 0 &&
+	    uclass_hash_unlink(&uc->node_hash[uclass_hash_node(uc,
+			       dev->of_offset)], dev, false))
+		return;
+	for (i = 0; i < uc->hash_size; i++) {
+		if (uclass_hash_unlink(&uc->node_hash[i], dev, false))
+			return;
+	}
+	uc->unindexed_nodes--;
+}
+
+/* Resize the hash tables and add all the uclass's devices to them */
+static int uclass_hash_rebuild(struct uclass *uc, int size)
+{
+	struct udevice **name_hash, **node_hash;
+	struct udevice *dev;
+
+	name_hash = calloc(size, sizeof(*name_hash));
+	node_hash = calloc(size, sizeof(*node_hash));
+	if (!name_hash || !node_hash) {
+		free(name_hash);
+		free(node_hash);
+		return -ENOMEM;
+	}
+	free(uc->name_hash);
+	free(uc->node_hash);
+	uc->name_hash = name_hash;
+	uc->node_hash = node_hash;
+	uc->hash_size = size;
+	uc->unindexed_nodes = 0;
+	list_for_each_entry(dev, &uc->dev_head, uclass_node)
+		uclass_hash_link(uc, dev);
+
+	return 0;
+}
+
+static void uclass_index_add(struct udevice *dev)
+{
+	struct uclass *uc = dev->uclass;
+	struct uclass_seq_slot *slot;
+
+	if (uc->no_index)
+		return;
+	slot = uclass_seq_slot(uc, dev->req_seq, true);
+	if (slot)
+		uclass_seq_add(&slot->req_dev, dev);
+	slot = uclass_seq_slot(uc, dev->seq, true);
+	if (slot)
+		uclass_seq_add(&slot->dev, dev);
+
+	/* Keep the average chain length at one or less */
+	if (++uc->dev_count > uc->hash_size) {
+		if (uclass_hash_rebuild(uc, uc->hash_size ?
+					uc->hash_size * 2 : 8))
+			uc->no_index = true;
+		return;
+	}
+	uclass_hash_link(uc, dev);
+}
+
+static void uclass_index_remove(struct udevice *dev)
+{
+	struct uclass *uc = dev->uclass;
+	struct uclass_seq_slot *slot;
+
+	if (uc->no_index)
+		return;
+	slot = uclass_seq_slot(uc, dev->req_seq, false);
+	if (slot)
+		uclass_seq_remove(&slot->req_dev, dev);
+	slot = uclass_seq_slot(uc, dev->seq, false);
+	if (slot)
+		uclass_seq_remove(&slot->dev, dev);
+	uclass_hash_remove(uc, dev);
+	uc->dev_count--;
+}
+
+static void uclass_index_free(struct uclass *uc)
+{
+	free(uc->seq_tab);
+	free(uc->name_hash);
+	free(uc->node_hash);
+}
+
+/**
+ * uclass_index_find_seq() - look up a sequence number in the index
+ *
+ * @return 0 if found, -ENODEV if there is no such device, -EAGAIN if the
+ * device list must be searched instead
+ */
+static int uclass_index_find_seq(struct uclass *uc, int seq,
+				 bool find_req_seq, struct udevice **devp)
+{
+	struct uclass_seq_slot *slot;
+	struct udevice *dev;
+
+	if (uc->no_index || seq >= UCLASS_SEQ_INDEX_MAX)
+		return -EAGAIN;
+	slot = uclass_seq_slot(uc, seq, false);
+	if (!slot)
+		return -ENODEV;
+	dev = find_req_seq ? slot->req_dev : slot->dev;
+	if (!dev)
+		return -ENODEV;
+	if (dev == UCLASS_INDEX_DUP)
+		return -EAGAIN;
+	*devp = dev;
+
+	return 0;
+}
+
+/* As uclass_index_find_seq(), for an exact name */
+static int uclass_index_find_name(struct uclass *uc, const char *name,
+				  struct udevice **devp)
+{
+	struct udevice *dev;
+	int count = 0;
+
+	if (uc->no_index || !uc->hash_size)
+		return -EAGAIN;
+	for (dev = uc->name_hash[uclass_hash_name(uc, name)]; dev;
+	     dev = dev->name_next) {
+		if (!strcmp(dev->name, name)) {
+			*devp = dev;
+			count++;
+		}
+	}
+
+	/* With no exact match, a name prefix may still match */
+	return count == 1 ? 0 : -EAGAIN;
+}
+
+/* As uclass_index_find_seq(), for a device tree node */
+static int uclass_index_find_node(struct uclass *uc, int node,
+				  struct udevice **devp)
+{
+	struct udevice *dev;
+	int count = 0;
+
+	if (uc->no_index || !uc->hash_size)
+		return -EAGAIN;
+	for (dev = uc->node_hash[uclass_hash_node(uc, node)]; dev;
+	     dev = dev->node_next) {
+		if (dev->of_offset == node) {
+			*devp = dev;
+			count++;
+		}
+	}
+	if (count == 1)
+		return 0;
+
+	/* A device bound without a node may have been given one later */
+	return count || uc->unindexed_nodes ? -EAGAIN : -ENODEV;
+}
+
+void uclass_set_seq(struct udevice *dev, int seq)
+{
+	struct uclass *uc = dev->uclass;
+	struct uclass_seq_slot *slot;
+
+	if (uc->no_index) {
+		dev->seq = seq;
+		return;
+	}
+	slot = uclass_seq_slot(uc, dev->seq, false);
+	if (slot)
+		uclass_seq_remove(&slot->dev, dev);
+	dev->seq = seq;
+	slot = uclass_seq_slot(uc, seq, true);
+	if (slot)
+		uclass_seq_add(&slot->dev, dev);
+}
+#else
+void uclass_set_seq(struct udevice *dev, int seq)
+{
+	dev->seq = seq;
+}
+
+static inline void uclass_index_add(struct udevice *dev)
+{
+}
+
+static inline void uclass_index_remove(struct udevice *dev)
+{
+}
+
+static inline void uclass_index_free(struct uclass *uc)
+{
+}
+
+static inline int uclass_index_find_seq(struct uclass *uc, int seq,
+					bool find_req_seq,
+					struct udevice **devp)
+{
+	return -EAGAIN;
+}
+
+static inline int uclass_index_find_name(struct uclass *uc, const char *name,
+					 struct udevice **devp)
+{
+	return -EAGAIN;
+}
+
+static inline int uclass_index_find_node(struct uclass *uc, int node,
+					 struct udevice **devp)
+{
+	return -EAGAIN;
+}
+#endif /* DM_UCLASS_INDEX */
+
+void uclass_set_name(struct udevice *dev, const char *name)
+{
+	uclass_index_remove(dev);
+	dev->name = name;
+	uclass_index_add(dev);
+}
+
 int uclass_destroy(struct uclass *uc)
 {
 	struct uclass_driver *uc_drv;
@@ -129,6 +470,7 @@ int uclass_destroy(struct uclass *uc)
 	list_del(&uc->sibling_node);
 	if (uc_drv->priv_auto_alloc_size)
 		free(uc->priv);
+	uclass_index_free(uc);
 	free(uc);
 
 	return 0;
@@ -139,6 +481,8 @@ int uclass_get(enum uclass_id id, struct uclass **ucp)
 	struct uclass *uc;
 
 	*ucp = NULL;
+	/* Bind any device tree nodes which may provide this uclass */
+	dm_bind_pending(id);
 	uc = uclass_find(id);
 	if (!uc)
 		return uclass_add(id, ucp);
@@ -200,11 +544,35 @@ int uclass_find_next_device(struct udevice **devp)
 	return 0;
 }
 
+/* Find a device by name in a uclass, see below */
+static int uclass_find_name(struct uclass *uc, const char *name,
+			    struct udevice **devp)
+{
+	struct udevice *dev;
+
+	if (!uclass_index_find_name(uc, name, devp))
+		return 0;
+
+	list_for_each_entry(dev, &uc->dev_head, uclass_node) {
+		if (!strcmp(dev->name, name)) {
+			*devp = dev;
+			return 0;
+		}
+	}
+	list_for_each_entry(dev, &uc->dev_head, uclass_node) {
+		if (!strncmp(dev->name, name, strlen(name))) {
+			*devp = dev;
+			return 0;
+		}
+	}
+
+	return -ENODEV;
+}
+
 int uclass_find_device_by_name(enum uclass_id id, const char *name,
 			       struct udevice **devp)
 {
 	struct uclass *uc;
-	struct udevice *dev;
 	int ret;
 
 	*devp = NULL;
@@ -213,13 +581,45 @@ int uclass_find_device_by_name(enum uclass_id id, const char *name,
 	ret = uclass_get(id, &uc);
 	if (ret)
 		return ret;
+	ret = uclass_find_name(uc, name, devp);
+
+	/*
+	 * A driver may bind devices by name in this uclass without giving it
+	 * in bind_uclass, so bind everything else before giving up
+	 */
+	if (ret == -ENODEV && dm_has_pending()) {
+		debug("%s: '%s' not found, binding all pending nodes\n",
+		      __func__, name);
+		dm_bind_pending_all();
+		ret = uclass_find_name(uc, name, devp);
+	}
+
+	return ret;
+}
+
+/* Find a device by sequence number in a uclass, see below */
+static int uclass_find_seq(struct uclass *uc, int seq_or_req_seq,
+			   bool find_req_seq, struct udevice **devp)
+{
+	struct udevice *dev;
+	int ret;
+
+	ret = uclass_index_find_seq(uc, seq_or_req_seq, find_req_seq, devp);
+	if (ret != -EAGAIN) {
+		debug("   - %s\n", ret ? "not found" : "found");
+		return ret;
+	}
 
 	list_for_each_entry(dev, &uc->dev_head, uclass_node) {
-		if (!strncmp(dev->name, name, strlen(name))) {
+		debug("   - %d %d\n", dev->req_seq, dev->seq);
+		if ((find_req_seq ? dev->req_seq : dev->seq) ==
+				seq_or_req_seq) {
 			*devp = dev;
+			debug("   - found\n");
 			return 0;
 		}
 	}
+	debug("   - not found\n");
 
 	return -ENODEV;
 }
@@ -228,7 +628,6 @@ int uclass_find_device_by_seq(enum uclass_id id, int seq_or_req_seq,
 			      bool find_req_seq, struct udevice **devp)
 {
 	struct uclass *uc;
-	struct udevice *dev;
 	int ret;
 
 	*devp = NULL;
@@ -239,18 +638,7 @@ int uclass_find_device_by_seq(enum uclass_id id, int seq_or_req_seq,
 	if (ret)
 		return ret;
 
-	list_for_each_entry(dev, &uc->dev_head, uclass_node) {
-		debug("   - %d %d\n", dev->req_seq, dev->seq);
-		if ((find_req_seq ? dev->req_seq : dev->seq) ==
-				seq_or_req_seq) {
-			*devp = dev;
-			debug("   - found\n");
-			return 0;
-		}
-	}
-	debug("   - not found\n");
-
-	return -ENODEV;
+	return uclass_find_seq(uc, seq_or_req_seq, find_req_seq, devp);
 }
 
 int uclass_find_device_by_of_offset(enum uclass_id id, int node,
@@ -266,6 +654,9 @@ int uclass_find_device_by_of_offset(enum uclass_id id, int node,
 	ret = uclass_get(id, &uc);
 	if (ret)
 		return ret;
+	ret = uclass_index_find_node(uc, node, devp);
+	if (ret != -EAGAIN)
+		return ret;
 
 	list_for_each_entry(dev, &uc->dev_head, uclass_node) {
 		if (dev->of_offset == node) {
@@ -283,6 +674,7 @@ static int uclass_find_device_by_phandle(enum uclass_id id,
 					 const char *name,
 					 struct udevice **devp)
 {
+	struct of_live *live = of_live_get(gd->fdt_blob);
 	struct udevice *dev;
 	struct uclass *uc;
 	int find_phandle;
@@ -293,6 +685,11 @@ static int uclass_find_device_by_phandle(enum uclass_id id,
 				      -1);
 	if (find_phandle <= 0)
 		return -ENOENT;
+	if (live) {
+		return uclass_find_device_by_of_offset(id,
+				of_live_node_by_phandle(live, find_phandle),
+				devp);
+	}
 	ret = uclass_get(id, &uc);
 	if (ret)
 		return ret;
@@ -419,6 +816,7 @@ int uclass_bind_device(struct udevice *dev)
 
 	uc = dev->uclass;
 	list_add_tail(&dev->uclass_node, &uc->dev_head);
+	uclass_index_add(dev);
 
 	if (dev->parent) {
 		struct uclass_driver *uc_drv = dev->parent->uclass->uc_drv;
@@ -433,6 +831,7 @@ int uclass_bind_device(struct udevice *dev)
 	return 0;
 err:
 	/* There is no need to undo the parent's post_bind call */
+	uclass_index_remove(dev);
 	list_del(&dev->uclass_node);
 
 	return ret;
@@ -451,6 +850,7 @@ int uclass_unbind_device(struct udevice *dev)
 			return ret;
 	}
 
+	uclass_index_remove(dev);
 	list_del(&dev->uclass_node);
 	return 0;
 }
@@ -463,8 +863,9 @@ int uclass_resolve_seq(struct udevice *dev)
 	int ret;
 
 	assert(dev->seq == -1);
-	ret = uclass_find_device_by_seq(dev->uclass->uc_drv->id, dev->req_seq,
-					false, &dup);
+	ret = -ENODEV;
+	if (dev->req_seq != -1)
+		ret = uclass_find_seq(dev->uclass, dev->req_seq, false, &dup);
 	if (!ret) {
 		dm_warn("Device '%s': seq %d is in use by '%s'\n",
 			dev->name, dev->req_seq, dup->name);
@@ -477,8 +878,7 @@ int uclass_resolve_seq(struct udevice *dev)
 	}
 
 	for (seq = 0; seq < DM_MAX_SEQ; seq++) {
-		ret = uclass_find_device_by_seq(dev->uclass->uc_drv->id, seq,
-						false, &dup);
+		ret = uclass_find_seq(dev->uclass, seq, false, &dup);
 		if (ret == -ENODEV)
 			break;
 		if (ret)
@@ -124,6 +124,7 @@ static int pinconfig_post_bind(struct udevice *dev)
 	const void *fdt = gd->fdt_blob;
 	int offset = dev->of_offset;
 	bool pre_reloc_only = !(gd->flags & GD_FLG_RELOC);
+	struct udevice *child;
 	const char *name;
 	int ret;
 
@@ -133,6 +134,10 @@ static int pinconfig_post_bind(struct udevice *dev)
 		if (pre_reloc_only &&
 		    !fdt_getprop(fdt, offset, "u-boot,dm-pre-reloc", NULL))
 			continue;
+		/* Skip nodes bound before relocation, if they were kept */
+		if ((dev->flags & DM_FLAG_PRE_RELOC_CHILDREN) &&
+		    !device_find_child_by_of_offset(dev, offset, &child))
+			continue;
 		/*
 		 * If this node has "compatible" property, this is not
 		 * a pin configuration node, but a normal device. skip.
@@ -152,6 +157,8 @@ static int pinconfig_post_bind(struct udevice *dev)
 		if (ret)
 			return ret;
 	}
+	if (pre_reloc_only)
+		dev->flags |= DM_FLAG_PRE_RELOC_CHILDREN;
 
 	return 0;
 }
@@ -287,5 +294,6 @@ static int pinctrl_post_bind(struct udevice *dev)
 UCLASS_DRIVER(pinctrl) = {
 	.id = UCLASS_PINCTRL,
 	.post_bind = pinctrl_post_bind,
+	.bind_uclass = UCLASS_PINCONFIG,
 	.name = "pinctrl",
 };
@@ -86,5 +86,6 @@ U_BOOT_DRIVER(pmic_act8846) = {
 	.id = UCLASS_PMIC,
 	.of_match = act8846_ids,
 	.bind = act8846_bind,
+	.bind_uclass = UCLASS_REGULATOR,
 	.ops = &act8846_ops,
 };
@@ -88,5 +88,6 @@ U_BOOT_DRIVER(pmic_max77686) = {
 	.id = UCLASS_PMIC,
 	.of_match = max77686_ids,
 	.bind = max77686_bind,
+	.bind_uclass = UCLASS_REGULATOR,
 	.ops = &max77686_ops,
 };
@@ -92,5 +92,6 @@ U_BOOT_DRIVER(pmic_pfuze100) = {
 	.id = UCLASS_PMIC,
 	.of_match = pfuze100_ids,
 	.bind = pfuze100_bind,
+	.bind_uclass = UCLASS_REGULATOR,
 	.ops = &pfuze100_ops,
 };
@@ -97,6 +97,7 @@ U_BOOT_DRIVER(pmic_rk808) = {
 	.of_match = rk808_ids,
 #if CONFIG_IS_ENABLED(PMIC_CHILDREN)
 	.bind = rk808_bind,
+	.bind_uclass = UCLASS_REGULATOR,
 #endif
 	.ops = &rk808_ops,
 };
@@ -91,5 +91,6 @@ U_BOOT_DRIVER(pmic_s5m8767) = {
 	.id = UCLASS_PMIC,
 	.of_match = s5m8767_ids,
 	.bind = s5m8767_bind,
+	.bind_uclass = UCLASS_REGULATOR,
 	.ops = &s5m8767_ops,
 };
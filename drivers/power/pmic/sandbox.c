@@ -75,5 +75,6 @@ U_BOOT_DRIVER(sandbox_pmic) = {
 	.id = UCLASS_PMIC,
 	.of_match = sandbox_pmic_ids,
 	.bind = sandbox_pmic_bind,
+	.bind_uclass = UCLASS_REGULATOR,
 	.ops = &sandbox_pmic_ops,
 };
@@ -90,5 +90,6 @@ U_BOOT_DRIVER(pmic_tps65090) = {
 	.id = UCLASS_PMIC,
 	.of_match = tps65090_ids,
 	.bind = tps65090_bind,
+	.bind_uclass = UCLASS_REGULATOR,
 	.ops = &tps65090_ops,
 };
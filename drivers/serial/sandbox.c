@@ -19,6 +19,7 @@
 #include <video.h>
 #include <linux/compiler.h>
 #include <asm/state.h>
+#include <asm/test.h>
 
 DECLARE_GLOBAL_DATA_PTR;
 
@@ -41,6 +42,7 @@ struct sandbox_serial_platdata {
 
 struct sandbox_serial_priv {
 	bool start_of_line;
+	int tx_space;	/* Characters puts() can take, -1 for no limit */
 };
 
 /**
@@ -69,6 +71,7 @@ static int sandbox_serial_probe(struct udevice *dev)
 	if (state->term_raw != STATE_TERM_COOKED)
 		os_tty_raw(0, state->term_raw == STATE_TERM_RAW_WITH_SIGS);
 	priv->start_of_line = 0;
+	priv->tx_space = -1;
 
 	return 0;
 }
@@ -100,6 +103,43 @@ static int sandbox_serial_putc(struct udevice *dev, const char ch)
 	return 0;
 }
 
+static int sandbox_serial_puts(struct udevice *dev, const char *s, int len)
+{
+	struct sandbox_serial_priv *priv = dev_get_priv(dev);
+	struct sandbox_serial_platdata *plat = dev->platdata;
+	const char *end;
+	int count;
+
+	if (priv->tx_space >= 0) {
+		if (!priv->tx_space)
+			return -EAGAIN;
+		len = min(len, priv->tx_space);
+		priv->tx_space -= len;
+	}
+
+	/* Write up to the end of each line, so the colour can be set */
+	for (count = 0; count < len; count += end - s, s = end) {
+		if (priv->start_of_line && plat->colour != -1) {
+			priv->start_of_line = false;
+			output_ansi_colour(plat->colour);
+		}
+		end = memchr(s, '\n', len - count);
+		end = end ? end + 1 : s + len - count;
+		os_write(1, s, end - s);
+		if (end[-1] == '\n')
+			priv->start_of_line = true;
+	}
+
+	return len;
+}
+
+void sandbox_serial_set_tx_space(struct udevice *dev, int space)
+{
+	struct sandbox_serial_priv *priv = dev_get_priv(dev);
+
+	priv->tx_space = space;
+}
+
 static unsigned int increment_buffer_index(unsigned int index)
 {
 	return (index + 1) % ARRAY_SIZE(serial_buf);
@@ -166,6 +206,7 @@ static int sandbox_serial_ofdata_to_platdata(struct udevice *dev)
 
 static const struct dm_serial_ops sandbox_serial_ops = {
 	.putc = sandbox_serial_putc,
+	.puts = sandbox_serial_puts,
 	.pending = sandbox_serial_pending,
 	.getc = sandbox_serial_getc,
 };
@@ -185,7 +226,7 @@ U_BOOT_DRIVER(serial_sandbox) = {
 	.probe = sandbox_serial_probe,
 	.remove = sandbox_serial_remove,
 	.ops	= &sandbox_serial_ops,
-	.flags = DM_FLAG_PRE_RELOC,
+	.flags = DM_FLAG_PRE_RELOC | DM_FLAG_KEEP_PROBED,
 };
 
 static const struct sandbox_serial_platdata platdata_non_fdt = {
@@ -9,6 +9,7 @@
 #include <environment.h>
 #include <errno.h>
 #include <fdtdec.h>
+#include <malloc.h>
 #include <os.h>
 #include <serial.h>
 #include <stdio_dev.h>
@@ -118,11 +119,160 @@ void serial_initialize(void)
 	serial_find_console_or_panic();
 }
 
+/* Write characters, waiting until the device has taken all of them */
+static void serial_write(struct udevice *dev, const char *s, int len)
+{
+	struct dm_serial_ops *ops = serial_get_ops(dev);
+	int ret;
+
+	while (len > 0) {
+		ret = ops->puts(dev, s, len);
+		if (ret == -EAGAIN)
+			continue;
+		if (ret <= 0)
+			break;
+		s += ret;
+		len -= ret;
+	}
+}
+
+#if defined(CONFIG_SERIAL_TX_BUFFER) && !defined(CONFIG_SPL_BUILD)
+/* Devices which have output waiting in their buffer */
+static LIST_HEAD(serial_tx_list);
+
+/* Check whether output should be buffered, setting up the buffer if needed */
+static bool serial_tx_ready(struct udevice *dev)
+{
+	struct serial_dev_priv *upriv = dev_get_uclass_priv(dev);
+
+	if (upriv->tx_buf.start)
+		return true;
+	if (upriv->tx_off || !(gd->flags & GD_FLG_FULL_MALLOC_INIT))
+		return false;
+	if (!serial_get_ops(dev)->puts ||
+	    membuff_new(&upriv->tx_buf, CONFIG_SERIAL_TX_BUFFER_SIZE)) {
+		upriv->tx_off = true;
+		return false;
+	}
+	upriv->tx_dev = dev;
+	INIT_LIST_HEAD(&upriv->tx_node);
+
+	return true;
+}
+
+/**
+ * serial_tx_drain() - Send as much buffered output as the device will take
+ *
+ * If the device reports an error, the buffered output is discarded.
+ *
+ * @dev:	Serial device
+ * @return 0 if the buffer is now empty (or there is none), -EAGAIN if the
+ * device is busy, -EBUSY if the buffer is already being drained
+ */
+static int serial_tx_drain(struct udevice *dev)
+{
+	struct serial_dev_priv *upriv = dev_get_uclass_priv(dev);
+	struct dm_serial_ops *ops = serial_get_ops(dev);
+	char *data;
+	int len, ret;
+
+	if (!upriv->tx_buf.start)
+		return 0;
+	if (upriv->tx_busy)
+		return -EBUSY;
+	upriv->tx_busy = true;
+	while ((len = membuff_getraw(&upriv->tx_buf, -1, false, &data))) {
+		ret = ops->puts(dev, data, len);
+		if (ret == -EAGAIN || !ret)
+			break;
+		if (ret < 0)
+			membuff_purge(&upriv->tx_buf);
+		else
+			membuff_getraw(&upriv->tx_buf, ret, true, &data);
+	}
+	upriv->tx_busy = false;
+	if (len)
+		return -EAGAIN;
+	list_del_init(&upriv->tx_node);
+
+	return 0;
+}
+
+/* Add output to the buffer, waiting for space if it is full */
+static void serial_tx_put(struct udevice *dev, const char *s, int len)
+{
+	struct serial_dev_priv *upriv = dev_get_uclass_priv(dev);
+	int ret;
+
+	while (len > 0) {
+		ret = membuff_put(&upriv->tx_buf, s, len);
+		s += ret;
+		len -= ret;
+		if (ret && list_empty(&upriv->tx_node))
+			list_add_tail(&upriv->tx_node, &serial_tx_list);
+		if (serial_tx_drain(dev) == -EBUSY && len) {
+			/* Output from the driver itself while it is draining */
+			serial_write(dev, s, len);
+			break;
+		}
+		if (len)
+			WATCHDOG_RESET();
+	}
+}
+
+/* Send buffered output without waiting, if there is any */
+static void serial_tx_poll_dev(struct udevice *dev)
+{
+	struct serial_dev_priv *upriv = dev_get_uclass_priv(dev);
+
+	if (upriv->tx_buf.start && !membuff_isempty(&upriv->tx_buf))
+		serial_tx_drain(dev);
+}
+
+void serial_poll_tx(void)
+{
+	static bool polling;
+	struct serial_dev_priv *upriv, *next;
+
+	if (polling)
+		return;
+	polling = true;
+	list_for_each_entry_safe(upriv, next, &serial_tx_list, tx_node)
+		serial_tx_drain(upriv->tx_dev);
+	polling = false;
+}
+#else
+static inline bool serial_tx_ready(struct udevice *dev)
+{
+	return false;
+}
+
+static inline int serial_tx_drain(struct udevice *dev)
+{
+	return 0;
+}
+
+static inline void serial_tx_put(struct udevice *dev, const char *s, int len)
+{
+}
+
+static inline void serial_tx_poll_dev(struct udevice *dev)
+{
+}
+#endif
+
 static void _serial_putc(struct udevice *dev, char ch)
 {
 	struct dm_serial_ops *ops = serial_get_ops(dev);
 	int err;
 
+	if (serial_tx_ready(dev)) {
+		if (ch == '\n')
+			serial_tx_put(dev, "\n\r", 2);
+		else
+			serial_tx_put(dev, &ch, 1);
+		return;
+	}
 	do {
 		err = ops->putc(dev, ch);
 	} while (err == -EAGAIN);
@@ -132,8 +282,38 @@ static void _serial_putc(struct udevice *dev, char ch)
 
 static void _serial_puts(struct udevice *dev, const char *str)
 {
-	while (*str)
-		_serial_putc(dev, *str++);
+	void (*write)(struct udevice *dev, const char *s, int len);
+	const char *end;
+	int len;
+
+	if (!serial_get_ops(dev)->puts) {
+		while (*str)
+			_serial_putc(dev, *str++);
+		return;
+	}
+
+	/* Send each line in one go, followed by the carriage return */
+	write = serial_tx_ready(dev) ? serial_tx_put : serial_write;
+	while (*str) {
+		end = strchr(str, '\n');
+		len = end ? end - str + 1 : strlen(str);
+		write(dev, str, len);
+		str += len;
+		if (str[-1] == '\n')
+			write(dev, "\r", 1);
+	}
+}
+
+static void _serial_flush(struct udevice *dev)
+{
+	struct dm_serial_ops *ops = serial_get_ops(dev);
+
+	while (serial_tx_drain(dev) == -EAGAIN)
+		WATCHDOG_RESET();
+	if (ops->pending) {
+		while (ops->pending(dev, false) > 0)
+			WATCHDOG_RESET();
+	}
 }
 
 static int _serial_getc(struct udevice *dev)
@@ -143,8 +323,10 @@ static int _serial_getc(struct udevice *dev)
 
 	do {
 		err = ops->getc(dev);
-		if (err == -EAGAIN)
+		if (err == -EAGAIN) {
+			serial_tx_poll_dev(dev);
 			WATCHDOG_RESET();
+		}
 	} while (err == -EAGAIN);
 
 	return err >= 0 ? err : 0;
@@ -154,6 +336,7 @@ static int _serial_tstc(struct udevice *dev)
 {
 	struct dm_serial_ops *ops = serial_get_ops(dev);
 
+	serial_tx_poll_dev(dev);
 	if (ops->pending)
 		return ops->pending(dev, true);
 
@@ -172,6 +355,12 @@ void serial_puts(const char *str)
 		_serial_puts(gd->cur_serial_dev, str);
 }
 
+void serial_flush(void)
+{
+	if (gd->cur_serial_dev)
+		_serial_flush(gd->cur_serial_dev);
+}
+
 int serial_getc(void)
 {
 	if (!gd->cur_serial_dev)
@@ -209,6 +398,11 @@ static void serial_stub_putc(struct stdio_dev *sdev, const char ch)
 {
 	_serial_putc(sdev->priv, ch);
 }
+
+static void serial_stub_flush(struct stdio_dev *sdev)
+{
+	_serial_flush(sdev->priv);
+}
 #endif
 
 void serial_stub_puts(struct stdio_dev *sdev, const char *str)
@@ -304,6 +498,8 @@ static int serial_post_probe(struct udevice *dev)
 		ops->getc += gd->reloc_off;
 	if (ops->putc)
 		ops->putc += gd->reloc_off;
+	if (ops->puts)
+		ops->puts += gd->reloc_off;
 	if (ops->pending)
 		ops->pending += gd->reloc_off;
 	if (ops->clear)
@@ -330,6 +526,7 @@ static int serial_post_probe(struct udevice *dev)
 	sdev.priv = dev;
 	sdev.putc = serial_stub_putc;
 	sdev.puts = serial_stub_puts;
+	sdev.flush = serial_stub_flush;
 	sdev.getc = serial_stub_getc;
 	sdev.tstc = serial_stub_tstc;
 	stdio_register_dev(&sdev, &upriv->sdev);
@@ -339,12 +536,21 @@ static int serial_post_probe(struct udevice *dev)
 
 static int serial_pre_remove(struct udevice *dev)
 {
-#ifdef CONFIG_SYS_STDIO_DEREGISTER
-	struct serial_dev_priv *upriv = dev_get_uclass_priv(dev);
+	struct serial_dev_priv *upriv __maybe_unused = dev_get_uclass_priv(dev);
 
+#ifdef CONFIG_SYS_STDIO_DEREGISTER
 	if (stdio_deregister_dev(upriv->sdev, 0))
 		return -EPERM;
 #endif
+	_serial_flush(dev);
+#if defined(CONFIG_SERIAL_TX_BUFFER) && !defined(CONFIG_SPL_BUILD)
+	if (upriv->tx_buf.start) {
+		list_del(&upriv->tx_node);
+		free(upriv->tx_buf.start);
+		membuff_uninit(&upriv->tx_buf);
+	}
+	upriv->tx_off = false;
+#endif
 
 	return 0;
 }
@@ -322,6 +322,22 @@ static int mxc_serial_putc(struct udevice *dev, const char ch)
 	return 0;
 }
 
+static int mxc_serial_puts(struct udevice *dev, const char *s, int len)
+{
+	struct mxc_serial_platdata *plat = dev->platdata;
+	struct mxc_uart *const uart = plat->reg;
+	int count;
+
+	/* Fill the FIFO rather than waiting for it to empty each time */
+	for (count = 0; count < len; count++) {
+		if (readl(&uart->ts) & UTS_TXFULL)
+			break;
+		writel(s[count], &uart->txd);
+	}
+
+	return count ? count : -EAGAIN;
+}
+
 static int mxc_serial_pending(struct udevice *dev, bool input)
 {
 	struct mxc_serial_platdata *plat = dev->platdata;
@@ -336,16 +352,39 @@ static int mxc_serial_pending(struct udevice *dev, bool input)
 
 static const struct dm_serial_ops mxc_serial_ops = {
 	.putc = mxc_serial_putc,
+	.puts = mxc_serial_puts,
 	.pending = mxc_serial_pending,
 	.getc = mxc_serial_getc,
 	.setbrg = mxc_serial_setbrg,
 };
 
+#if CONFIG_IS_ENABLED(OF_PLATDATA)
+static int mxc_serial_ofdata_to_platdata(struct udevice *dev)
+{
+	struct mxc_serial_platdata *plat = dev->platdata;
+
+	/* Generated by dtoc from the SPL device tree */
+	plat->reg = (struct mxc_uart *)(uintptr_t)plat->dtplat.reg[0];
+
+	return 0;
+}
+
+static const struct udevice_id mxc_serial_ids[] = {
+	{ .compatible = "fsl,imx21-uart" },
+	{ }
+};
+#endif
+
 U_BOOT_DRIVER(serial_mxc) = {
 	.name	= "serial_mxc",
 	.id	= UCLASS_SERIAL,
+#if CONFIG_IS_ENABLED(OF_PLATDATA)
+	.of_match = mxc_serial_ids,
+	.ofdata_to_platdata = mxc_serial_ofdata_to_platdata,
+	.platdata_auto_alloc_size = sizeof(struct mxc_serial_platdata),
+#endif
 	.probe = mxc_serial_probe,
 	.ops	= &mxc_serial_ops,
-	.flags = DM_FLAG_PRE_RELOC,
+	.flags = DM_FLAG_PRE_RELOC | DM_FLAG_KEEP_PROBED,
 };
 #endif
@@ -79,6 +79,11 @@ typedef struct global_data {
 	struct udevice	*dm_root;	/* Root instance for Driver Model */
 	struct udevice	*dm_root_f;	/* Pre-relocation root instance */
 	struct list_head uclass_root;	/* Head of core tree */
+	void *dm_compat_index;		/* Driver compatible-string index */
+	void *dm_pending;		/* Device tree nodes not yet bound */
+#endif
+#if CONFIG_IS_ENABLED(DM_TIMING)
+	ulong dm_timing_nested;		/* Total bind/probe time recorded */
 #endif
 #ifdef CONFIG_TIMER
 	struct udevice	*timer;	/* Timer instance for Driver Model */
@@ -87,6 +92,9 @@ typedef struct global_data {
 	const void *fdt_blob;	/* Our device tree, NULL if none */
 	void *new_fdt;		/* Relocated FDT */
 	unsigned long fdt_size;	/* Space reserved for relocated FDT */
+#ifdef CONFIG_OF_LIVE
+	void *of_live;		/* Live tree built from fdt_blob */
+#endif
 	struct jt_funcs *jt;		/* jump table */
 	char env_buf[32];	/* buffer for getenv() before reloc. */
 #ifdef CONFIG_TRACE
@@ -104,6 +112,15 @@ typedef struct global_data {
 	unsigned long malloc_base;	/* base address of early malloc() */
 	unsigned long malloc_limit;	/* limit address */
 	unsigned long malloc_ptr;	/* current address */
+#if defined(CONFIG_SYS_MALLOC_F_POOL)
+	struct malloc_f_pool *malloc_f_pool;	/* see malloc_simple.c */
+#endif
+#if defined(CONFIG_MALLOC_TRACE_F_COUNT)
+	/* Callers and sizes of early allocations, see malloc_trace.c */
+	unsigned long malloc_trace_f_caller[CONFIG_MALLOC_TRACE_F_COUNT];
+	unsigned long malloc_trace_f_size[CONFIG_MALLOC_TRACE_F_COUNT];
+	unsigned int malloc_trace_f_count;	/* early calls made */
+#endif
 #endif
 #ifdef CONFIG_PCI
 	struct pci_controller *hose;	/* PCI hose for early use */
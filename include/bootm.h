@@ -41,7 +41,19 @@ void lynxkdi_boot(image_header_t *hdr);
 
 boot_os_fn *bootm_os_get_boot_func(int os);
 
-int bootm_host_load_images(const void *fit, int cfg_noffset);
+/**
+ * bootm_host_load_images() - check that the images of a FIT can be loaded
+ *
+ * This loads and decompresses the kernel, FDT and ramdisk of a
+ * configuration on the host, as a sanity check for fit_check_sign.
+ *
+ * @fit:	FIT to check
+ * @cfg_noffset: Offset of the configuration node to use
+ * @verify:	1 to verify the configuration and image hashes/signatures
+ *		as they are loaded, 0 if the caller has already done this
+ * @return 0 if ok, -ve on error
+ */
+int bootm_host_load_images(const void *fit, int cfg_noffset, int verify);
 
 int boot_selected_os(int argc, char * const argv[], int state,
 		     bootm_headers_t *images, boot_os_fn *boot_fn);
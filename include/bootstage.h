@@ -20,6 +20,7 @@
 enum bootstage_flags {
 	BOOTSTAGEF_ERROR	= 1 << 0,	/* Error record */
 	BOOTSTAGEF_ALLOC	= 1 << 1,	/* Allocate an id */
+	BOOTSTAGEF_ACCUM	= 1 << 2,	/* Record holds a duration */
 };
 
 /* bootstate sub-IDs used for kernel and ramdisk ranges */
@@ -298,6 +299,19 @@ uint32_t bootstage_start(enum bootstage_id id, const char *name);
  */
 uint32_t bootstage_accum(enum bootstage_id id);
 
+/**
+ * Record the time taken by a one-off activity
+ *
+ * This allocates a new record (as with BOOTSTAGE_ID_ALLOC) which holds the
+ * time since @start_us. It is reported along with the accumulators.
+ *
+ * @param name		Textual name to display in the report
+ * @param start_us	Time when the activity started, from
+ *			timer_get_boot_us()
+ * @return time taken in microseconds
+ */
+uint32_t bootstage_add_duration(const char *name, uint32_t start_us);
+
 /* Print a report about boot time */
 void bootstage_report(void);
 
@@ -308,6 +322,22 @@ void bootstage_report(void);
  */
 int bootstage_fdt_add_report(void);
 
+/**
+ * Write bootstage information as a Chrome trace
+ *
+ * This writes JSON in the Chrome trace-event format, which can be loaded
+ * into chrome://tracing or Perfetto. Boot stages and durations (such as
+ * initcalls) appear as nested events on separate tracks. Times use the
+ * same base as the function trace, so proftool can merge the two.
+ *
+ * @param buff		Buffer in which to place the JSON
+ * @param buff_size	Size of buffer
+ * @param needed	Returns number of bytes used / needed
+ * @return 0 if ok, -ENOSPC if the buffer is too small, -ENOMEM if out of
+ * memory
+ */
+int bootstage_chrome_trace(void *buff, int buff_size, unsigned int *needed);
+
 /*
  * Stash bootstage data into memory
  *
@@ -380,6 +410,19 @@ static inline uint32_t bootstage_accum(enum bootstage_id id)
 	return 0;
 }
 
+static inline uint32_t bootstage_add_duration(const char *name,
+					      uint32_t start_us)
+{
+	return 0;
+}
+
+static inline int bootstage_chrome_trace(void *buff, int buff_size,
+					 unsigned int *needed)
+{
+	*needed = 0;
+	return 0;	/* Pretend to succeed */
+}
+
 static inline int bootstage_stash(void *base, int size)
 {
 	return 0;	/* Pretend to succeed */
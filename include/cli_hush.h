@@ -21,6 +21,18 @@ int set_local_var(const char *s, int flg_export);
 void unset_local_var(const char *name);
 char *get_local_var(const char *s);
 
+#ifdef CONFIG_HUSH_PARSE_CACHE
+/**
+ * hush_cache_enable() - Enable or disable the cache of parsed scripts
+ *
+ * @enable:	true to enable the cache, false to disable it and free the
+ *		scripts in it
+ */
+void hush_cache_enable(bool enable);
+#else
+static inline void hush_cache_enable(bool enable) {}
+#endif
+
 #if defined(CONFIG_HUSH_INIT_VAR)
 extern int hush_init_var (void);
 #endif
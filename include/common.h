@@ -865,11 +865,13 @@ int	tstc(void);
 #if defined(CONFIG_SPL_BUILD) && !defined(CONFIG_SPL_SERIAL_SUPPORT)
 #define	putc(...) do { } while (0)
 #define puts(...) do { } while (0)
+#define flush(...) do { } while (0)
 #define printf(...) do { } while (0)
 #define vprintf(...) do { } while (0)
 #else
 void	putc(const char c);
 void	puts(const char *s);
+void	flush(void);
 int	printf(const char *fmt, ...)
 		__attribute__ ((format (__printf__, 1, 2)));
 int	vprintf(const char *fmt, va_list args);
@@ -892,6 +894,7 @@ int	fprintf(int file, const char *fmt, ...)
 		__attribute__ ((format (__printf__, 2, 3)));
 void	fputs(int file, const char *s);
 void	fputc(int file, const char c);
+void	fflush(int file);
 int	ftstc(int file);
 int	fgetc(int file);
 
@@ -13,6 +13,7 @@
 #define CONFIG_TRACE_EARLY_SIZE		(8 << 20)
 #define CONFIG_TRACE_EARLY
 #define CONFIG_TRACE_EARLY_ADDR		0x00100000
+#define CONFIG_TRACE_FUNC_TIME
 
 #endif
 
@@ -63,6 +64,7 @@
 #define CONFIG_SYS_MALLOC_LEN		(32 << 20)	/* 32MB  */
 
 #define CONFIG_SYS_HUSH_PARSER
+#define CONFIG_HUSH_PARSE_CACHE
 #define CONFIG_SYS_LONGHELP			/* #undef to save memory */
 #define CONFIG_SYS_CBSIZE		1024	/* Console I/O Buffer Size */
 #define CONFIG_SILENT_CONSOLE
@@ -78,6 +80,7 @@
 
 #define CONFIG_ENV_SIZE		8192
 #define CONFIG_ENV_IS_NOWHERE
+#define CONFIG_ENV_LOG
 
 /* SPI - enable all SPI flash types for testing purposes */
 #define CONFIG_CMD_SF
@@ -9,6 +9,7 @@
 
 #include <dm/device.h>
 #include <dm/platdata.h>
+#include <dm/read.h>
 #include <dm/uclass.h>
 
 #endif
@@ -56,6 +56,42 @@ int device_bind_by_name(struct udevice *parent, bool pre_reloc_only,
  */
 int device_probe(struct udevice *dev);
 
+/**
+ * device_can_relocate() - Check whether device_relocate() can move a device
+ *
+ * Only data which driver model allocated from the auto_alloc sizes is
+ * copied. A device with any other platform or private data, e.g. from
+ * U_BOOT_DEVICE() or allocated by its bind() method, cannot be moved, since
+ * that data would be left in the pre-relocation image or malloc() area. It
+ * must be bound again instead.
+ *
+ * @old: Device bound before relocation
+ * @return true if the device can be moved
+ */
+bool device_can_relocate(struct udevice *old);
+
+/**
+ * device_relocate() - Move a device bound before relocation
+ *
+ * This creates a copy of a device from the pre-relocation driver model,
+ * with its platform data, and adds it to its uclass without binding it
+ * again. The device's children are not copied.
+ *
+ * If the device was probed, its driver has the DM_FLAG_KEEP_PROBED flag
+ * and @parent is active, the private data is copied too and the device
+ * stays probed. Only the uclass post_probe() method is called again, e.g.
+ * so that a serial port can register with stdio. Otherwise the device must
+ * be probed again before use.
+ *
+ * @parent: Parent of the new device (NULL for the root device)
+ * @old: Device to copy
+ * @devp: Returns the new device
+ * @return 0 if OK, -ENOENT if the driver cannot be found after relocation,
+ * -EPERM if device_can_relocate() fails, other -ve on error
+ */
+int device_relocate(struct udevice *parent, struct udevice *old,
+		    struct udevice **devp);
+
 /**
  * device_remove() - Remove a device, de-activating it
  *
@@ -139,4 +175,59 @@ static inline void devres_release_all(struct udevice *dev)
 }
 
 #endif /* ! CONFIG_DEVRES */
+
+/**
+ * struct dm_timing - state for timing a bind or probe
+ *
+ * @start:	Time when the operation started, in microseconds, or 0 if
+ *		the timer was not available
+ * @nested:	Value of gd->dm_timing_nested when the operation started
+ */
+struct dm_timing {
+	ulong start;
+	ulong nested;
+};
+
+#if CONFIG_IS_ENABLED(DM_TIMING)
+/**
+ * dm_timing_start() - Start timing a bind or probe
+ *
+ * @tm:		Timing state to set up
+ */
+void dm_timing_start(struct dm_timing *tm);
+
+/**
+ * dm_timing_bound() - Record the time taken to bind a device
+ *
+ * Sets dev->bind_time to the time since dm_timing_start(), less the time
+ * spent binding and probing other devices in the meantime.
+ *
+ * @dev:	Device which was bound
+ * @tm:		Timing state from dm_timing_start()
+ */
+void dm_timing_bound(struct udevice *dev, struct dm_timing *tm);
+
+/**
+ * dm_timing_probed() - Record the time taken to probe a device
+ *
+ * This is the same as dm_timing_bound() but sets dev->probe_time.
+ *
+ * @dev:	Device which was probed
+ * @tm:		Timing state from dm_timing_start()
+ */
+void dm_timing_probed(struct udevice *dev, struct dm_timing *tm);
+#else
+static inline void dm_timing_start(struct dm_timing *tm)
+{
+}
+
+static inline void dm_timing_bound(struct udevice *dev, struct dm_timing *tm)
+{
+}
+
+static inline void dm_timing_probed(struct udevice *dev, struct dm_timing *tm)
+{
+}
+#endif
+
 #endif
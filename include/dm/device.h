@@ -41,6 +41,21 @@ struct driver_info;
 /* Device is bound */
 #define DM_FLAG_BOUND			(1 << 6)
 
+/* Device was bound before relocation and kept afterwards */
+#define DM_FLAG_RELOCATED		(1 << 7)
+
+/* Only the children needed before relocation have been bound */
+#define DM_FLAG_PRE_RELOC_CHILDREN	(1 << 8)
+
+/* Driver's devices can stay probed across relocation */
+#define DM_FLAG_KEEP_PROBED		(1 << 9)
+
+/* Device's platform data was generated from the device tree by dtoc */
+#define DM_FLAG_OF_PLATDATA		(1 << 10)
+
+/* Device name was allocated and is freed when the device is unbound */
+#define DM_FLAG_NAME_ALLOCED		(1 << 11)
+
 /**
  * struct udevice - 一个驱动程序的实例
  *
@@ -73,6 +88,12 @@ struct driver_info;
  * @seq: 该设备的分配序号（-1 = 无）。当设备被探测时，这会被设置，并且将在设备的 uclass 中是唯一的。
  * @devres_head: 与此设备相关联的内存分配列表。
  *   当启用 CONFIG_DEVRES 时，devm_kmalloc() 等将添加到此列表中。这样分配的内存将在设备被移除 / 解绑时自动释放。
+ * @name_next: Next device in the same bucket of the uclass's name hash table
+ * @node_next: Next device in the same bucket of the uclass's node hash table
+ * @bind_time: Time taken to bind this device in microseconds, excluding
+ *	other devices bound or probed meanwhile (see CONFIG_DM_TIMING)
+ * @probe_time: Time taken by the last probe of this device in microseconds,
+ *	excluding its parents and other devices probed meanwhile
  */
 struct udevice {
     const struct driver *driver;        /**< 该设备使用的驱动程序 */
@@ -96,6 +117,14 @@ struct udevice {
 #ifdef CONFIG_DEVRES
     struct list_head devres_head;
 #endif
+#if CONFIG_IS_ENABLED(DM_UCLASS_INDEX)
+    struct udevice *name_next;          /**< Next device in the name hash bucket */
+    struct udevice *node_next;          /**< Next device in the node hash bucket */
+#endif
+#if CONFIG_IS_ENABLED(DM_TIMING)
+    uint bind_time;                     /**< Time taken to bind (us) */
+    uint probe_time;                    /**< Time taken to probe (us) */
+#endif
 };
 
 /* Maximum sequence number supported */
@@ -154,6 +183,9 @@ struct udevice_id {
  *   如果非零，则这是该数据的大小，要分配到子设备的 parent_platdata 指针中。
  * @ops: 驱动程序特定的操作。这通常是由驱动程序定义的函数指针列表，用于实现 uclass 所需的驱动程序功能。
  * @flags: 驱动程序标志 - 请参阅 DM_FLAGS_...
+ * @bind_uclass: Uclass of the devices which @bind binds by name, if not @id
+ *	(UCLASS_ROOT if none). CONFIG_DM_LAZY_BIND uses this to tell which
+ *	uclasses a device tree node can provide.
  */
 struct driver {
 	char *name;
@@ -173,6 +205,7 @@ struct driver {
 	int per_child_platdata_auto_alloc_size;
 	const void *ops;	/* driver-specific operations */
 	uint32_t flags;
+	enum uclass_id bind_uclass;
 };
 
 /* Declare a new U-Boot driver */
@@ -44,6 +44,42 @@ struct uclass_driver *lists_uclass_lookup(enum uclass_id id);
  */
 int lists_bind_drivers(struct udevice *parent, bool pre_reloc_only);
 
+/**
+ * lists_driver_lookup_compat() - find the driver for a compatible string
+ *
+ * After relocation this uses an index of the compatible strings of all
+ * drivers, built on first use, so a lookup takes a handful of string
+ * comparisons. If there are several drivers for the same string, the
+ * first one in the linker list is returned.
+ *
+ * @compat:	Compatible string to look up
+ * @use_index:	true to use the index if available, false to always search
+ *		the of_match tables of all drivers (used for testing)
+ * @drvp:	Returns the driver
+ * @of_idp:	Returns the matching entry in the driver's of_match table
+ * @return 0 if found, -ENOENT if no driver supports this string
+ */
+int lists_driver_lookup_compat(const char *compat, bool use_index,
+			       struct driver **drvp,
+			       const struct udevice_id **of_idp);
+
+/**
+ * lists_driver_lookup_fdt() - find the driver for a device tree node
+ *
+ * The node's compatible strings are tried in order and the first one which
+ * is supported by a driver is used.
+ *
+ * @blob:	Device tree blob
+ * @offset:	Offset of the node
+ * @drvp:	Returns the driver
+ * @of_idp:	Returns the matching entry in the driver's of_match table
+ * @return 0 if found, -ENOENT if no driver supports the node, -ENODEV if it
+ * has no compatible string, -EINVAL if the device tree is invalid
+ */
+int lists_driver_lookup_fdt(const void *blob, int offset,
+			    struct driver **drvp,
+			    const struct udevice_id **of_idp);
+
 /**
  * lists_bind_fdt() - 绑定一个设备树节点
  *
@@ -20,10 +20,19 @@
  *
  * @name: 驱动程序名称
  * @platdata: 驱动程序特定的平台数据
+ * @platdata_size: Size of @platdata (only with of-platdata)
+ * @compat: Compatible strings of the device tree node which this entry was
+ *	generated from, each nul-terminated and ending with an empty string,
+ *	or NULL if @name is the driver name. When set, @name is the node name
+ *	and the driver is found by compatible string (only with of-platdata)
  */
 struct driver_info {
 	const char *name;
 	const void *platdata;
+#if CONFIG_IS_ENABLED(OF_PLATDATA)
+	uint platdata_size;
+	const char *compat;
+#endif
 };
 
 /**
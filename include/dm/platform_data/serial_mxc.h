@@ -6,8 +6,13 @@
 #ifndef __serial_mxc_h
 #define __serial_mxc_h
 
+#include <dt-structs.h>
+
 /* Information about a serial port */
 struct mxc_serial_platdata {
+#if CONFIG_IS_ENABLED(OF_PLATDATA)
+	struct dtd_fsl_imx21_uart dtplat;	/* must be first, see of-plat.txt */
+#endif
 	struct mxc_uart *reg;  /* address of registers in physical memory */
 };
 
@@ -0,0 +1,94 @@
+/*
+ * Functions for reading device properties from the device tree
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#ifndef _DM_READ_H
+#define _DM_READ_H
+
+#include <linux/types.h>
+
+struct udevice;
+
+/*
+ * These read from the device's node in the control device tree. They use
+ * the live tree if there is one (see CONFIG_OF_LIVE) and the flattened tree
+ * otherwise, so drivers do not need to care which is in use.
+ */
+
+/**
+ * dev_read_prop() - Read a property from a device's node
+ *
+ * @dev:	Device to read from
+ * @propname:	Name of the property
+ * @lenp:	If non-NULL, returns the property length in bytes, or a
+ *		-ve FDT error if the property is not found
+ * @return property value, or NULL if not found
+ */
+const void *dev_read_prop(struct udevice *dev, const char *propname,
+			  int *lenp);
+
+/**
+ * dev_read_u32_default() - Read a 32-bit integer from a device's node
+ *
+ * @dev:	Device to read from
+ * @propname:	Name of the property
+ * @def:	Value to return if the property is missing or too short
+ * @return the property value, or @def
+ */
+int dev_read_u32_default(struct udevice *dev, const char *propname, int def);
+
+/**
+ * dev_read_u32_array() - Read an array of 32-bit integers
+ *
+ * @dev:	Device to read from
+ * @propname:	Name of the property
+ * @out:	Returns the values, in CPU byte order
+ * @count:	Number of values to read
+ * @return 0 if OK, -FDT_ERR_NOTFOUND if the property is missing, or
+ * -FDT_ERR_BADLAYOUT if it holds fewer than @count values
+ */
+int dev_read_u32_array(struct udevice *dev, const char *propname, u32 *out,
+		       int count);
+
+/**
+ * dev_read_string() - Read a string from a device's node
+ *
+ * @dev:	Device to read from
+ * @propname:	Name of the property
+ * @return the string, or NULL if the property is missing
+ */
+const char *dev_read_string(struct udevice *dev, const char *propname);
+
+/**
+ * dev_read_bool() - Check whether a device's node has a property
+ *
+ * @dev:	Device to read from
+ * @propname:	Name of the property
+ * @return true if the property exists
+ */
+bool dev_read_bool(struct udevice *dev, const char *propname);
+
+/**
+ * dev_read_phandle() - Find the node which a phandle property refers to
+ *
+ * @dev:	Device to read from
+ * @propname:	Name of the property holding the phandle
+ * @return offset of the node referred to, or a -ve FDT error if the
+ * property or the node is missing
+ */
+int dev_read_phandle(struct udevice *dev, const char *propname);
+
+/**
+ * dev_read_alias_seq() - Get a device's sequence number from its alias
+ *
+ * The alias is named after the device's uclass, e.g. "serial0".
+ *
+ * @dev:	Device to look up
+ * @seqp:	Returns the sequence number
+ * @return 0 if OK, -ENOENT if the device has no alias
+ */
+int dev_read_alias_seq(struct udevice *dev, int *seqp);
+
+#endif
@@ -10,6 +10,8 @@
 #ifndef _DM_ROOT_H_
 #define _DM_ROOT_H_
 
+#include <dm/uclass-id.h>
+
 struct udevice;
 
 /**
@@ -61,6 +63,74 @@ int dm_scan_fdt(const void *blob, bool pre_reloc_only);
 int dm_scan_fdt_node(struct udevice *parent, const void *blob, int offset,
 		     bool pre_reloc_only);
 
+#if CONFIG_IS_ENABLED(DM_LAZY_BIND)
+/**
+ * dm_scan_fdt_lazy() - Record the device tree nodes to bind later
+ *
+ * This is an alternative to dm_scan_fdt() which does not bind anything.
+ * Instead it records each enabled top-level node which has a driver, along
+ * with the uclasses of the drivers in its subtree. The nodes are bound by
+ * dm_bind_pending() when a device in one of those uclasses is looked up.
+ *
+ * A driver which binds devices by name (rather than from their compatible
+ * strings) in another uclass must give that uclass in its bind_uclass
+ * member. Otherwise only uclass_find_device_by_name() finds those devices,
+ * by binding all remaining nodes when it misses, until the node is bound
+ * for some other reason. The dm_test_fdt_lazy_bind_uclass test checks
+ * this for the sandbox drivers.
+ *
+ * @blob: Pointer to device tree blob
+ * @return 0 if OK, -ve on error
+ */
+int dm_scan_fdt_lazy(const void *blob);
+
+/**
+ * dm_bind_pending() - Bind the recorded nodes which may provide a uclass
+ *
+ * This is called by uclass_get(), so that lookups see the same devices as
+ * after a full scan. Devices are inserted into their parent and uclass in
+ * device tree order, as if they had been bound by dm_scan_fdt().
+ *
+ * @id: Uclass which is needed
+ * @return 0 if OK, -ve on error
+ */
+int dm_bind_pending(enum uclass_id id);
+
+/**
+ * dm_bind_pending_all() - Bind all recorded nodes
+ *
+ * @return 0 if OK, -ve on error
+ */
+int dm_bind_pending_all(void);
+
+/**
+ * dm_has_pending() - Check whether any recorded nodes are not yet bound
+ *
+ * @return true if dm_bind_pending_all() would bind something
+ */
+bool dm_has_pending(void);
+#else
+static inline int dm_scan_fdt_lazy(const void *blob)
+{
+	return dm_scan_fdt(blob, false);
+}
+
+static inline int dm_bind_pending(enum uclass_id id)
+{
+	return 0;
+}
+
+static inline int dm_bind_pending_all(void)
+{
+	return 0;
+}
+
+static inline bool dm_has_pending(void)
+{
+	return false;
+}
+#endif
+
 /**
  * dm_scan_other() - Scan for other devices
  *
@@ -74,6 +144,24 @@ int dm_scan_fdt_node(struct udevice *parent, const void *blob, int offset,
  */
 int dm_scan_other(bool pre_reloc_only);
 
+/**
+ * dm_reloc_devices() - Move devices bound before relocation
+ *
+ * This moves the top-level devices of the pre-relocation driver model, and
+ * their children, into the driver model started by dm_init(), using
+ * device_relocate(). Devices whose child nodes were only scanned for
+ * pre-relocation devices have the rest of their children bound. The scans
+ * which follow skip anything which was moved. A top-level device is only
+ * moved if device_can_relocate() allows it and all of its children;
+ * otherwise the scans bind it again.
+ *
+ * @root_f: Root device of the pre-relocation driver model (may be NULL)
+ * @of_nodes: false to move the devices bound from platform data, true to
+ * move those bound from device tree nodes
+ * @return 0 if OK, -ve on error
+ */
+int dm_reloc_devices(struct udevice *root_f, bool of_nodes);
+
 /**
  * dm_init_and_scan() - Initialise Driver Model structures and scan for devices
  *
@@ -81,6 +169,9 @@ int dm_scan_other(bool pre_reloc_only);
  * then scans and binds available devices from platform data and the FDT.
  * This calls dm_init() to set up Driver Model structures.
  *
+ * With CONFIG_DM_KEEP_PRE_RELOC, if @pre_reloc_only is false the devices
+ * bound before relocation (gd->dm_root_f) are kept rather than bound again.
+ *
  * @pre_reloc_only: If true, bind only drivers with the DM_FLAG_PRE_RELOC
  * flag. If false bind all drivers.
  * @return 0 if OK, -ve on error
@@ -63,7 +63,10 @@ int uclass_find_next_device(struct udevice **devp);
 /**
  * uclass_find_device_by_name() - Find uclass device based on ID and name
  *
- * This searches for a device with the exactly given name.
+ * This searches for a device with the exactly given name. If there is
+ * none, the first device whose name starts with @name is returned. An exact
+ * match is preferred even if a device whose name only starts with @name
+ * comes before it in the uclass.
  *
  * The device is NOT probed, it is merely returned.
  *
@@ -102,7 +105,9 @@ int uclass_find_device_by_seq(enum uclass_id id, int seq_or_req_seq,
  * uclass_find_device_by_of_offset() - Find a uclass device by device tree node
  *
  * This searches the devices in the uclass for one attached to the given
- * device tree node.
+ * device tree node. A device's of_offset may be set after it is bound if
+ * it was bound without a node, but must not change from one node to
+ * another.
  *
  * The device is NOT probed, it is merely returned.
  *
@@ -175,6 +180,26 @@ int uclass_pre_remove_device(struct udevice *dev);
 static inline int uclass_pre_remove_device(struct udevice *dev) { return 0; }
 #endif
 
+/**
+ * uclass_set_seq() - Set the sequence number of a device
+ *
+ * This updates dev->seq and the uclass's lookup table for it.
+ *
+ * @dev:	Device to update
+ * @seq:	New sequence number, or -1 for none
+ */
+void uclass_set_seq(struct udevice *dev, int seq);
+
+/**
+ * uclass_set_name() - Set the name of a device
+ *
+ * This updates dev->name and the uclass's lookup table for it.
+ *
+ * @dev:	Device to update
+ * @name:	New name, which must remain valid while the device is bound
+ */
+void uclass_set_name(struct udevice *dev, const char *name);
+
 /**
  * uclass_find() - Find uclass by its id
  *
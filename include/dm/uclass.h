@@ -27,14 +27,51 @@
  * @uc_drv: 该 uclass 本身的驱动程序，不要与 'struct driver' 混淆
  * @dev_head: 此 uclass 中设备的列表（设备在调用其绑定方法时附加到其 uclass）
  * @sibling_node: uclass 链表中的下一个 uclass
+ * @seq_tab: Devices by sequence number, see struct uclass_seq_slot
+ * @seq_size: Number of entries in @seq_tab
+ * @name_hash: Hash table of devices by name, chained through name_next
+ * @node_hash: Hash table of devices by device tree offset, chained through
+ *	node_next
+ * @hash_size: Number of buckets in @name_hash and @node_hash (power of 2)
+ * @dev_count: Number of devices in the uclass
+ * @unindexed_nodes: Number of devices which were bound without a device
+ *	tree node, and so are not in @node_hash
+ * @no_index: true to ignore the lookup tables and walk @dev_head (set if
+ *	they could not be allocated)
  */
 struct uclass {
 	void *priv;
 	struct uclass_driver *uc_drv;
 	struct list_head dev_head;
 	struct list_head sibling_node;
+#if CONFIG_IS_ENABLED(DM_UCLASS_INDEX)
+	struct uclass_seq_slot *seq_tab;
+	int seq_size;
+	struct udevice **name_hash;
+	struct udevice **node_hash;
+	int hash_size;
+	int dev_count;
+	int unindexed_nodes;
+	bool no_index;
+#endif
+};
+
+/**
+ * struct uclass_seq_slot - devices with a particular sequence number
+ *
+ * Either pointer may be UCLASS_INDEX_DUP if more than one device has had
+ * this number, in which case a lookup must walk the uclass's device list.
+ *
+ * @dev:	Probed device with this sequence number (dev->seq)
+ * @req_dev:	Device which requested this sequence number (dev->req_seq)
+ */
+struct uclass_seq_slot {
+	struct udevice *dev;
+	struct udevice *req_dev;
 };
 
+#define UCLASS_INDEX_DUP	((struct udevice *)-1L)
+
 struct udevice;
 
 /* Members of this uclass sequence themselves with aliases */
@@ -68,6 +105,8 @@ struct udevice;
  * 如果驱动程序中的此成员为 0，则此值仅用作后备。
  * @ops: Uclass 操作，为 uclass 中的设备提供一致的接口。
  * @flags: 该 uclass 的标志（DM_UC_...）
+ * @bind_uclass: Uclass of the devices which @post_bind binds by name, if
+ *	not @id (UCLASS_ROOT if none), as for struct driver
  */
 struct uclass_driver {
 	const char *name;							// uclass 驱动程序的名称
@@ -94,6 +133,7 @@ struct uclass_driver {
 												// 如果驱动程序中的此成员为 0，则此值仅用作后备。
 	const void *ops;							// Uclass 操作，为 uclass 中的设备提供一致的接口。
 	uint32_t flags;								// 该 uclass 的标志（DM_UC_...）
+	enum uclass_id bind_uclass;
 };
 
 /* Declare a new uclass_driver */
@@ -127,7 +167,9 @@ int uclass_get_device(enum uclass_id id, int index, struct udevice **devp);
 /**
  * uclass_get_device_by_name() - 根据名称获取一个 uclass 设备
  *
- * 这将在 uclass 中搜索具有完全给定名称的设备。
+ * 这将在 uclass 中搜索具有完全给定名称的设备。如果没有，则返回第一个名称以
+ * @name 开头的设备。名称完全匹配的设备优先，即使另一个名称以 @name 开头的
+ * 设备在 uclass 中排在它前面。
  *
  * 设备将被探测以激活它以便准备使用。
  *
@@ -39,6 +39,28 @@ void dm_dump_all(void);
 /* Dump out a list of uclasses and their devices */
 void dm_dump_uclass(void);
 
+#if CONFIG_IS_ENABLED(DM_TIMING)
+/* Dump out the bind and probe time of each device, most expensive first */
+void dm_dump_time(void);
+
+/**
+ * dm_timing_fdt_report() - Add device bind/probe times to a device tree
+ *
+ * This adds a 'dm' subnode to @parent, with a subnode for each device that
+ * took any time, most expensive first. Each has 'name', 'uclass', 'bind'
+ * and 'probe' properties, the last two in microseconds.
+ *
+ * @blob:	Device tree to update
+ * @parent:	Offset of the node to add to (normally /bootstage)
+ * @return 0 if OK, -ve on error
+ */
+int dm_timing_fdt_report(void *blob, int parent);
+#else
+static inline void dm_dump_time(void)
+{
+}
+#endif
+
 #ifdef CONFIG_DEBUG_DEVRES
 /* Dump out a list of device resources */
 void dm_dump_devres(void);
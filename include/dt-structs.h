@@ -0,0 +1,42 @@
+/*
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#ifndef __DT_STRUCTS
+#define __DT_STRUCTS
+
+/*
+ * These structures are used by code generated by tools/dtoc to refer to
+ * other nodes through a phandle, followed by the arguments from the
+ * property, e.g. the GPIO number and flags.
+ */
+struct phandle_0_arg {
+	const void *node;
+	int arg[0];
+};
+
+struct phandle_1_arg {
+	const void *node;
+	int arg[1];
+};
+
+struct phandle_2_arg {
+	const void *node;
+	int arg[2];
+};
+
+struct phandle_3_arg {
+	const void *node;
+	int arg[3];
+};
+
+/*
+ * The generated header has a struct dtd_<compatible> for each compatible
+ * string in the SPL device tree. Integer properties are held as fdt32_t but
+ * are already in CPU byte order.
+ */
+#if CONFIG_IS_ENABLED(OF_PLATDATA)
+#include <generated/dt-structs.h>
+#endif
+
+#endif
@@ -36,4 +36,51 @@ int env_attr_walk(const char *attr_list,
  */
 int env_attr_lookup(const char *attr_list, const char *name, char *attributes);
 
+struct env_attr_entry;
+struct env_attr_regex;
+
+/*
+ * An env_attr_index holds a static attribute list and a dynamic one (e.g. the
+ * contents of ".flags") compiled into a form which can be searched without
+ * parsing the lists again. Names are kept in a sorted table and any regular
+ * expressions are compiled once, when the index is built.
+ *
+ * The index is rebuilt by env_attr_index_update() only when the dynamic list
+ * changes. An all-zero index is empty and ready for use.
+ */
+struct env_attr_index {
+	char *list;			/* copy of the dynamic list, or NULL */
+	char *buf;			/* entry strings; NULL if not built */
+	struct env_attr_entry *plain;	/* plain names, sorted by name */
+	int plain_count;
+	struct env_attr_regex *regex;	/* regular expressions, in list order */
+	int regex_count;
+};
+
+/*
+ * env_attr_index_update makes sure that "index" describes "static_list"
+ * followed by "attr_list" (which may be NULL), so that entries in "attr_list"
+ * override those in "static_list". Nothing is done if the index was already
+ * built from the same "attr_list". "static_list" must not change between
+ * calls and must remain valid while the index is used.
+ * Returns 0 on success, -ENOMEM if out of memory (the index is then empty).
+ */
+int env_attr_index_update(struct env_attr_index *index,
+	const char *static_list, const char *attr_list);
+
+/*
+ * env_attr_index_lookup looks up "name" in an index, with the same result as
+ * calling env_attr_lookup on the dynamic list and then, if the name is not
+ * found there, on the static list.
+ * Returns the attributes (an empty string if the entry has none) or NULL if
+ * the name is not found.
+ */
+const char *env_attr_index_lookup(const struct env_attr_index *index,
+	const char *name);
+
+/*
+ * env_attr_index_free frees the memory used by an index, leaving it empty.
+ */
+void env_attr_index_free(struct env_attr_index *index);
+
 #endif /* __ENV_ATTR_H__ */
@@ -0,0 +1,159 @@
+/*
+ * Append-log environment storage
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#ifndef __ENV_LOG_H__
+#define __ENV_LOG_H__
+
+#include <part.h>
+#include <search.h>
+
+/*
+ * The log area is split into a number of equal slots, each a whole number
+ * of erase blocks. One slot is in use at a time. It starts with a header
+ * holding a sequence number, followed by a full copy of the environment
+ * and then a record for each later saveenv holding only the variables which
+ * changed. When a slot fills up, the environment is compacted into the next
+ * slot (with the next sequence number), so erases are spread over all the
+ * slots. Each record has its own CRC, which also covers the sequence
+ * number, so a record from an earlier use of a slot, or one which was only
+ * partly written, ends the log.
+ */
+
+#define ENV_LOG_MAGIC		0x4c564e45	/* "ENVL" */
+
+/* Record types */
+enum env_log_type {
+	ENV_LOG_FULL	= 1,	/* the whole environment */
+	ENV_LOG_DELTA,		/* "name=value" to set, "name" to delete */
+};
+
+/**
+ * struct env_log_slot - Header at the start of each slot
+ *
+ * @magic:	ENV_LOG_MAGIC
+ * @seq:	Sequence number, incremented each time a slot is started
+ * @crc:	CRC32 of the fields above
+ */
+struct env_log_slot {
+	__le32 magic;
+	__le32 seq;
+	__le32 crc;
+};
+
+/**
+ * struct env_log_rec - Header of each record, followed by its data
+ *
+ * Records are padded to a multiple of 4 bytes.
+ *
+ * @crc:	CRC32 of the rest of the header and the data, seeded with the
+ *		slot's sequence number
+ * @size:	Size of the data in bytes, including the terminating nul
+ * @type:	Record type (enum env_log_type)
+ */
+struct env_log_rec {
+	__le32 crc;
+	__le32 size;
+	u8 type;
+	u8 reserved[3];
+};
+
+struct env_log;
+
+/**
+ * struct env_log_ops - Access to the storage holding the log
+ *
+ * Offsets are in bytes from the start of the device. Each method returns
+ * 0 on success or a negative error.
+ *
+ * @read:	Read data
+ * @write:	Write data. The area will have been erased first, if @erase
+ *		is provided
+ * @erase:	Erase a whole slot, or NULL if the storage can be written
+ *		without erasing
+ */
+struct env_log_ops {
+	int (*read)(struct env_log *log, ulong offset, size_t size, void *buf);
+	int (*write)(struct env_log *log, ulong offset, size_t size,
+		     const void *buf);
+	int (*erase)(struct env_log *log, ulong offset, size_t size);
+};
+
+/**
+ * struct env_log - An environment log on a storage device
+ *
+ * The first five fields are set up by the caller; the rest are private.
+ *
+ * @ops:	Storage access methods
+ * @priv:	Storage device (e.g. struct spi_flash or block_dev_desc_t)
+ * @offset:	Offset of the log area on the device
+ * @slot_size:	Size of each slot, a multiple of the erase size
+ * @slots:	Number of slots (at least 2)
+ * @slot:	Slot in use, or -1 if none
+ * @seq:	Highest sequence number seen, used for the next slot
+ * @used:	Number of bytes used in the current slot
+ * @full:	true if nothing more can be appended to the current slot
+ * @saved:	The environment as last loaded or saved, in hexport_r() format
+ * @saved_size:	Size of @saved in bytes
+ */
+struct env_log {
+	const struct env_log_ops *ops;
+	void *priv;
+	ulong offset;
+	uint slot_size;
+	uint slots;
+
+	int slot;
+	u32 seq;
+	uint used;
+	bool full;
+	char *saved;
+	uint saved_size;
+};
+
+/* Storage access for SPI flash (priv is a struct spi_flash) */
+extern const struct env_log_ops env_log_sf_ops;
+
+/* Storage access for block devices such as MMC (priv is a block_dev_desc_t) */
+extern const struct env_log_ops env_log_blk_ops;
+
+/**
+ * env_log_load() - Load the environment from a log
+ *
+ * This finds the latest slot with a valid full record and imports it, then
+ * applies each valid change record which follows it. If no slot has a valid
+ * header, an environment in the old format (env_t) at the start of the log
+ * area is imported instead, and the next save starts slot 1.
+ *
+ * @log:	Log to read
+ * @htab:	Hash table to import into (normally &env_htab)
+ * @flag:	Flags for himport_r() (e.g. H_ARENA)
+ * @return 0 if OK, -ENOENT if there is no valid log, -ENOMEM if out of
+ * memory, other -ve on error
+ */
+int env_log_load(struct env_log *log, struct hsearch_data *htab, int flag);
+
+/**
+ * env_log_save() - Save the environment to a log
+ *
+ * If possible this appends a record holding just the variables which have
+ * changed since the environment was loaded or last saved. Otherwise the
+ * whole environment is written to the next slot.
+ *
+ * @log:	Log to write
+ * @htab:	Hash table to export (normally &env_htab)
+ * @return 0 if OK, -ENOSPC if the environment does not fit in a slot,
+ * -ENOMEM if out of memory, other -ve on error
+ */
+int env_log_save(struct env_log *log, struct hsearch_data *htab);
+
+/**
+ * env_log_free() - Free the memory used by a log
+ *
+ * @log:	Log to free
+ */
+void env_log_free(struct env_log *log);
+
+#endif /* __ENV_LOG_H__ */
@@ -92,6 +92,20 @@ struct hash_algo {
 int hash_command(const char *algo_name, int flags, cmd_tbl_t *cmdtp, int flag,
 		 int argc, char * const argv[]);
 
+/**
+ * hash_blk_command: Process a hash command for a block device or partition
+ *
+ * The data is streamed from the device through the progressive hash
+ * interface in large chunks, so it does not need to fit into RAM.
+ *
+ * @flags:		Flags value (HASH_FLAG_...)
+ * @argc:		Number of arguments
+ * @argv:		Arguments: interface, dev[:part], algorithm and then
+ *			the destination or the hash to verify against
+ * @return CMD_RET_SUCCESS, CMD_RET_FAILURE or CMD_RET_USAGE
+ */
+int hash_blk_command(int flags, int argc, char * const argv[]);
+
 /**
  * hash_block() - Hash a block according to the requested algorithm
  *
@@ -877,6 +877,15 @@ int fit_set_timestamp(void *fit, int noffset, time_t timestamp);
 int fit_add_verification_data(const char *keydir, void *keydest, void *fit,
 			      const char *comment, int require_keys);
 
+/**
+ * fit_set_hash_threads() - set the number of threads used to hash images
+ *
+ * This applies to fit_add_verification_data() and fit_check_sign().
+ *
+ * @threads:	Number of threads, or 0 to use one per online CPU
+ */
+void fit_set_hash_threads(int threads);
+
 int fit_image_verify(const void *fit, int noffset);
 int fit_config_verify(const void *fit, int conf_noffset);
 int fit_all_image_verify(const void *fit);
@@ -265,6 +265,25 @@ int fdt_check_header(const void *fdt);
  */
 int fdt_move(const void *fdt, void *buf, int bufsize);
 
+/**
+ * fdt_generation - get a value which changes when a tree is written
+ * @fdt: pointer to the device tree blob
+ *
+ * fdt_generation() returns a value which changes each time a libfdt
+ * function writes to the tree at @fdt, or to a buffer which overlaps it.
+ * Code which caches offsets or pointers into a tree can compare it with the
+ * value seen when the cache was filled, to tell whether the tree may have
+ * changed. Writes to other trees do not change it.
+ *
+ * Only a few trees are tracked at once. A tree which has not been looked
+ * up recently gets a new value, so it is treated as changed. Changes made
+ * without libfdt, such as loading a new tree over an old one, are not seen.
+ *
+ * returns:
+ *	the current generation of the tree
+ */
+unsigned int fdt_generation(const void *fdt);
+
 /**********************************************************************/
 /* Read-only functions                                                */
 /**********************************************************************/
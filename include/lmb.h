@@ -11,6 +11,10 @@
  * SPDX-License-Identifier:	GPL-2.0+
  */
 
+/*
+ * Number of regions held in struct lmb_region itself. More are allocated
+ * with malloc() when needed.
+ */
 #define MAX_LMB_REGIONS 8
 
 struct lmb_property {
@@ -18,10 +22,16 @@ struct lmb_property {
 	phys_size_t size;
 };
 
+/*
+ * Regions are sorted by base address and do not overlap or touch, so that
+ * they can be searched with a binary search.
+ */
 struct lmb_region {
 	unsigned long cnt;
+	unsigned long max;		/* number of regions with space */
 	phys_size_t size;
-	struct lmb_property region[MAX_LMB_REGIONS+1];
+	struct lmb_property *region;	/* initial[], or allocated */
+	struct lmb_property initial[MAX_LMB_REGIONS];
 };
 
 struct lmb {
@@ -32,6 +42,7 @@ struct lmb {
 extern struct lmb lmb;
 
 extern void lmb_init(struct lmb *lmb);
+extern void lmb_uninit(struct lmb *lmb);
 extern long lmb_add(struct lmb *lmb, phys_addr_t base, phys_size_t size);
 extern long lmb_reserve(struct lmb *lmb, phys_addr_t base, phys_size_t size);
 extern phys_addr_t lmb_alloc(struct lmb *lmb, phys_size_t size, ulong align);
@@ -892,6 +892,17 @@ void *realloc_simple(void *ptr, size_t size);
 # define pvALLOc		dlpvalloc
 # define mALLINFo	dlmallinfo
 # define mALLOPt		dlmallopt
+# elif defined(CONFIG_MALLOC_TRACE) && !defined(CONFIG_SPL_BUILD)
+/* The public functions are in malloc_trace.c, which records each call */
+# define cALLOc		calloc_impl
+# define fREe		free_impl
+# define mALLOc		malloc_impl
+# define mEMALIGn	memalign_impl
+# define rEALLOc		realloc_impl
+# define vALLOc		valloc
+# define pvALLOc		pvalloc
+# define mALLINFo	mallinfo
+# define mALLOPt		mallopt
 # else /* USE_DL_PREFIX */
 # define cALLOc		calloc
 # define fREe		free
@@ -913,6 +924,13 @@ int initf_malloc(void);
 
 /* Simple versions which can be used when space is tight */
 void *malloc_simple(size_t size);
+void *memalign_simple(size_t alignment, size_t bytes);
+
+/* With CONFIG_SYS_MALLOC_F_POOL, memory from these can be freed again */
+void free_simple(void *ptr);
+void *realloc_simple(void *ptr, size_t size);
+bool malloc_simple_owns(const void *ptr);
+size_t malloc_simple_usable_size(const void *ptr);
 
 #pragma GCC visibility push(hidden)
 # if __STD_C
@@ -948,6 +966,14 @@ struct mallinfo mALLINFo();
 #endif
 #pragma GCC visibility pop
 
+#if defined(CONFIG_MALLOC_TRACE) && !defined(CONFIG_SPL_BUILD)
+void *malloc(size_t bytes);
+void free(void *mem);
+void *realloc(void *oldmem, size_t bytes);
+void *memalign(size_t alignment, size_t bytes);
+void *calloc(size_t n, size_t elem_size);
+#endif
+
 /*
  * Begin and End of memory area for malloc(), and current "brk"
  */
@@ -957,6 +983,108 @@ extern ulong mem_malloc_brk;
 
 void mem_malloc_init(ulong start, ulong size);
 
+/**
+ * struct malloc_heap_info - Usage of the malloc() heap
+ *
+ * Byte counts include the allocator's overhead for each block.
+ *
+ * @size:	Size of the heap
+ * @used:	Bytes in allocated blocks
+ * @free:	Bytes which are free
+ * @largest_free: Size of the largest free block
+ * @used_blocks: Number of allocated blocks
+ * @free_blocks: Number of free blocks
+ */
+struct malloc_heap_info {
+	ulong size;
+	ulong used;
+	ulong free;
+	ulong largest_free;
+	uint used_blocks;
+	uint free_blocks;
+};
+
+/**
+ * malloc_heap_info() - Get the usage of the malloc() heap
+ *
+ * This covers the heap set up by mem_malloc_init(), not the pool used
+ * before relocation.
+ *
+ * @info:	Returns the usage
+ */
+void malloc_heap_info(struct malloc_heap_info *info);
+
+/**
+ * malloc_run_in_arena() - Run a function with malloc() using another heap
+ *
+ * The heap starts empty and is dropped when @func returns, so @func must
+ * free everything it allocates, and must not free memory from the normal
+ * heap. Tests use this to measure the heap without the allocations which
+ * U-Boot has already made.
+ *
+ * @mem:	Memory to use for the heap
+ * @size:	Size of @mem in bytes
+ * @func:	Function to run
+ * @priv:	Argument for @func
+ * @return value returned by @func, or -ENOMEM if the heap could not be set up
+ */
+int malloc_run_in_arena(void *mem, size_t size, int (*func)(void *priv),
+			void *priv);
+
+/**
+ * malloc_simple_info() - Get the usage of the pool used before relocation
+ *
+ * This needs CONFIG_SYS_MALLOC_F_POOL. The high-water mark of the pool is
+ * in gd->malloc_ptr.
+ *
+ * @info:	Returns the usage
+ */
+void malloc_simple_info(struct malloc_heap_info *info);
+
+/**
+ * struct malloc_trace_rec - Record of an allocation, with CONFIG_MALLOC_TRACE
+ *
+ * @caller:	Address which called malloc(), etc.
+ * @size:	Number of bytes requested
+ * @time:	Time of the allocation (ms)
+ */
+struct malloc_trace_rec {
+	ulong caller;
+	ulong size;
+	ulong time;
+};
+
+/**
+ * malloc_trace_get() - Get the record of an allocation
+ *
+ * @ptr:	Allocation to look up
+ * @rec:	Returns the record
+ * @return 0 if OK, -ENOENT if there is no record of @ptr, for example
+ * because it has been freed or was allocated before relocation
+ */
+int malloc_trace_get(const void *ptr, struct malloc_trace_rec *rec);
+
+/**
+ * malloc_trace_info() - Show the memory used and the main callers
+ *
+ * This shows the usage of the heap and of the pool used before relocation,
+ * the peak usage, and the callers which used the most memory at their peak.
+ */
+void malloc_trace_info(void);
+
+/**
+ * malloc_trace_dump() - Show each allocation which is still live
+ */
+void malloc_trace_dump(void);
+
+/**
+ * malloc_trace_report() - Show the callers whose allocations are still live
+ *
+ * This is called before booting the OS, to show memory which U-Boot has
+ * not freed.
+ */
+void malloc_trace_report(void);
+
 #ifdef __cplusplus
 };  /* end of extern "C" */
 #endif
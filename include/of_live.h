@@ -0,0 +1,215 @@
+/*
+ * Live (unflattened) device tree
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#ifndef __OF_LIVE_H
+#define __OF_LIVE_H
+
+/**
+ * struct of_prop - a property in the live tree
+ *
+ * @name:	Property name (points into the FDT string table)
+ * @value:	Property value (points into the FDT structure block)
+ * @len:	Length of @value in bytes
+ */
+struct of_prop {
+	const char *name;
+	const void *value;
+	int len;
+};
+
+/**
+ * struct of_node - a node in the live tree
+ *
+ * Nodes keep their offset in the flat tree, so that code which identifies
+ * nodes by offset (such as dev->of_offset) can move between the two.
+ *
+ * @name:	Node name including any unit address, "" for the root node
+ * @offset:	Offset of this node in the FDT
+ * @phandle:	Node's phandle, or 0 if none
+ * @parent:	Parent node, or NULL for the root node
+ * @child:	First child node, or NULL if none
+ * @sibling:	Next sibling node, or NULL if none
+ * @props:	Properties of this node
+ * @prop_count:	Number of properties in @props
+ */
+struct of_node {
+	const char *name;
+	int offset;
+	uint32_t phandle;
+	struct of_node *parent;
+	struct of_node *child;
+	struct of_node *sibling;
+	struct of_prop *props;
+	int prop_count;
+};
+
+/**
+ * struct of_alias - an entry in the /aliases node
+ *
+ * @name:	Alias name, e.g. "serial0"
+ * @leaf:	Last component of the path which the alias points to
+ * @id:		Number at the end of @name, or -1 if none
+ */
+struct of_alias {
+	const char *name;
+	const char *leaf;
+	int id;
+};
+
+/**
+ * struct of_live - a live tree built from an FDT
+ *
+ * All strings and property values point into the FDT, which must therefore
+ * stay where it is. The tree is dropped (see of_live_get()) once the FDT is
+ * written.
+ *
+ * @blob:		FDT which the tree was built from
+ * @generation:		fdt_generation() of @blob when the tree was built
+ * @nodes:		All nodes, in FDT offset order; nodes[0] is the root
+ * @node_count:		Number of nodes
+ * @props:		All properties, in FDT order
+ * @phandles:		Hash table of nodes by phandle, with linear probing
+ * @phandle_mask:	Size of @phandles minus one (it is a power of two)
+ * @alias_node:		The /aliases node, or NULL if none
+ * @aliases:		Entries in /aliases which hold a path, in FDT order
+ * @alias_count:	Number of entries in @aliases
+ */
+struct of_live {
+	const void *blob;
+	unsigned int generation;
+	struct of_node *nodes;
+	int node_count;
+	struct of_prop *props;
+	struct of_node **phandles;
+	uint phandle_mask;
+	struct of_node *alias_node;
+	struct of_alias *aliases;
+	int alias_count;
+};
+
+/**
+ * of_live_build() - Build a live tree from an FDT
+ *
+ * The nodes, properties and tables are allocated in a single block, which
+ * is freed by of_live_free().
+ *
+ * @blob:	FDT to unflatten
+ * @livep:	Returns the new live tree
+ * @return 0 if OK, -ENOMEM if out of memory, -EINVAL if the FDT is invalid
+ */
+int of_live_build(const void *blob, struct of_live **livep);
+
+/**
+ * of_live_free() - Free a live tree
+ *
+ * @live:	Live tree to free (NULL is ignored)
+ */
+void of_live_free(struct of_live *live);
+
+/**
+ * of_live_alias_is_path() - Check whether an alias value is a full path
+ *
+ * Only aliases which hold a full path are used to find a node's sequence
+ * number, both with and without a live tree.
+ *
+ * @value:	Value of the property in /aliases
+ * @len:	Length of @value in bytes, including the terminator
+ * @return true if @value is a nul-terminated path starting with '/'
+ */
+static inline bool of_live_alias_is_path(const char *value, int len)
+{
+	return len > 1 && *value == '/' && !value[len - 1];
+}
+
+#if CONFIG_IS_ENABLED(OF_LIVE)
+/**
+ * of_live_get() - Get the live tree for an FDT
+ *
+ * @blob:	FDT which is being accessed
+ * @return live tree built from @blob, or NULL if there is none (or it is
+ * out of date), in which case the caller should use the FDT
+ */
+struct of_live *of_live_get(const void *blob);
+#else
+static inline struct of_live *of_live_get(const void *blob)
+{
+	return NULL;
+}
+#endif
+
+/**
+ * of_live_node() - Find the live node at an FDT offset
+ *
+ * @live:	Live tree
+ * @offset:	Offset of the node in the FDT
+ * @return node, or NULL if @offset is not the start of a node
+ */
+struct of_node *of_live_node(const struct of_live *live, int offset);
+
+/**
+ * of_live_getprop() - Look up a property in a live node
+ *
+ * @np:		Node to look in
+ * @name:	Property name
+ * @lenp:	If non-NULL, returns the property length in bytes, or
+ *		-FDT_ERR_NOTFOUND if there is no such property
+ * @return property value, or NULL if not found
+ */
+const void *of_live_getprop(const struct of_node *np, const char *name,
+			    int *lenp);
+
+/**
+ * of_live_node_by_phandle() - Find a node from its phandle
+ *
+ * This is the live-tree equivalent of fdt_node_offset_by_phandle().
+ *
+ * @live:	Live tree
+ * @phandle:	Phandle to look up
+ * @return FDT offset of the node, or -FDT_ERR_NOTFOUND
+ */
+int of_live_node_by_phandle(const struct of_live *live, uint32_t phandle);
+
+/**
+ * of_live_parent_offset() - Find the parent of a node
+ *
+ * This is the live-tree equivalent of fdt_parent_offset().
+ *
+ * @live:	Live tree
+ * @offset:	FDT offset of the node
+ * @return FDT offset of the parent, or -FDT_ERR_NOTFOUND for the root
+ * node, or -FDT_ERR_BADOFFSET if @offset is not a node
+ */
+int of_live_parent_offset(const struct of_live *live, int offset);
+
+/**
+ * of_live_path_offset() - Find a node from its path
+ *
+ * This is the live-tree equivalent of fdt_path_offset(). Paths which do
+ * not start with '/' are looked up in /aliases.
+ *
+ * @live:	Live tree
+ * @path:	Path to look up
+ * @return FDT offset of the node, or -FDT_ERR_NOTFOUND, or
+ * -FDT_ERR_BADPATH if the alias does not exist
+ */
+int of_live_path_offset(const struct of_live *live, const char *path);
+
+/**
+ * of_live_alias_seq() - Get the sequence number of a node from its alias
+ *
+ * This is the live-tree equivalent of fdtdec_get_alias_seq() and follows
+ * the same rules.
+ *
+ * @live:	Live tree
+ * @base:	Base name of the alias, e.g. "serial"
+ * @offset:	FDT offset of the node
+ * @seqp:	Returns the sequence number
+ * @return 0 if OK, -ENOENT if no alias matches
+ */
+int of_live_alias_seq(const struct of_live *live, const char *base,
+		      int offset, int *seqp);
+
+#endif
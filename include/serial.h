@@ -1,7 +1,9 @@
 #ifndef __SERIAL_H__
 #define __SERIAL_H__
 
+#include <membuff.h>
 #include <post.h>
+#include <linux/list.h>
 
 struct serial_device {
 	/* enough bytes to match alignment of following func pointer */
@@ -112,6 +114,25 @@ struct dm_serial_ops {
 	 * @return 0 if OK, -ve on error
 	 */
 	int (*putc)(struct udevice *dev, const char ch);
+	/**
+	 * puts() - Write a string of characters
+	 *
+	 * This should write as many characters as the device can accept
+	 * without waiting (e.g. until the transmit FIFO is full) and return
+	 * the number written. If no character can be written, it should
+	 * return -EAGAIN. Characters are written as they are: the uclass
+	 * adds any carriage returns that are needed.
+	 *
+	 * This method is optional. If provided, the uclass uses it to send
+	 * strings and to drain its transmit buffer (CONFIG_SERIAL_TX_BUFFER).
+	 *
+	 * @dev: Device pointer
+	 * @s: Characters to write
+	 * @len: Number of characters to write
+	 * @return number of characters written (> 0), -EAGAIN if none could
+	 * be written, other -ve on error
+	 */
+	int (*puts)(struct udevice *dev, const char *s, int len);
 	/**
 	 * pending() - Check if input/output characters are waiting
 	 *
@@ -156,11 +177,45 @@ struct dm_serial_ops {
  * struct serial_dev_priv - information about a device used by the uclass
  *
  * @sdev: stdio device attached to this uart
+ * @tx_buf: Output waiting to be sent (CONFIG_SERIAL_TX_BUFFER)
+ * @tx_node: Node in the list of devices with output waiting
+ * @tx_dev: Serial device which owns @tx_buf
+ * @tx_off: true if output is not buffered (no puts() method or no memory)
+ * @tx_busy: true while @tx_buf is being drained
  */
 struct serial_dev_priv {
 	struct stdio_dev *sdev;
+#ifdef CONFIG_SERIAL_TX_BUFFER
+	struct membuff tx_buf;
+	struct list_head tx_node;
+	struct udevice *tx_dev;
+	bool tx_off;
+	bool tx_busy;
+#endif
 };
 
+/* Output buffers are only used in U-Boot proper, once malloc() is ready */
+#if defined(CONFIG_SERIAL_TX_BUFFER) && !defined(CONFIG_SPL_BUILD)
+/**
+ * serial_poll_tx() - Send buffered output without waiting
+ *
+ * This passes as much buffered output as possible to each serial device
+ * which has some waiting. It is called while U-Boot is otherwise idle,
+ * for example from udelay().
+ */
+void serial_poll_tx(void);
+#else
+static inline void serial_poll_tx(void) {}
+#endif
+
+/**
+ * serial_flush() - Wait until all output has been sent
+ *
+ * This empties the output buffer of the current serial device and waits
+ * for the device to finish transmitting, if it can tell.
+ */
+void serial_flush(void);
+
 /* Access the serial operations for a device */
 #define serial_get_ops(dev)	((struct dm_serial_ops *)(dev)->driver->ops)
 
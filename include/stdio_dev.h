@@ -34,6 +34,8 @@ struct stdio_dev {
 	void (*putc)(struct stdio_dev *dev, const char c);
 	/* To put a string (accelerator) */
 	void (*puts)(struct stdio_dev *dev, const char *s);
+	/* To wait until all output has been sent (optional) */
+	void (*flush)(struct stdio_dev *dev);
 
 /* INPUT functions */
 
@@ -8,8 +8,14 @@
 #ifndef __TEST_SUITES_H__
 #define __TEST_SUITES_H__
 
+int do_ut_crc(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[]);
 int do_ut_dm(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[]);
 int do_ut_env(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[]);
+int do_ut_find_cmd(cmd_tbl_t *cmdtp, int flag, int argc,
+		   char * const argv[]);
+int do_ut_hush(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[]);
+int do_ut_lmb(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[]);
+int do_ut_malloc(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[]);
 int do_ut_time(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[]);
 
 #endif /* __TEST_SUITES_H__ */
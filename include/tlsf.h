@@ -0,0 +1,140 @@
+/*
+ * Two-level segregated fit (TLSF) memory allocator
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#ifndef __TLSF_H
+#define __TLSF_H
+
+/*
+ * Free blocks are kept in lists by size. The first level splits sizes by
+ * powers of two and the second level splits each of those into 32 equal
+ * ranges. A bitmap at each level shows which lists have blocks, so finding
+ * a block which is big enough, and freeing one, takes the same time
+ * however many blocks there are. Neighbouring free blocks are always
+ * merged.
+ *
+ * Each block has a two-word header. Allocations are aligned to twice the
+ * size of a word, as with dlmalloc.
+ */
+
+struct tlsf;
+
+/**
+ * struct tlsf_info - Usage of a TLSF pool
+ *
+ * Byte counts include the block headers.
+ *
+ * @size:	Size of the pool available for blocks
+ * @used:	Bytes in allocated blocks
+ * @free:	Bytes in free blocks
+ * @max_used:	Highest value of @used since the pool was created
+ * @largest_free: Size of the largest free block, excluding its header
+ * @used_blocks: Number of allocated blocks
+ * @free_blocks: Number of free blocks
+ */
+struct tlsf_info {
+	size_t size;
+	size_t used;
+	size_t free;
+	size_t max_used;
+	size_t largest_free;
+	uint used_blocks;
+	uint free_blocks;
+};
+
+/**
+ * tlsf_create() - Set up a pool in a region of memory
+ *
+ * The control structure is put at the start of the region and the rest is
+ * used for allocations.
+ *
+ * @mem:	Start of region
+ * @size:	Size of region in bytes
+ * @return pool, or NULL if the region is too small
+ */
+struct tlsf *tlsf_create(void *mem, size_t size);
+
+/**
+ * tlsf_malloc() - Allocate memory from a pool
+ *
+ * @tlsf:	Pool to use
+ * @size:	Number of bytes needed
+ * @return pointer to memory, or NULL if there is no free block large enough
+ */
+void *tlsf_malloc(struct tlsf *tlsf, size_t size);
+
+/**
+ * tlsf_memalign() - Allocate aligned memory from a pool
+ *
+ * @tlsf:	Pool to use
+ * @align:	Alignment needed, a power of two
+ * @size:	Number of bytes needed
+ * @return pointer to memory, or NULL if there is no free block large enough
+ */
+void *tlsf_memalign(struct tlsf *tlsf, size_t align, size_t size);
+
+/**
+ * tlsf_realloc() - Change the size of an allocation
+ *
+ * The block is resized in place if possible, otherwise the contents are
+ * moved to a new block.
+ *
+ * @tlsf:	Pool to use
+ * @ptr:	Existing allocation, or NULL to allocate a new block
+ * @size:	Number of bytes needed
+ * @return pointer to memory, or NULL if there is no free block large enough
+ * (in which case @ptr is left as it was)
+ */
+void *tlsf_realloc(struct tlsf *tlsf, void *ptr, size_t size);
+
+/**
+ * tlsf_free() - Free memory
+ *
+ * @tlsf:	Pool which @ptr came from
+ * @ptr:	Allocation to free, or NULL to do nothing
+ */
+void tlsf_free(struct tlsf *tlsf, void *ptr);
+
+/**
+ * tlsf_block_size() - Get the usable size of an allocation
+ *
+ * @ptr:	Allocation
+ * @return number of bytes which can be used, at least as many as requested
+ */
+size_t tlsf_block_size(void *ptr);
+
+/**
+ * tlsf_get_info() - Get the usage of a pool
+ *
+ * @tlsf:	Pool to check
+ * @info:	Returns the usage
+ */
+void tlsf_get_info(struct tlsf *tlsf, struct tlsf_info *info);
+
+/**
+ * tlsf_walk() - Call a function for each block in a pool
+ *
+ * Blocks are visited in address order. The function must not allocate or
+ * free memory in the pool.
+ *
+ * @tlsf:	Pool to walk
+ * @func:	Function to call, with the address and size of the block's
+ *		memory (as for tlsf_block_size()), whether it is allocated and
+ *		@priv
+ * @priv:	Private data for @func
+ */
+void tlsf_walk(struct tlsf *tlsf,
+	       void (*func)(void *ptr, size_t size, bool used, void *priv),
+	       void *priv);
+
+/**
+ * tlsf_check() - Check the consistency of a pool
+ *
+ * @tlsf:	Pool to check
+ * @return 0 if OK, -EINVAL if the pool is corrupted
+ */
+int tlsf_check(struct tlsf *tlsf);
+
+#endif
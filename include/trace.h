@@ -35,6 +35,7 @@ enum trace_chunk_type {
 struct trace_output_func {
 	uint32_t offset;		/* Function offset into code */
 	uint32_t call_count;		/* Number of times called */
+	uint32_t time_us;		/* Total time in function (or 0) */
 };
 
 /* A header at the start of the trace output buffer */
@@ -89,6 +90,57 @@ int trace_list_calls(void *buff, int buff_size, unsigned int *needed);
  */
 void trace_set_enabled(int enabled);
 
+/* What the trace records */
+enum trace_mode {
+	TRACE_MODE_CALLS,	/* Call records until the buffer is full */
+	TRACE_MODE_RING,	/* Call records, overwriting the oldest */
+	TRACE_MODE_FUNCS,	/* Only per-function call counts and times */
+
+	TRACE_MODE_COUNT,
+};
+
+/**
+ * Look up a trace mode by name
+ *
+ * @param name	Mode name ("calls", "ring" or "funcs")
+ * @return mode (enum trace_mode), or -1 if not found
+ */
+int trace_lookup_mode(const char *name);
+
+/**
+ * Change what the trace records
+ *
+ * Changing mode after a ring has wrapped discards its call records, since
+ * they are no longer in order.
+ *
+ * @param mode		New mode
+ * @return 0 if ok, -1 if trace is not initialised or the mode is invalid
+ */
+int trace_set_mode(enum trace_mode mode);
+
+/**
+ * Set the maximum call depth to trace
+ *
+ * Calls deeper than this are counted but not timed or recorded, which
+ * reduces the trace overhead.
+ *
+ * @param depth_limit	Maximum depth
+ * @return 0 if ok, -1 if trace is not initialised or the depth is invalid
+ */
+int trace_set_depth_limit(int depth_limit);
+
+/**
+ * Only trace functions within a range of addresses
+ *
+ * Other functions are ignored completely, so they do not count towards the
+ * call depth either.
+ *
+ * @param start		Start offset, from the start of the U-Boot code
+ * @param end		End offset (exclusive), or 0 to trace all functions
+ * @return 0 if ok, -1 if trace is not initialised or the range is invalid
+ */
+int trace_set_range(ulong start, ulong end);
+
 int trace_early_init(void);
 
 /**
@@ -14,6 +14,10 @@ uint32_t crc32 (uint32_t, const unsigned char *, uint);
 uint32_t crc32_wd (uint32_t, const unsigned char *, uint, uint);
 uint32_t crc32_no_comp (uint32_t, const unsigned char *, uint);
 
+/* lib/crc32.c: CRC32C (Castagnoli polynomial) */
+uint32_t crc32c(uint32_t, const unsigned char *, uint);
+uint32_t crc32c_no_comp(uint32_t, const unsigned char *, uint);
+
 /**
  * crc32_wd_buf - Perform CRC32 on a buffer and return result in buffer
  *
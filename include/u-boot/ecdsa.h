@@ -0,0 +1,90 @@
+/*
+ * ECDSA signing and verification for FIT images
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#ifndef _ECDSA_H
+#define _ECDSA_H
+
+#include <errno.h>
+#include <image.h>
+
+/* Name of the only supported curve, as used by OpenSSL */
+#define ECDSA_CURVE_P256	"prime256v1"
+
+/* Length of a raw P-256 signature (r followed by s), in bytes */
+#define ECDSA256_BYTES		(2 * 256 / 8)
+
+#if IMAGE_ENABLE_SIGN
+/**
+ * ecdsa_sign() - calculate and return signature for given input data
+ *
+ * The signature is stored as the raw values r and s, each as a 32-byte
+ * big-endian number.
+ *
+ * @info:	Specifies key and FIT information
+ * @region:	Pointer to the input data
+ * @region_count: Number of regions
+ * @sigp:	Set to an allocated buffer holding the signature
+ * @sig_len:	Set to length of the calculated signature
+ * @return: 0, on success, -ve on error
+ */
+int ecdsa_sign(struct image_sign_info *info,
+	       const struct image_region region[],
+	       int region_count, uint8_t **sigp, uint *sig_len);
+
+/**
+ * ecdsa_add_verify_data() - Add verification information to FDT
+ *
+ * Adds the curve name and the public key point to a key-<name> node under
+ * the signature node of @keydest.
+ *
+ * @info:	Specifies key and FIT information
+ * @keydest:	Destination FDT blob for public key data
+ * @return: 0, on success, -ENOSPC if the keydest FDT blob ran out of space,
+ *		other -ve value on error
+ */
+int ecdsa_add_verify_data(struct image_sign_info *info, void *keydest);
+#else
+static inline int ecdsa_sign(struct image_sign_info *info,
+		const struct image_region region[], int region_count,
+		uint8_t **sigp, uint *sig_len)
+{
+	return -ENXIO;
+}
+
+static inline int ecdsa_add_verify_data(struct image_sign_info *info,
+					void *keydest)
+{
+	return -ENXIO;
+}
+#endif
+
+#if IMAGE_ENABLE_VERIFY && (defined(USE_HOSTCC) || defined(CONFIG_ECDSA))
+/**
+ * ecdsa_verify() - Verify a signature against some data
+ *
+ * Verify a P-256 ECDSA signature against the hash of the given regions,
+ * using public keys from info->fdt_blob.
+ *
+ * @info:	Specifies key and FIT information
+ * @region:	Pointer to the input data
+ * @region_count: Number of regions
+ * @sig:	Signature
+ * @sig_len:	Number of bytes in signature
+ * @return 0 if verified, -ve on error
+ */
+int ecdsa_verify(struct image_sign_info *info,
+		 const struct image_region region[], int region_count,
+		 uint8_t *sig, uint sig_len);
+#else
+static inline int ecdsa_verify(struct image_sign_info *info,
+		const struct image_region region[], int region_count,
+		uint8_t *sig, uint sig_len)
+{
+	return -ENXIO;
+}
+#endif
+
+#endif
@@ -21,11 +21,40 @@
 #endif
 #include "u-boot/zlib.h"
 
+#ifndef USE_HOSTCC
+DECLARE_GLOBAL_DATA_PTR;
+#endif
+
 #define local static
 #define ZEXPORT	/* empty */
 
 #define tole(x) cpu_to_le32(x)
 
+/*
+ * Host tools always use the slicing-by-8 loop; U-Boot proper selects it with
+ * CONFIG_CRC32_SLICE8 and SPL keeps the smaller byte-at-a-time loop. ARMv8
+ * CPUs with the CRC32 extension use the hardware instructions instead, and
+ * x86 hosts with SSE4.2 use them for CRC32C.
+ */
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define CRC32_ARM64
+#else
+#if defined(__x86_64__) && defined(__SSE4_2__)
+#define CRC32C_SSE42
+#endif
+#if defined(USE_HOSTCC)
+#define CRC32_SLICE8
+#elif CONFIG_IS_ENABLED(CRC32_SLICE8)
+#define CRC32_SLICE8
+#endif
+#if defined(CRC32_SLICE8) && !defined(CRC32C_SSE42)
+#define CRC32C_SLICE8
+#endif
+#endif
+
+#define CRC32_POLY	0xedb88320	/* IEEE 802.3, reflected */
+#define CRC32C_POLY	0x82f63b78	/* Castagnoli, reflected */
+
 #ifdef DYNAMIC_CRC_TABLE
 
 local int crc_table_empty = 1;
@@ -78,7 +107,7 @@ local void make_crc_table()
   }
   crc_table_empty = 0;
 }
-#else
+#elif !defined(CRC32_ARM64)
 /* ========================================================================
  * Table of CRC-32's of all single-byte values (made by make_crc_table)
  */
@@ -151,6 +180,65 @@ tole(0xb40bbe37L), tole(0xc30c8ea1L), tole(0x5a05df1bL), tole(0x2d02ef8dL)
 };
 #endif
 
+#ifdef CRC32_SLICE8
+/*
+ * The slicing-by-8 tables are 8KiB per polynomial, so they are built in BSS
+ * by make_slice_tables() instead of being stored in the image. BSS cannot be
+ * written before relocation, so U-Boot proper builds them on first use after
+ * relocation and uses the byte-wise loops until then. Host tools build them
+ * at start-up, before any hashing threads exist.
+ */
+local uint32_t crc32_slice_table[8][256];
+#ifdef CRC32C_SLICE8
+local uint32_t crc32c_slice_table[8][256];
+#endif
+local int slice_tables_ready;
+
+/*
+ * Generate the slicing-by-8 tables for a reflected polynomial. Entry [k][n]
+ * is the CRC of byte n followed by k zero bytes, in CPU order.
+ */
+local void make_slice_table(uint32_t (*t)[256], uint32_t poly)
+{
+	uint32_t c;
+	int n, k;
+
+	for (n = 0; n < 256; n++) {
+		c = n;
+		for (k = 0; k < 8; k++)
+			c = c & 1 ? poly ^ (c >> 1) : c >> 1;
+		t[0][n] = c;
+	}
+	for (k = 1; k < 8; k++) {
+		for (n = 0; n < 256; n++)
+			t[k][n] = (t[k - 1][n] >> 8) ^ t[0][t[k - 1][n] & 0xff];
+	}
+}
+
+#ifdef USE_HOSTCC
+local void __attribute__((constructor)) make_slice_tables(void)
+#else
+local void make_slice_tables(void)
+#endif
+{
+	make_slice_table(crc32_slice_table, CRC32_POLY);
+#ifdef CRC32C_SLICE8
+	make_slice_table(crc32c_slice_table, CRC32C_POLY);
+#endif
+	slice_tables_ready = 1;
+}
+
+/* Return non-zero if the slicing-by-8 tables can be used */
+local int slice_tables_usable(void)
+{
+#ifndef USE_HOSTCC
+	if (!slice_tables_ready && (gd->flags & GD_FLG_RELOC))
+		make_slice_tables();
+#endif
+	return slice_tables_ready;
+}
+#endif
+
 #if 0
 /* =========================================================================
  * This function can be used by asm versions of crc32()
@@ -173,14 +261,88 @@ const uint32_t * ZEXPORT get_crc_table()
 
 /* ========================================================================= */
 
+#ifdef CRC32_SLICE8
+/*
+ * Slicing-by-8: fold eight input bytes into the CRC per step using one
+ * table lookup per byte. @t is a [8][256] table from make_slice_table().
+ */
+local uint32_t crc32_slice8(uint32_t crc, const unsigned char *p, uInt len,
+			    uint32_t (*t)[256])
+{
+	const uint32_t *w;
+	uint32_t one, two;
+
+	for (; len && ((unsigned long)p & 3); len--)
+		crc = t[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+
+	for (w = (const uint32_t *)p; len >= 8; len -= 8) {
+		one = le32_to_cpu(*w++) ^ crc;
+		two = le32_to_cpu(*w++);
+		crc = t[7][one & 0xff] ^ t[6][(one >> 8) & 0xff] ^
+		      t[5][(one >> 16) & 0xff] ^ t[4][one >> 24] ^
+		      t[3][two & 0xff] ^ t[2][(two >> 8) & 0xff] ^
+		      t[1][(two >> 16) & 0xff] ^ t[0][two >> 24];
+	}
+
+	for (p = (const unsigned char *)w; len; len--)
+		crc = t[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+
+	return crc;
+}
+#endif
+
+#ifdef CRC32_ARM64
+/* ARMv8 CRC32 extension, which covers both polynomials */
+local uint32_t crc32_arm64(uint32_t crc, const unsigned char *p, uInt len,
+			   int castagnoli)
+{
+	for (; len && ((unsigned long)p & 7); len--, p++)
+		crc = castagnoli ? __builtin_aarch64_crc32cb(crc, *p) :
+				   __builtin_aarch64_crc32b(crc, *p);
+
+	for (; len >= 8; len -= 8, p += 8)
+		crc = castagnoli ?
+			__builtin_aarch64_crc32cx(crc, *(const uint64_t *)p) :
+			__builtin_aarch64_crc32x(crc, *(const uint64_t *)p);
+
+	for (; len; len--, p++)
+		crc = castagnoli ? __builtin_aarch64_crc32cb(crc, *p) :
+				   __builtin_aarch64_crc32b(crc, *p);
+
+	return crc;
+}
+#elif defined(CRC32C_SSE42)
+/* SSE4.2 only provides the Castagnoli polynomial */
+local uint32_t crc32c_sse42(uint32_t crc, const unsigned char *p, uInt len)
+{
+	for (; len && ((unsigned long)p & 7); len--)
+		crc = __builtin_ia32_crc32qi(crc, *p++);
+
+	for (; len >= 8; len -= 8, p += 8)
+		crc = __builtin_ia32_crc32di(crc, *(const uint64_t *)p);
+
+	for (; len; len--)
+		crc = __builtin_ia32_crc32qi(crc, *p++);
+
+	return crc;
+}
+#endif
+
 /* No ones complement version. JFFS2 (and other things ?)
  * don't use ones compliment in their CRC calculations.
  */
 uint32_t ZEXPORT crc32_no_comp(uint32_t crc, const Bytef *buf, uInt len)
 {
+#if defined(CRC32_ARM64)
+    return crc32_arm64(crc, buf, len, 0);
+#else
     const uint32_t *tab = crc_table;
     const uint32_t *b =(const uint32_t *)buf;
     size_t rem_len;
+#ifdef CRC32_SLICE8
+    if (slice_tables_usable())
+      return crc32_slice8(crc, buf, len, crc32_slice_table);
+#endif
 #ifdef DYNAMIC_CRC_TABLE
     if (crc_table_empty)
       make_crc_table();
@@ -215,6 +377,7 @@ uint32_t ZEXPORT crc32_no_comp(uint32_t crc, const Bytef *buf, uInt len)
     }
 
     return le32_to_cpu(crc);
+#endif
 }
 #undef DO_CRC
 
@@ -223,6 +386,39 @@ uint32_t ZEXPORT crc32 (uint32_t crc, const Bytef *p, uInt len)
      return crc32_no_comp(crc ^ 0xffffffffL, p, len) ^ 0xffffffffL;
 }
 
+/*
+ * CRC32C (Castagnoli polynomial), as used by ext4 metadata_csum, btrfs and
+ * iSCSI. This uses hardware or the slicing-by-8 tables where available and
+ * otherwise falls back to a bit-at-a-time loop, which needs no table at all.
+ */
+uint32_t ZEXPORT crc32c_no_comp(uint32_t crc, const Bytef *buf, uInt len)
+{
+#if defined(CRC32_ARM64)
+	return crc32_arm64(crc, buf, len, 1);
+#elif defined(CRC32C_SSE42)
+	return crc32c_sse42(crc, buf, len);
+#else
+	int k;
+
+#ifdef CRC32C_SLICE8
+	if (slice_tables_usable())
+		return crc32_slice8(crc, buf, len, crc32c_slice_table);
+#endif
+	while (len--) {
+		crc ^= *buf++;
+		for (k = 0; k < 8; k++)
+			crc = crc & 1 ? CRC32C_POLY ^ (crc >> 1) : crc >> 1;
+	}
+
+	return crc;
+#endif
+}
+
+uint32_t ZEXPORT crc32c(uint32_t crc, const Bytef *p, uInt len)
+{
+	return crc32c_no_comp(crc ^ 0xffffffffL, p, len) ^ 0xffffffffL;
+}
+
 /*
  * Calculate the crc32 checksum triggering the watchdog every 'chunk_sz' bytes
  * of input.
@@ -0,0 +1,367 @@
+/*
+ * ECDSA signing of FIT images, using OpenSSL
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include "mkimage.h"
+#include <stdio.h>
+#include <string.h>
+#include <image.h>
+#include <u-boot/ecdsa.h>
+#include <openssl/ec.h>
+#include <openssl/ecdsa.h>
+#include <openssl/pem.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/obj_mac.h>
+#include <openssl/x509.h>
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+static void ECDSA_SIG_get0(const ECDSA_SIG *sig, const BIGNUM **pr,
+			   const BIGNUM **ps)
+{
+	*pr = sig->r;
+	*ps = sig->s;
+}
+#endif
+
+static int ecdsa_err(const char *msg)
+{
+	unsigned long sslErr = ERR_get_error();
+
+	fprintf(stderr, "%s", msg);
+	fprintf(stderr, ": %s\n",
+		ERR_error_string(sslErr, 0));
+
+	return -1;
+}
+
+/**
+ * ecdsa_check_curve() - check that a key is on the supported curve
+ *
+ * @ec:		Key to check
+ * @return 0 if ok, -EINVAL if the key uses some other curve
+ */
+static int ecdsa_check_curve(EC_KEY *ec)
+{
+	const EC_GROUP *group = EC_KEY_get0_group(ec);
+
+	if (!group || EC_GROUP_get_curve_name(group) != NID_X9_62_prime256v1) {
+		fprintf(stderr, "ECDSA key must use the %s curve\n",
+			ECDSA_CURVE_P256);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/**
+ * ecdsa_get_pub_key() - read a public key from a .crt file
+ *
+ * @keydir:	Directory containing the key
+ * @name	Name of key file (will have a .crt extension)
+ * @ecp		Returns EC_KEY object, or NULL on failure
+ * @return 0 if ok, -ve on error (in which case *ecp will be set to NULL)
+ */
+static int ecdsa_get_pub_key(const char *keydir, const char *name,
+			     EC_KEY **ecp)
+{
+	char path[1024];
+	EVP_PKEY *key;
+	X509 *cert;
+	EC_KEY *ec;
+	FILE *f;
+	int ret;
+
+	*ecp = NULL;
+	snprintf(path, sizeof(path), "%s/%s.crt", keydir, name);
+	f = fopen(path, "r");
+	if (!f) {
+		fprintf(stderr, "Couldn't open ECDSA certificate: '%s': %s\n",
+			path, strerror(errno));
+		return -EACCES;
+	}
+
+	cert = NULL;
+	if (!PEM_read_X509(f, &cert, NULL, NULL)) {
+		ecdsa_err("Couldn't read certificate");
+		ret = -EINVAL;
+		goto err_cert;
+	}
+
+	key = X509_get_pubkey(cert);
+	if (!key) {
+		ecdsa_err("Couldn't read public key\n");
+		ret = -EINVAL;
+		goto err_pubkey;
+	}
+
+	ec = EVP_PKEY_get1_EC_KEY(key);
+	if (!ec) {
+		ecdsa_err("Couldn't convert to an EC key");
+		ret = -EINVAL;
+		goto err_ec;
+	}
+	fclose(f);
+	EVP_PKEY_free(key);
+	X509_free(cert);
+	*ecp = ec;
+
+	return 0;
+
+err_ec:
+	EVP_PKEY_free(key);
+err_pubkey:
+	X509_free(cert);
+err_cert:
+	fclose(f);
+	return ret;
+}
+
+/**
+ * ecdsa_get_priv_key() - read a private key from a .key file
+ *
+ * @keydir:	Directory containing the key
+ * @name	Name of key file (will have a .key extension)
+ * @ecp		Returns EC_KEY object, or NULL on failure
+ * @return 0 if ok, -ve on error (in which case *ecp will be set to NULL)
+ */
+static int ecdsa_get_priv_key(const char *keydir, const char *name,
+			      EC_KEY **ecp)
+{
+	char path[1024];
+	EVP_PKEY *key;
+	EC_KEY *ec;
+	FILE *f;
+
+	*ecp = NULL;
+	snprintf(path, sizeof(path), "%s/%s.key", keydir, name);
+	f = fopen(path, "r");
+	if (!f) {
+		fprintf(stderr, "Couldn't open ECDSA private key: '%s': %s\n",
+			path, strerror(errno));
+		return -ENOENT;
+	}
+
+	key = PEM_read_PrivateKey(f, NULL, NULL, path);
+	fclose(f);
+	if (!key) {
+		ecdsa_err("Failure reading private key");
+		return -EPROTO;
+	}
+
+	ec = EVP_PKEY_get1_EC_KEY(key);
+	EVP_PKEY_free(key);
+	if (!ec) {
+		ecdsa_err("Private key is not an EC key");
+		return -EINVAL;
+	}
+	*ecp = ec;
+
+	return 0;
+}
+
+/* Write a bignum as a fixed-size big-endian number */
+static int ecdsa_put_bignum(uint8_t *buf, int size, const BIGNUM *num)
+{
+	int len = BN_num_bytes(num);
+
+	if (len > size)
+		return -EINVAL;
+	memset(buf, '\0', size - len);
+	BN_bn2bin(num, buf + size - len);
+
+	return 0;
+}
+
+static int ecdsa_sign_with_key(EC_KEY *ec, struct checksum_algo *checksum_algo,
+		const struct image_region region[], int region_count,
+		uint8_t **sigp, uint *sig_size)
+{
+	uint8_t digest[EVP_MAX_MD_SIZE];
+	const BIGNUM *r, *s;
+	EVP_MD_CTX *context;
+	ECDSA_SIG *ecsig;
+	uint digest_len;
+	uint8_t *sig;
+	int ret = 0;
+	int i;
+
+	context = EVP_MD_CTX_create();
+	if (!context)
+		return ecdsa_err("EVP context creation failed");
+
+	if (!EVP_DigestInit(context, checksum_algo->calculate_sign())) {
+		ret = ecdsa_err("Digest setup failed");
+		goto err_digest;
+	}
+	for (i = 0; i < region_count; i++) {
+		if (!EVP_DigestUpdate(context, region[i].data,
+				      region[i].size)) {
+			ret = ecdsa_err("Hashing data failed");
+			goto err_digest;
+		}
+	}
+	if (!EVP_DigestFinal(context, digest, &digest_len)) {
+		ret = ecdsa_err("Could not obtain digest");
+		goto err_digest;
+	}
+
+	ecsig = ECDSA_do_sign(digest, digest_len, ec);
+	if (!ecsig) {
+		ret = ecdsa_err("Could not obtain signature");
+		goto err_digest;
+	}
+
+	sig = malloc(ECDSA256_BYTES);
+	if (!sig) {
+		fprintf(stderr, "Out of memory for signature (%d bytes)\n",
+			ECDSA256_BYTES);
+		ret = -ENOMEM;
+		goto err_alloc;
+	}
+
+	ECDSA_SIG_get0(ecsig, &r, &s);
+	if (ecdsa_put_bignum(sig, ECDSA256_BYTES / 2, r) ||
+	    ecdsa_put_bignum(sig + ECDSA256_BYTES / 2, ECDSA256_BYTES / 2,
+			     s)) {
+		fprintf(stderr, "Signature value too large\n");
+		free(sig);
+		ret = -EINVAL;
+		goto err_alloc;
+	}
+
+	ECDSA_SIG_free(ecsig);
+	EVP_MD_CTX_destroy(context);
+	*sigp = sig;
+	*sig_size = ECDSA256_BYTES;
+
+	return 0;
+
+err_alloc:
+	ECDSA_SIG_free(ecsig);
+err_digest:
+	EVP_MD_CTX_destroy(context);
+	return ret;
+}
+
+int ecdsa_sign(struct image_sign_info *info,
+	       const struct image_region region[], int region_count,
+	       uint8_t **sigp, uint *sig_len)
+{
+	EC_KEY *ec;
+	int ret;
+
+	ret = ecdsa_get_priv_key(info->keydir, info->keyname, &ec);
+	if (ret)
+		return ret;
+	ret = ecdsa_check_curve(ec);
+	if (!ret)
+		ret = ecdsa_sign_with_key(ec, info->algo->checksum, region,
+					  region_count, sigp, sig_len);
+	EC_KEY_free(ec);
+
+	return ret;
+}
+
+int ecdsa_add_verify_data(struct image_sign_info *info, void *keydest)
+{
+	uint8_t x_point[ECDSA256_BYTES / 2], y_point[ECDSA256_BYTES / 2];
+	BIGNUM *x = NULL, *y = NULL;
+	int parent, node;
+	char name[100];
+	EC_KEY *ec;
+	int ret;
+
+	debug("%s: Getting verification data\n", __func__);
+	ret = ecdsa_get_pub_key(info->keydir, info->keyname, &ec);
+	if (ret)
+		return ret;
+	ret = ecdsa_check_curve(ec);
+	if (ret)
+		goto err_key;
+
+	x = BN_new();
+	y = BN_new();
+	if (!x || !y ||
+	    !EC_POINT_get_affine_coordinates_GFp(EC_KEY_get0_group(ec),
+						 EC_KEY_get0_public_key(ec),
+						 x, y, NULL) ||
+	    ecdsa_put_bignum(x_point, sizeof(x_point), x) ||
+	    ecdsa_put_bignum(y_point, sizeof(y_point), y)) {
+		ret = ecdsa_err("Couldn't get public key point");
+		goto err_key;
+	}
+
+	parent = fdt_subnode_offset(keydest, 0, FIT_SIG_NODENAME);
+	if (parent == -FDT_ERR_NOTFOUND) {
+		parent = fdt_add_subnode(keydest, 0, FIT_SIG_NODENAME);
+		if (parent < 0) {
+			ret = parent;
+			if (ret != -FDT_ERR_NOSPACE) {
+				fprintf(stderr, "Couldn't create signature node: %s\n",
+					fdt_strerror(parent));
+			}
+		}
+	}
+	if (ret)
+		goto done;
+
+	/* Either create or overwrite the named key node */
+	snprintf(name, sizeof(name), "key-%s", info->keyname);
+	node = fdt_subnode_offset(keydest, parent, name);
+	if (node == -FDT_ERR_NOTFOUND) {
+		node = fdt_add_subnode(keydest, parent, name);
+		if (node < 0) {
+			ret = node;
+			if (ret != -FDT_ERR_NOSPACE) {
+				fprintf(stderr, "Could not create key subnode: %s\n",
+					fdt_strerror(node));
+			}
+		}
+	} else if (node < 0) {
+		fprintf(stderr, "Cannot select keys parent: %s\n",
+			fdt_strerror(node));
+		ret = node;
+	}
+
+	if (!ret) {
+		ret = fdt_setprop_string(keydest, node, "key-name-hint",
+					 info->keyname);
+	}
+	if (!ret) {
+		ret = fdt_setprop_string(keydest, node, "ecdsa,curve",
+					 ECDSA_CURVE_P256);
+	}
+	if (!ret) {
+		ret = fdt_setprop(keydest, node, "ecdsa,x-point", x_point,
+				  sizeof(x_point));
+	}
+	if (!ret) {
+		ret = fdt_setprop(keydest, node, "ecdsa,y-point", y_point,
+				  sizeof(y_point));
+	}
+	if (!ret) {
+		ret = fdt_setprop_string(keydest, node, FIT_ALGO_PROP,
+					 info->algo->name);
+	}
+	if (!ret && info->require_keys) {
+		ret = fdt_setprop_string(keydest, node, "required",
+					 info->require_keys);
+	}
+done:
+	BN_free(x);
+	BN_free(y);
+	EC_KEY_free(ec);
+	if (ret)
+		return ret == -FDT_ERR_NOSPACE ? -ENOSPC : -EIO;
+
+	return 0;
+
+err_key:
+	BN_free(x);
+	BN_free(y);
+	EC_KEY_free(ec);
+	return ret;
+}
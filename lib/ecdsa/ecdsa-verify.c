@@ -0,0 +1,607 @@
+/*
+ * ECDSA signature verification over the NIST P-256 curve
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#ifndef USE_HOSTCC
+#include <common.h>
+#include <fdtdec.h>
+#include <asm/types.h>
+#include <asm/byteorder.h>
+#include <asm/errno.h>
+#else
+#include "fdt_host.h"
+#include "mkimage.h"
+#include <fdt_support.h>
+#endif
+#include <u-boot/ecdsa.h>
+
+/* Number of 32-bit words in a P-256 number */
+#define P256_WORDS	8
+
+/**
+ * struct p256_mod - a modulus for Montgomery arithmetic
+ *
+ * @m:		Modulus, as little endian word array
+ * @rr:		R^2 mod m, where R is 2^256
+ * @n0inv:	-1 / m[0] mod 2^32
+ */
+struct p256_mod {
+	uint32_t m[P256_WORDS];
+	uint32_t rr[P256_WORDS];
+	uint32_t n0inv;
+};
+
+/* Field prime p = 2^256 - 2^224 + 2^192 + 2^96 - 1 */
+static const struct p256_mod p256_p = {
+	.m = {
+		0xffffffff, 0xffffffff, 0xffffffff, 0x00000000,
+		0x00000000, 0x00000000, 0x00000001, 0xffffffff
+	},
+	.rr = {
+		0x00000003, 0x00000000, 0xffffffff, 0xfffffffb,
+		0xfffffffe, 0xffffffff, 0xfffffffd, 0x00000004
+	},
+	.n0inv = 0x00000001,
+};
+
+/* Order n of the base point */
+static const struct p256_mod p256_n = {
+	.m = {
+		0xfc632551, 0xf3b9cac2, 0xa7179e84, 0xbce6faad,
+		0xffffffff, 0xffffffff, 0x00000000, 0xffffffff
+	},
+	.rr = {
+		0xbe79eea2, 0x83244c95, 0x49bd6fa6, 0x4699799c,
+		0x2b6bec59, 0x2845b239, 0xf3d95620, 0x66e12d94
+	},
+	.n0inv = 0xee00bc4f,
+};
+
+/* Curve constant b, in y^2 = x^3 - 3x + b */
+static const uint32_t p256_b[P256_WORDS] = {
+	0x27d2604b, 0x3bce3c3e, 0xcc53b0f6, 0x651d06b0,
+	0x769886bc, 0xb3ebbd55, 0xaa3a93e7, 0x5ac635d8
+};
+
+/* Base point G */
+static const uint32_t p256_gx[P256_WORDS] = {
+	0xd898c296, 0xf4a13945, 0x2deb33a0, 0x77037d81,
+	0x63a440f2, 0xf8bce6e5, 0xe12c4247, 0x6b17d1f2
+};
+
+static const uint32_t p256_gy[P256_WORDS] = {
+	0x37bf51f5, 0xcbb64068, 0x6b315ece, 0x2bce3357,
+	0x7c0f9e16, 0x8ee7eb4a, 0xfe1a7f9b, 0x4fe342e2
+};
+
+/**
+ * struct p256_point - a point in Jacobian coordinates
+ *
+ * The affine point is (x / z^2, y / z^3). All coordinates are kept in
+ * Montgomery form modulo p. The point at infinity has z == 0.
+ */
+struct p256_point {
+	uint32_t x[P256_WORDS];
+	uint32_t y[P256_WORDS];
+	uint32_t z[P256_WORDS];
+};
+
+static void p256_from_bytes(uint32_t *out, const uint8_t *in)
+{
+	int i;
+
+	for (i = 0; i < P256_WORDS; i++) {
+		const uint8_t *p = in + (P256_WORDS - 1 - i) * 4;
+
+		out[i] = (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+	}
+}
+
+static int p256_is_zero(const uint32_t *a)
+{
+	uint32_t acc = 0;
+	int i;
+
+	for (i = 0; i < P256_WORDS; i++)
+		acc |= a[i];
+
+	return !acc;
+}
+
+static int p256_equal(const uint32_t *a, const uint32_t *b)
+{
+	uint32_t acc = 0;
+	int i;
+
+	for (i = 0; i < P256_WORDS; i++)
+		acc |= a[i] ^ b[i];
+
+	return !acc;
+}
+
+/* Compute r = a - b, returning the borrow */
+static uint32_t p256_sub(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+	int64_t acc = 0;
+	int i;
+
+	for (i = 0; i < P256_WORDS; i++) {
+		acc += (uint64_t)a[i] - b[i];
+		r[i] = (uint32_t)acc;
+		acc >>= 32;
+	}
+
+	return acc & 1;
+}
+
+/* Compute r = a + b, returning the carry */
+static uint32_t p256_add(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+	uint64_t acc = 0;
+	int i;
+
+	for (i = 0; i < P256_WORDS; i++) {
+		acc += (uint64_t)a[i] + b[i];
+		r[i] = (uint32_t)acc;
+		acc >>= 32;
+	}
+
+	return acc;
+}
+
+/* Select a if @cond is 1, b if it is 0, without branching */
+static void p256_select(uint32_t *r, uint32_t cond, const uint32_t *a,
+			const uint32_t *b)
+{
+	uint32_t mask = -cond;
+	int i;
+
+	for (i = 0; i < P256_WORDS; i++)
+		r[i] = (a[i] & mask) | (b[i] & ~mask);
+}
+
+/* Is a < m? */
+static int p256_less(const uint32_t *a, const struct p256_mod *mod)
+{
+	uint32_t tmp[P256_WORDS];
+
+	return p256_sub(tmp, a, mod->m);
+}
+
+/* r = a + b mod m, for a, b < m */
+static void p256_mod_add(const struct p256_mod *mod, uint32_t *r,
+			 const uint32_t *a, const uint32_t *b)
+{
+	uint32_t sum[P256_WORDS], diff[P256_WORDS];
+	uint32_t carry, borrow;
+
+	carry = p256_add(sum, a, b);
+	borrow = p256_sub(diff, sum, mod->m);
+	p256_select(r, carry | !borrow, diff, sum);
+}
+
+/* r = a - b mod m, for a, b < m */
+static void p256_mod_sub(const struct p256_mod *mod, uint32_t *r,
+			 const uint32_t *a, const uint32_t *b)
+{
+	uint32_t diff[P256_WORDS], sum[P256_WORDS];
+	uint32_t borrow;
+
+	borrow = p256_sub(diff, a, b);
+	p256_add(sum, diff, mod->m);
+	p256_select(r, borrow, sum, diff);
+}
+
+/**
+ * p256_mont_mul() - Montgomery multiply
+ *
+ * Operation: r = a * b / R mod m, for a, b < m
+ *
+ * @mod:	Modulus
+ * @r:		Place to put result, may be the same as @a or @b
+ * @a:		Multiplier
+ * @b:		Multiplicand
+ */
+static void p256_mont_mul(const struct p256_mod *mod, uint32_t *r,
+			  const uint32_t *a, const uint32_t *b)
+{
+	uint32_t t[P256_WORDS + 2] = { 0 };
+	uint32_t diff[P256_WORDS];
+	uint64_t acc;
+	uint32_t d, borrow;
+	int i, j;
+
+	for (i = 0; i < P256_WORDS; i++) {
+		acc = 0;
+		for (j = 0; j < P256_WORDS; j++) {
+			acc += (uint64_t)a[j] * b[i] + t[j];
+			t[j] = (uint32_t)acc;
+			acc >>= 32;
+		}
+		acc += t[P256_WORDS];
+		t[P256_WORDS] = (uint32_t)acc;
+		t[P256_WORDS + 1] = acc >> 32;
+
+		d = t[0] * mod->n0inv;
+		acc = (uint64_t)d * mod->m[0] + t[0];
+		acc >>= 32;
+		for (j = 1; j < P256_WORDS; j++) {
+			acc += (uint64_t)d * mod->m[j] + t[j];
+			t[j - 1] = (uint32_t)acc;
+			acc >>= 32;
+		}
+		acc += t[P256_WORDS];
+		t[P256_WORDS - 1] = (uint32_t)acc;
+		t[P256_WORDS] = t[P256_WORDS + 1] + (uint32_t)(acc >> 32);
+	}
+
+	/* The result is < 2m, so at most one subtraction is needed */
+	borrow = p256_sub(diff, t, mod->m);
+	p256_select(r, t[P256_WORDS] | !borrow, diff, t);
+}
+
+static void p256_to_mont(const struct p256_mod *mod, uint32_t *r,
+			 const uint32_t *a)
+{
+	p256_mont_mul(mod, r, a, mod->rr);
+}
+
+static void p256_from_mont(const struct p256_mod *mod, uint32_t *r,
+			   const uint32_t *a)
+{
+	static const uint32_t one[P256_WORDS] = { 1 };
+
+	p256_mont_mul(mod, r, a, one);
+}
+
+/**
+ * p256_mont_inv() - Modular inverse, in Montgomery form
+ *
+ * This uses Fermat's little theorem (a^-1 = a^(m-2) mod m), which needs
+ * no branches on the value of @a. Both moduli used here are prime.
+ *
+ * @mod:	Prime modulus
+ * @r:		Place to put result
+ * @a:		Value to invert, in Montgomery form
+ */
+static void p256_mont_inv(const struct p256_mod *mod, uint32_t *r,
+			  const uint32_t *a)
+{
+	static const uint32_t two[P256_WORDS] = { 2 };
+	uint32_t e[P256_WORDS], acc[P256_WORDS];
+	int i;
+
+	p256_sub(e, mod->m, two);
+	memcpy(acc, a, sizeof(acc));
+	/* The top bit of m - 2 is set for both moduli */
+	for (i = 254; i >= 0; i--) {
+		p256_mont_mul(mod, acc, acc, acc);
+		if (e[i / 32] >> (i % 32) & 1)
+			p256_mont_mul(mod, acc, acc, a);
+	}
+	memcpy(r, acc, sizeof(acc));
+}
+
+/* Double a point, using dbl-2001-b for a = -3 */
+static void p256_point_double(struct p256_point *r, const struct p256_point *a)
+{
+	const struct p256_mod *p = &p256_p;
+	uint32_t delta[P256_WORDS], gamma[P256_WORDS], beta[P256_WORDS];
+	uint32_t alpha[P256_WORDS], t1[P256_WORDS], t2[P256_WORDS];
+
+	p256_mont_mul(p, delta, a->z, a->z);
+	p256_mont_mul(p, gamma, a->y, a->y);
+	p256_mont_mul(p, beta, a->x, gamma);
+
+	/* alpha = 3 * (x - delta) * (x + delta) */
+	p256_mod_sub(p, t1, a->x, delta);
+	p256_mod_add(p, t2, a->x, delta);
+	p256_mont_mul(p, alpha, t1, t2);
+	p256_mod_add(p, t1, alpha, alpha);
+	p256_mod_add(p, alpha, t1, alpha);
+
+	/* z3 = (y + z)^2 - gamma - delta */
+	p256_mod_add(p, t1, a->y, a->z);
+	p256_mont_mul(p, t1, t1, t1);
+	p256_mod_sub(p, t1, t1, gamma);
+	p256_mod_sub(p, r->z, t1, delta);
+
+	/* x3 = alpha^2 - 8 * beta */
+	p256_mod_add(p, beta, beta, beta);
+	p256_mod_add(p, beta, beta, beta);
+	p256_mod_add(p, t2, beta, beta);
+	p256_mont_mul(p, t1, alpha, alpha);
+	p256_mod_sub(p, r->x, t1, t2);
+
+	/* y3 = alpha * (4 * beta - x3) - 8 * gamma^2 */
+	p256_mod_sub(p, t1, beta, r->x);
+	p256_mont_mul(p, t1, alpha, t1);
+	p256_mont_mul(p, gamma, gamma, gamma);
+	p256_mod_add(p, gamma, gamma, gamma);
+	p256_mod_add(p, gamma, gamma, gamma);
+	p256_mod_add(p, gamma, gamma, gamma);
+	p256_mod_sub(p, r->y, t1, gamma);
+}
+
+/* Add two points, using add-2007-bl */
+static void p256_point_add(struct p256_point *r, const struct p256_point *a,
+			   const struct p256_point *b)
+{
+	const struct p256_mod *p = &p256_p;
+	uint32_t z1z1[P256_WORDS], z2z2[P256_WORDS], u1[P256_WORDS];
+	uint32_t u2[P256_WORDS], s1[P256_WORDS], s2[P256_WORDS];
+	uint32_t h[P256_WORDS], i[P256_WORDS], j[P256_WORDS];
+	uint32_t rr[P256_WORDS], v[P256_WORDS], t[P256_WORDS];
+
+	if (p256_is_zero(a->z)) {
+		*r = *b;
+		return;
+	}
+	if (p256_is_zero(b->z)) {
+		*r = *a;
+		return;
+	}
+
+	p256_mont_mul(p, z1z1, a->z, a->z);
+	p256_mont_mul(p, z2z2, b->z, b->z);
+	p256_mont_mul(p, u1, a->x, z2z2);
+	p256_mont_mul(p, u2, b->x, z1z1);
+	p256_mont_mul(p, s1, a->y, b->z);
+	p256_mont_mul(p, s1, s1, z2z2);
+	p256_mont_mul(p, s2, b->y, a->z);
+	p256_mont_mul(p, s2, s2, z1z1);
+
+	p256_mod_sub(p, h, u2, u1);
+	p256_mod_sub(p, rr, s2, s1);
+	if (p256_is_zero(h)) {
+		if (p256_is_zero(rr)) {
+			p256_point_double(r, a);
+		} else {
+			/* a == -b, so the result is the point at infinity */
+			memset(r, '\0', sizeof(*r));
+		}
+		return;
+	}
+	p256_mod_add(p, rr, rr, rr);
+
+	/* i = (2h)^2, j = h * i, v = u1 * i */
+	p256_mod_add(p, i, h, h);
+	p256_mont_mul(p, i, i, i);
+	p256_mont_mul(p, j, h, i);
+	p256_mont_mul(p, v, u1, i);
+
+	/* z3 = ((z1 + z2)^2 - z1z1 - z2z2) * h */
+	p256_mod_add(p, t, a->z, b->z);
+	p256_mont_mul(p, t, t, t);
+	p256_mod_sub(p, t, t, z1z1);
+	p256_mod_sub(p, t, t, z2z2);
+	p256_mont_mul(p, r->z, t, h);
+
+	/* x3 = rr^2 - j - 2v */
+	p256_mont_mul(p, t, rr, rr);
+	p256_mod_sub(p, t, t, j);
+	p256_mod_sub(p, t, t, v);
+	p256_mod_sub(p, r->x, t, v);
+
+	/* y3 = rr * (v - x3) - 2 * s1 * j */
+	p256_mod_sub(p, t, v, r->x);
+	p256_mont_mul(p, t, rr, t);
+	p256_mont_mul(p, s1, s1, j);
+	p256_mod_add(p, s1, s1, s1);
+	p256_mod_sub(p, r->y, t, s1);
+}
+
+/* Set up a point from affine coordinates, checking it is on the curve */
+static int p256_point_from_affine(struct p256_point *r, const uint32_t *x,
+				  const uint32_t *y)
+{
+	const struct p256_mod *p = &p256_p;
+	uint32_t lhs[P256_WORDS], rhs[P256_WORDS], t[P256_WORDS];
+	uint32_t one[P256_WORDS] = { 1 };
+
+	if (!p256_less(x, p) || !p256_less(y, p))
+		return -EINVAL;
+
+	p256_to_mont(p, r->x, x);
+	p256_to_mont(p, r->y, y);
+	p256_to_mont(p, r->z, one);
+
+	/* Check y^2 == x^3 - 3x + b */
+	p256_mont_mul(p, lhs, r->y, r->y);
+	p256_mont_mul(p, rhs, r->x, r->x);
+	p256_mont_mul(p, rhs, rhs, r->x);
+	p256_mod_add(p, t, r->x, r->x);
+	p256_mod_add(p, t, t, r->x);
+	p256_mod_sub(p, rhs, rhs, t);
+	p256_to_mont(p, t, p256_b);
+	p256_mod_add(p, rhs, rhs, t);
+	if (!p256_equal(lhs, rhs))
+		return -EINVAL;
+
+	return 0;
+}
+
+/**
+ * p256_verify() - Verify a raw P-256 ECDSA signature
+ *
+ * @pub_x:	Public key x coordinate, 32 bytes big endian
+ * @pub_y:	Public key y coordinate, 32 bytes big endian
+ * @hash:	Hash of the signed data, 32 bytes
+ * @sig:	Signature r || s, each 32 bytes big endian
+ * @return 0 if the signature is valid, -EINVAL if the key is not a valid
+ * point, -EACCES if the signature does not match
+ */
+static int p256_verify(const uint8_t *pub_x, const uint8_t *pub_y,
+		       const uint8_t *hash, const uint8_t *sig)
+{
+	const struct p256_mod *n = &p256_n;
+	struct p256_point table[4], acc;
+	uint32_t x[P256_WORDS], y[P256_WORDS];
+	uint32_t r[P256_WORDS], s[P256_WORDS], e[P256_WORDS];
+	uint32_t w[P256_WORDS], u1[P256_WORDS], u2[P256_WORDS];
+	int idx, i;
+
+	p256_from_bytes(x, pub_x);
+	p256_from_bytes(y, pub_y);
+	p256_from_bytes(r, sig);
+	p256_from_bytes(s, sig + ECDSA256_BYTES / 2);
+	p256_from_bytes(e, hash);
+
+	/* r and s must be in [1, n - 1] */
+	if (p256_is_zero(r) || p256_is_zero(s) || !p256_less(r, n) ||
+	    !p256_less(s, n)) {
+		debug("%s: Signature out of range\n", __func__);
+		return -EACCES;
+	}
+
+	/* The hash is at most 2^256 - 1 < 2n, so one subtraction will do */
+	if (!p256_less(e, n))
+		p256_sub(e, e, n->m);
+
+	/* w = 1 / s, u1 = e * w, u2 = r * w, all mod n */
+	p256_to_mont(n, w, s);
+	p256_mont_inv(n, w, w);
+	p256_mont_mul(n, u1, e, w);
+	p256_mont_mul(n, u2, r, w);
+
+	/* Table of 0, G, Q and G + Q for Shamir's trick */
+	memset(&table[0], '\0', sizeof(table[0]));
+	p256_point_from_affine(&table[1], p256_gx, p256_gy);
+	if (p256_point_from_affine(&table[2], x, y)) {
+		debug("%s: Public key is not on the curve\n", __func__);
+		return -EINVAL;
+	}
+	p256_point_add(&table[3], &table[1], &table[2]);
+
+	/* acc = u1 * G + u2 * Q */
+	memset(&acc, '\0', sizeof(acc));
+	for (i = 255; i >= 0; i--) {
+		p256_point_double(&acc, &acc);
+		idx = (u1[i / 32] >> (i % 32) & 1) |
+			(u2[i / 32] >> (i % 32) & 1) << 1;
+		if (idx)
+			p256_point_add(&acc, &acc, &table[idx]);
+	}
+	if (p256_is_zero(acc.z))
+		return -EACCES;
+
+	/* Convert x to affine and check that x mod n == r */
+	p256_mont_inv(&p256_p, w, acc.z);
+	p256_mont_mul(&p256_p, w, w, w);
+	p256_mont_mul(&p256_p, x, acc.x, w);
+	p256_from_mont(&p256_p, x, x);
+	if (!p256_less(x, n))
+		p256_sub(x, x, n->m);
+	if (!p256_equal(x, r))
+		return -EACCES;
+
+	return 0;
+}
+
+/**
+ * ecdsa_verify_with_keynode() - Verify a signature using a key node
+ *
+ * @info:	Specifies key and FIT information
+ * @hash:	Pointer to the expected hash
+ * @sig:	Signature
+ * @sig_len:	Number of bytes in signature
+ * @node:	Node having the ECDSA key properties
+ * @return 0 if verified, -ve on error
+ */
+static int ecdsa_verify_with_keynode(struct image_sign_info *info,
+				     const void *hash, const uint8_t *sig,
+				     uint sig_len, int node)
+{
+	const void *blob = info->fdt_blob;
+	const uint8_t *x, *y;
+	const char *curve;
+	int x_len, y_len;
+
+	if (node < 0) {
+		debug("%s: Skipping invalid node", __func__);
+		return -EBADF;
+	}
+
+	curve = fdt_getprop(blob, node, "ecdsa,curve", NULL);
+	if (!curve || strcmp(curve, ECDSA_CURVE_P256)) {
+		debug("%s: Not a %s key\n", __func__, ECDSA_CURVE_P256);
+		return -EINVAL;
+	}
+
+	x = fdt_getprop(blob, node, "ecdsa,x-point", &x_len);
+	y = fdt_getprop(blob, node, "ecdsa,y-point", &y_len);
+	if (!x || !y || x_len != ECDSA256_BYTES / 2 ||
+	    y_len != ECDSA256_BYTES / 2) {
+		debug("%s: Missing ECDSA key info", __func__);
+		return -EFAULT;
+	}
+
+	if (sig_len != ECDSA256_BYTES) {
+		debug("Signature is of incorrect length %d\n", sig_len);
+		return -EINVAL;
+	}
+
+	return p256_verify(x, y, hash, sig);
+}
+
+int ecdsa_verify(struct image_sign_info *info,
+		 const struct image_region region[], int region_count,
+		 uint8_t *sig, uint sig_len)
+{
+	const void *blob = info->fdt_blob;
+	uint8_t hash[SHA256_SUM_LEN];
+	int ndepth, noffset;
+	int sig_node, node;
+	char name[100];
+	int ret;
+
+	if (info->algo->checksum->checksum_len != sizeof(hash)) {
+		debug("%s: invalid checksum-algorithm %s for %s\n",
+		      __func__, info->algo->checksum->name, info->algo->name);
+		return -EINVAL;
+	}
+
+	sig_node = fdt_subnode_offset(blob, 0, FIT_SIG_NODENAME);
+	if (sig_node < 0) {
+		debug("%s: No signature node found\n", __func__);
+		return -ENOENT;
+	}
+
+	ret = info->algo->checksum->calculate(info->algo->checksum->name,
+					region, region_count, hash);
+	if (ret < 0) {
+		debug("%s: Error in checksum calculation\n", __func__);
+		return -EINVAL;
+	}
+
+	/* See if we must use a particular key */
+	if (info->required_keynode != -1) {
+		ret = ecdsa_verify_with_keynode(info, hash, sig, sig_len,
+						info->required_keynode);
+		if (!ret)
+			return ret;
+	}
+
+	/* Look for a key that matches our hint */
+	snprintf(name, sizeof(name), "key-%s", info->keyname);
+	node = fdt_subnode_offset(blob, sig_node, name);
+	ret = ecdsa_verify_with_keynode(info, hash, sig, sig_len, node);
+	if (!ret)
+		return ret;
+
+	/* No luck, so try each of the keys in turn */
+	for (ndepth = 0, noffset = fdt_next_node(blob, sig_node, &ndepth);
+			(noffset >= 0) && (ndepth > 0);
+			noffset = fdt_next_node(blob, noffset, &ndepth)) {
+		if (ndepth == 1 && noffset != node) {
+			ret = ecdsa_verify_with_keynode(info, hash, sig,
+							sig_len, noffset);
+			if (!ret)
+				break;
+		}
+	}
+
+	return ret;
+}
@@ -10,6 +10,7 @@
 #include <serial.h>
 #include <libfdt.h>
 #include <fdtdec.h>
+#include <of_live.h>
 #include <asm/sections.h>
 #include <linux/ctype.h>
 
@@ -75,6 +76,40 @@ static const char * const compat_names[COMPAT_COUNT] = {
 	COMPAT(COMPAT_INTEL_IVYBRIDGE_FSP, "intel,ivybridge-fsp"),
 };
 
+/*
+ * These lookups scan the FDT from the start, so use the live tree instead
+ * if there is one.
+ */
+static int fdtdec_path_offset(const void *blob, const char *path)
+{
+	struct of_live *live = of_live_get(blob);
+
+	if (live)
+		return of_live_path_offset(live, path);
+
+	return fdt_path_offset(blob, path);
+}
+
+static int fdtdec_parent_offset(const void *blob, int node)
+{
+	struct of_live *live = of_live_get(blob);
+
+	if (live)
+		return of_live_parent_offset(live, node);
+
+	return fdt_parent_offset(blob, node);
+}
+
+static int fdtdec_node_by_phandle(const void *blob, uint32_t phandle)
+{
+	struct of_live *live = of_live_get(blob);
+
+	if (live)
+		return of_live_node_by_phandle(live, phandle);
+
+	return fdt_node_offset_by_phandle(blob, phandle);
+}
+
 const char *fdtdec_get_compatible(enum fdt_compat_id id)
 {
 	/* We allow reading of the 'unknown' ID for testing purposes */
@@ -163,7 +198,7 @@ fdt_addr_t fdtdec_get_addr_size_auto_noparent(const void *blob, int node,
 
 	debug("%s: ", __func__);
 
-	parent = fdt_parent_offset(blob, node);
+	parent = fdtdec_parent_offset(blob, node);
 	if (parent < 0) {
 		debug("(no parent found)\n");
 		return FDT_ADDR_T_NONE;
@@ -372,7 +407,7 @@ int fdtdec_next_alias(const void *blob, const char *name,
 	/* snprintf() is not available */
 	assert(strlen(name) < MAX_STR_LEN);
 	sprintf(str, "%.*s%d", MAX_STR_LEN, name, *upto);
-	node = fdt_path_offset(blob, str);
+	node = fdtdec_path_offset(blob, str);
 	if (node < 0)
 		return node;
 	err = fdt_node_check_compatible(blob, node, compat_names[id]);
@@ -405,7 +440,7 @@ int fdtdec_add_aliases_for_id(const void *blob, const char *name,
 	int i, j;
 
 	/* find the alias node if present */
-	alias_node = fdt_path_offset(blob, "/aliases");
+	alias_node = fdtdec_path_offset(blob, "/aliases");
 
 	/*
 	 * start with nothing, and we can assume that the root node can't
@@ -436,7 +471,7 @@ int fdtdec_add_aliases_for_id(const void *blob, const char *name,
 		prop = fdt_get_property_by_offset(blob, offset, NULL);
 		path = fdt_string(blob, fdt32_to_cpu(prop->nameoff));
 		if (prop->len && 0 == strncmp(path, name, name_len))
-			node = fdt_path_offset(blob, prop->data);
+			node = fdtdec_path_offset(blob, prop->data);
 		if (node <= 0)
 			continue;
 
@@ -510,16 +545,20 @@ int fdtdec_add_aliases_for_id(const void *blob, const char *name,
 int fdtdec_get_alias_seq(const void *blob, const char *base, int offset,
 			 int *seqp)
 {
+	struct of_live *live = of_live_get(blob);
 	int base_len = strlen(base);
 	const char *find_name;
 	int find_namelen;
 	int prop_offset;
 	int aliases;
 
+	if (live)
+		return of_live_alias_seq(live, base, offset, seqp);
+
 	find_name = fdt_get_name(blob, offset, &find_namelen);
 	debug("Looking for '%s' at %d, name %s\n", base, offset, find_name);
 
-	aliases = fdt_path_offset(blob, "/aliases");
+	aliases = fdtdec_path_offset(blob, "/aliases");
 	for (prop_offset = fdt_first_property_offset(blob, aliases);
 	     prop_offset > 0;
 	     prop_offset = fdt_next_property_offset(blob, prop_offset)) {
@@ -530,7 +569,7 @@ int fdtdec_get_alias_seq(const void *blob, const char *base, int offset,
 
 		prop = fdt_getprop_by_offset(blob, prop_offset, &name, &len);
 		debug("   - %s, %s\n", name, prop);
-		if (len < find_namelen || *prop != '/' || prop[len - 1] ||
+		if (len < find_namelen || !of_live_alias_is_path(prop, len) ||
 		    strncmp(name, base, base_len))
 			continue;
 
@@ -555,7 +594,7 @@ const char *fdtdec_get_chosen_prop(const void *blob, const char *name)
 
 	if (!blob)
 		return NULL;
-	chosen_node = fdt_path_offset(blob, "/chosen");
+	chosen_node = fdtdec_path_offset(blob, "/chosen");
 	return fdt_getprop(blob, chosen_node, name, NULL);
 }
 
@@ -566,7 +605,7 @@ int fdtdec_get_chosen_node(const void *blob, const char *name)
 	prop = fdtdec_get_chosen_prop(blob, name);
 	if (!prop)
 		return -FDT_ERR_NOTFOUND;
-	return fdt_path_offset(blob, prop);
+	return fdtdec_path_offset(blob, prop);
 }
 
 int fdtdec_check_fdt(void)
@@ -617,7 +656,7 @@ int fdtdec_lookup_phandle(const void *blob, int node, const char *prop_name)
 	if (!phandle)
 		return -FDT_ERR_NOTFOUND;
 
-	lookup = fdt_node_offset_by_phandle(blob, fdt32_to_cpu(*phandle));
+	lookup = fdtdec_node_by_phandle(blob, fdt32_to_cpu(*phandle));
 	return lookup;
 }
 
@@ -745,7 +784,7 @@ int fdtdec_parse_phandle_with_args(const void *blob, int src_node,
 			 * below.
 			 */
 			if (cells_name || cur_index == index) {
-				node = fdt_node_offset_by_phandle(blob,
+				node = fdtdec_node_by_phandle(blob,
 								  phandle);
 				if (!node) {
 					debug("%s: could not find phandle\n",
@@ -871,7 +910,7 @@ int fdtdec_get_config_int(const void *blob, const char *prop_name,
 	int config_node;
 
 	debug("%s: %s\n", __func__, prop_name);
-	config_node = fdt_path_offset(blob, "/config");
+	config_node = fdtdec_path_offset(blob, "/config");
 	if (config_node < 0)
 		return default_val;
 	return fdtdec_get_int(blob, config_node, prop_name, default_val);
@@ -883,7 +922,7 @@ int fdtdec_get_config_bool(const void *blob, const char *prop_name)
 	const void *prop;
 
 	debug("%s: %s\n", __func__, prop_name);
-	config_node = fdt_path_offset(blob, "/config");
+	config_node = fdtdec_path_offset(blob, "/config");
 	if (config_node < 0)
 		return 0;
 	prop = fdt_get_property(blob, config_node, prop_name, NULL);
@@ -898,7 +937,7 @@ char *fdtdec_get_config_string(const void *blob, const char *prop_name)
 	int len;
 
 	debug("%s: %s\n", __func__, prop_name);
-	nodeoffset = fdt_path_offset(blob, "/config");
+	nodeoffset = fdtdec_path_offset(blob, "/config");
 	if (nodeoffset < 0)
 		return NULL;
 
@@ -980,7 +1019,7 @@ int fdt_get_resource(const void *fdt, int node, const char *property,
 	int na, ns, len, parent;
 	unsigned int i = 0;
 
-	parent = fdt_parent_offset(fdt, node);
+	parent = fdtdec_parent_offset(fdt, node);
 	if (parent < 0)
 		return parent;
 
@@ -1031,7 +1070,7 @@ int fdtdec_decode_memory_region(const void *blob, int config_node,
 	int node;
 
 	if (config_node == -1) {
-		config_node = fdt_path_offset(blob, "/config");
+		config_node = fdtdec_path_offset(blob, "/config");
 		if (config_node < 0) {
 			debug("%s: Cannot find /config node\n", __func__);
 			return -ENOENT;
@@ -1049,7 +1088,7 @@ int fdtdec_decode_memory_region(const void *blob, int config_node,
 		mem = "/memory";
 	}
 
-	node = fdt_path_offset(blob, mem);
+	node = fdtdec_path_offset(blob, mem);
 	if (node < 0) {
 		debug("%s: Failed to find node '%s': %s\n", __func__, mem,
 		      fdt_strerror(node));
@@ -66,6 +66,28 @@ typedef struct _ENTRY {
 static void _hdelete(const char *key, struct hsearch_data *htab, ENTRY *ep,
 	int idx);
 
+/*
+ * Strings imported with H_ARENA live in a single block owned by the table.
+ * They are neither copied on insertion nor freed one by one; an entry only
+ * gets its own copy of a string when it is changed.
+ */
+static inline int in_arena(struct hsearch_data *htab, const void *ptr)
+{
+	return (const char *)ptr >= htab->arena &&
+	       (const char *)ptr < htab->arena + htab->arena_size;
+}
+
+static char *hstrdup(struct hsearch_data *htab, const char *str)
+{
+	return in_arena(htab, str) ? (char *)str : strdup(str);
+}
+
+static void hfree(struct hsearch_data *htab, void *ptr)
+{
+	if (!in_arena(htab, ptr))
+		free(ptr);
+}
+
 /*
  * hcreate()
  */
@@ -151,11 +173,14 @@ void hdestroy_r(struct hsearch_data *htab)
 		if (htab->table[i].used > 0) {
 			ENTRY *ep = &htab->table[i].entry;
 
-			free((void *)ep->key);
-			free(ep->data);
+			hfree(htab, (void *)ep->key);
+			hfree(htab, ep->data);
 		}
 	}
 	free(htab->table);
+	free(htab->arena);
+	htab->arena = NULL;
+	htab->arena_size = 0;
 
 	/* the sign for an existing table is an value != NULL in htable */
 	htab->table = NULL;
@@ -252,8 +277,8 @@ static inline int _compare_and_overwrite_entry(ENTRY item, ACTION action,
 				return 0;
 			}
 
-			free(htab->table[idx].entry.data);
-			htab->table[idx].entry.data = strdup(item.data);
+			hfree(htab, htab->table[idx].entry.data);
+			htab->table[idx].entry.data = hstrdup(htab, item.data);
 			if (!htab->table[idx].entry.data) {
 				__set_errno(ENOMEM);
 				*retval = NULL;
@@ -359,14 +384,15 @@ int hsearch_r(ENTRY item, ACTION action, ENTRY ** retval,
 
 		/*
 		 * Create new entry;
-		 * create copies of item.key and item.data
+		 * create copies of item.key and item.data, unless they are
+		 * being imported into the arena
 		 */
 		if (first_deleted)
 			idx = first_deleted;
 
 		htab->table[idx].used = hval;
-		htab->table[idx].entry.key = strdup(item.key);
-		htab->table[idx].entry.data = strdup(item.data);
+		htab->table[idx].entry.key = hstrdup(htab, item.key);
+		htab->table[idx].entry.data = hstrdup(htab, item.data);
 		if (!htab->table[idx].entry.key ||
 		    !htab->table[idx].entry.data) {
 			__set_errno(ENOMEM);
@@ -430,8 +456,8 @@ static void _hdelete(const char *key, struct hsearch_data *htab, ENTRY *ep,
 {
 	/* free used ENTRY */
 	debug("hdelete: DELETING key \"%s\"\n", key);
-	free((void *)ep->key);
-	free(ep->data);
+	hfree(htab, (void *)ep->key);
+	hfree(htab, ep->data);
 	ep->callback = NULL;
 	ep->flags = 0;
 	htab->table[idx].used = -1;
@@ -739,6 +765,31 @@ static int drop_var_from_set(const char *name, int nvars, char * vars[])
 	return res;
 }
 
+/*
+ * Count the entries in linearized data, as a first pass before importing it.
+ * Entries are separated by 'sep' or '\0' and the data ends at an empty entry
+ * or after 'size' bytes. Returns the number of bytes before the end, setting
+ * *countp to the number of entries (which may include comments, so it is an
+ * upper bound).
+ */
+static size_t himport_count(const char *env, size_t size, const char sep,
+		int *countp)
+{
+	const char *dp, *end = env + size;
+	int count = 0;
+
+	for (dp = env; dp < end && *dp; dp++) {
+		count++;
+		while (dp < end && *dp && *dp != sep)
+			dp++;
+		if (dp == end)
+			break;
+	}
+	*countp = count;
+
+	return dp - env;
+}
+
 /*
  * Import linearized data into hash table.
  *
@@ -772,6 +823,12 @@ static int drop_var_from_set(const char *name, int nvars, char * vars[])
  *
  * In theory, arbitrary separator characters can be used, but only
  * '\0' and '\n' have really been tested.
+ *
+ * When the H_ARENA bit is set and the table does not already have an
+ * arena, the copy of the data made here is kept as the table's arena and
+ * the entries point into it, instead of each name and value being copied
+ * separately. This saves two malloc() calls per variable when importing a
+ * whole environment.
  */
 
 int himport_r(struct hsearch_data *htab,
@@ -780,6 +837,8 @@ int himport_r(struct hsearch_data *htab,
 {
 	char *data, *sp, *dp, *name, *value;
 	char *localvars[nvars];
+	size_t len;
+	int count;
 	int i;
 
 	/* Test for correct arguments.  */
@@ -788,14 +847,18 @@ int himport_r(struct hsearch_data *htab,
 		return 0;
 	}
 
+	/* only copy the entries, not any unused space after them */
+	len = himport_count(env, size, sep, &count);
+
 	/* we allocate new space to make sure we can write to the array */
-	if ((data = malloc(size + 1)) == NULL) {
-		debug("himport_r: can't malloc %zu bytes\n", size + 1);
+	if ((data = malloc(len + 2)) == NULL) {
+		debug("himport_r: can't malloc %zu bytes\n", len + 2);
 		__set_errno(ENOMEM);
 		return 0;
 	}
-	memcpy(data, env, size);
-	data[size] = '\0';
+	memcpy(data, env, len);
+	data[len] = '\0';
+	data[len + 1] = '\0';
 	dp = data;
 
 	/* make a local copy of the list of variables */
@@ -825,7 +888,12 @@ int himport_r(struct hsearch_data *htab,
 	 * envrionment size), so we clip it to a reasonable value.
 	 * On the other hand we need to add some more entries for free
 	 * space when importing very small buffers. Both boundaries can
-	 * be overwritten in the board config file if needed.
+	 * be overwritten in the board config file if needed. Only the
+	 * bytes in use are copied above, but the table is sized from the
+	 * whole "size" so that there is room for variables added later.
+	 * Whatever the heuristics say, the table is made at least twice as
+	 * large as the number of entries found by himport_count(), so that
+	 * the import cannot fill it.
 	 */
 
 	if (!htab->table) {
@@ -833,6 +901,8 @@ int himport_r(struct hsearch_data *htab,
 
 		if (nent > CONFIG_ENV_MAX_ENTRIES)
 			nent = CONFIG_ENV_MAX_ENTRIES;
+		if (nent < count * 2)
+			nent = count * 2;
 
 		debug("Create Hash Table: N=%d\n", nent);
 
@@ -842,21 +912,25 @@ int himport_r(struct hsearch_data *htab,
 		}
 	}
 
-	if (!size) {
+	if (!len) {
 		free(data);
 		return 1;		/* everything OK */
 	}
+	if ((flag & H_ARENA) && !htab->arena) {
+		htab->arena = data;
+		htab->arena_size = len + 2;
+	}
 	if(crlf_is_lf) {
 		/* Remove Carriage Returns in front of Line Feeds */
 		unsigned ignored_crs = 0;
-		for(;dp < data + size && *dp; ++dp) {
+		for(;dp < data + len && *dp; ++dp) {
 			if(*dp == '\r' &&
-			   dp < data + size - 1 && *(dp+1) == '\n')
+			   dp < data + len - 1 && *(dp+1) == '\n')
 				++ignored_crs;
 			else
 				*(dp-ignored_crs) = *dp;
 		}
-		size -= ignored_crs;
+		len -= ignored_crs;
 		dp = data;
 	}
 	/* Parse environment; allow for '\0' and 'sep' as separators */
@@ -909,7 +983,7 @@ int himport_r(struct hsearch_data *htab,
 		if (*name == 0) {
 			debug("INSERT: unable to use an empty key\n");
 			__set_errno(EINVAL);
-			free(data);
+			hfree(htab, data);
 			return 0;
 		}
 
@@ -929,10 +1003,10 @@ int himport_r(struct hsearch_data *htab,
 		debug("INSERT: table %p, filled %d/%d rv %p ==> name=\"%s\" value=\"%s\"\n",
 			htab, htab->filled, htab->size,
 			rv, name, value);
-	} while ((dp < data + size) && *dp);	/* size check needed for text */
+	} while ((dp < data + len) && *dp);	/* size check needed for text */
 						/* without '\0' termination */
 	debug("INSERT: free(data = %p)\n", data);
-	free(data);
+	hfree(htab, data);
 
 	/* process variables which were not considered */
 	for (i = 0; i < nvars; i++) {
@@ -10,12 +10,59 @@
 
 DECLARE_GLOBAL_DATA_PTR;
 
+#ifdef CONFIG_BOOTSTAGE_INITCALL
+#ifndef CONFIG_KALLSYMS
+/*
+ * Record names, used when there is no symbol table. These are written before
+ * relocation, when BSS is not available.
+ */
+static char initcall_names[CONFIG_BOOTSTAGE_USER_COUNT][24]
+	__attribute__((section(".data")));
+static int initcall_name_count __attribute__((section(".data")));
+#endif
+
+/* Get a name for the bootstage record of an initcall at @addr */
+static const char *initcall_name(ulong addr)
+{
+#ifdef CONFIG_KALLSYMS
+	ulong base;
+
+	return symbol_lookup(addr, &base);
+#else
+	char *name;
+
+	if (initcall_name_count == ARRAY_SIZE(initcall_names))
+		return NULL;
+	name = initcall_names[initcall_name_count++];
+	snprintf(name, sizeof(initcall_names[0]), "initcall %#lx", addr);
+
+	return name;
+#endif
+}
+
+/*
+ * The first initcalls run before driver model is set up. With a driver-model
+ * timer, reading the time would try to probe the timer, so wait until it is
+ * ready.
+ */
+static bool initcall_timer_ready(void)
+{
+#if defined(CONFIG_TIMER) && !defined(CONFIG_TIMER_EARLY)
+	return gd->timer != NULL;
+#else
+	return true;
+#endif
+}
+#endif
+
 int initcall_run_list(const init_fnc_t init_sequence[])
 {
 	const init_fnc_t *init_fnc_ptr;
 
 	for (init_fnc_ptr = init_sequence; *init_fnc_ptr; ++init_fnc_ptr) {
 		unsigned long reloc_ofs = 0;
+		__maybe_unused bool timed = false;
+		__maybe_unused uint32_t start;
 		int ret;
 
 		if (gd->flags & GD_FLG_RELOC)
@@ -28,7 +75,17 @@ int initcall_run_list(const init_fnc_t init_sequence[])
 			debug(" (relocated to %p)\n", (char *)*init_fnc_ptr);
 		else
 			debug("\n");
+#ifdef CONFIG_BOOTSTAGE_INITCALL
+		timed = initcall_timer_ready();
+		if (timed)
+			start = timer_get_boot_us();
+#endif
 		ret = (*init_fnc_ptr)();
+#ifdef CONFIG_BOOTSTAGE_INITCALL
+		if (timed)
+			bootstage_add_duration(initcall_name(
+				(ulong)*init_fnc_ptr - reloc_ofs), start);
+#endif
 		if (ret) {
 			printf("initcall sequence %p failed at call %p (err=%d)\n",
 			       init_sequence,
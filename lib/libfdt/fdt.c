@@ -14,6 +14,75 @@
 
 #include "libfdt_internal.h"
 
+/* Number of trees whose writes are counted at once */
+#define FDT_GEN_SLOTS	4
+
+/**
+ * struct fdt_gen_slot - count of writes to one tree
+ *
+ * @blob:	Tree which is tracked, or NULL if the slot is unused
+ * @size:	Size of the tree when last looked up
+ * @gen:	Generation, which changes on each write to the tree
+ */
+struct fdt_gen_slot {
+	const void *blob;
+	int size;
+	unsigned int gen;
+};
+
+#ifdef USE_HOSTCC
+static struct fdt_gen_slot fdt_gen_slot[FDT_GEN_SLOTS];
+static unsigned int fdt_gen_next;
+static int fdt_gen_victim;
+#else
+/* These may be written before relocation, so keep them out of BSS */
+static struct fdt_gen_slot fdt_gen_slot[FDT_GEN_SLOTS]
+	__attribute__((section(".data")));
+static unsigned int fdt_gen_next __attribute__((section(".data")));
+static int fdt_gen_victim __attribute__((section(".data")));
+#endif
+
+unsigned int fdt_generation(const void *fdt)
+{
+	struct fdt_gen_slot *slot;
+	int i;
+
+	for (i = 0; i < FDT_GEN_SLOTS; i++) {
+		slot = &fdt_gen_slot[i];
+		if (slot->blob == fdt) {
+			slot->size = fdt_totalsize(fdt);
+			return slot->gen;
+		}
+	}
+
+	/*
+	 * Start tracking the tree. It gets a generation which has not been
+	 * used, so a caller which saw it before it was evicted from its slot
+	 * treats it as changed.
+	 */
+	slot = &fdt_gen_slot[fdt_gen_victim];
+	fdt_gen_victim = (fdt_gen_victim + 1) % FDT_GEN_SLOTS;
+	slot->blob = fdt;
+	slot->size = fdt_totalsize(fdt);
+	slot->gen = ++fdt_gen_next;
+
+	return slot->gen;
+}
+
+void _fdt_note_write(const void *start, int len)
+{
+	const char *ptr = start;
+	struct fdt_gen_slot *slot;
+	int i;
+
+	for (i = 0; i < FDT_GEN_SLOTS; i++) {
+		slot = &fdt_gen_slot[i];
+		if (slot->blob && ptr < (const char *)slot->blob + slot->size &&
+		    ptr + len > (const char *)slot->blob)
+			slot->gen = ++fdt_gen_next;
+	}
+}
+
 int fdt_check_header(const void *fdt)
 {
 	if (fdt_magic(fdt) == FDT_MAGIC) {
@@ -204,6 +273,7 @@ int fdt_move(const void *fdt, void *buf, int bufsize)
 	if (fdt_totalsize(fdt) > bufsize)
 		return -FDT_ERR_NOSPACE;
 
+	_fdt_note_write(buf, fdt_totalsize(fdt));
 	memmove(buf, fdt, fdt_totalsize(fdt));
 	return 0;
 }
@@ -30,6 +30,8 @@ static int _fdt_rw_check_header(void *fdt)
 {
 	FDT_CHECK_HEADER(fdt);
 
+	_fdt_note_write(fdt, fdt_totalsize(fdt));
+
 	if (fdt_version(fdt) < 17)
 		return -FDT_ERR_BADVERSION;
 	if (_fdt_blocks_misordered(fdt, sizeof(struct fdt_reserve_entry),
@@ -383,6 +385,7 @@ int fdt_open_into(const void *fdt, void *buf, int bufsize)
 
 	FDT_CHECK_HEADER(fdt);
 
+	_fdt_note_write(buf, bufsize);
 	mem_rsv_size = (fdt_num_mem_rsv(fdt)+1)
 		* sizeof(struct fdt_reserve_entry);
 
@@ -461,6 +464,7 @@ int fdt_remove_unused_strings(const void *old, void *new)
 	int tag = FDT_PROP;
 
 	/* Make a copy and remove the strings */
+	_fdt_note_write(new, size);
 	memcpy(new, old, size);
 	fdt_set_size_dt_strings(new, 0);
 
@@ -47,6 +47,7 @@ int fdt_create(void *buf, int bufsize)
 	if (bufsize < sizeof(struct fdt_header))
 		return -FDT_ERR_NOSPACE;
 
+	_fdt_note_write(buf, bufsize);
 	memset(buf, 0, bufsize);
 
 	fdt_set_magic(fdt, FDT_SW_MAGIC);
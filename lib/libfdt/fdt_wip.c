@@ -27,6 +27,7 @@ int fdt_setprop_inplace(void *fdt, int nodeoffset, const char *name,
 	if (proplen != len)
 		return -FDT_ERR_NOSPACE;
 
+	_fdt_note_write(propval, len);
 	memcpy(propval, val, len);
 	return 0;
 }
@@ -35,6 +36,7 @@ static void _fdt_nop_region(void *start, int len)
 {
 	fdt32_t *p;
 
+	_fdt_note_write(start, len);
 	for (p = start; (char *)p < ((char *)start + len); p++)
 		*p = cpu_to_fdt32(FDT_NOP);
 }
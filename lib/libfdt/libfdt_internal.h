@@ -22,6 +22,9 @@ int _fdt_check_prop_offset(const void *fdt, int offset);
 const char *_fdt_find_string(const char *strtab, int tabsize, const char *s);
 int _fdt_node_end_offset(void *fdt, int nodeoffset);
 
+/* Count a write to @len bytes at @start against the trees which it covers */
+void _fdt_note_write(const void *start, int len);
+
 static inline const void *_fdt_offset_ptr(const void *fdt, int offset)
 {
 	return (const char *)fdt + fdt_off_dt_struct(fdt) + offset;
@@ -8,7 +8,9 @@
  */
 
 #include <common.h>
+#include <errno.h>
 #include <lmb.h>
+#include <malloc.h>
 
 #define LMB_ALLOC_ANYWHERE	0
 
@@ -47,126 +49,118 @@ static long lmb_addrs_overlap(phys_addr_t base1,
 	return ((base1 < (base2+size2)) && (base2 < (base1+size1)));
 }
 
-static long lmb_addrs_adjacent(phys_addr_t base1, phys_size_t size1,
-		phys_addr_t base2, phys_size_t size2)
+/* Find the first region which ends after @addr, or rgn->cnt if none does */
+static unsigned long lmb_search(struct lmb_region *rgn, phys_addr_t addr)
 {
-	if (base2 == base1 + size1)
-		return 1;
-	else if (base1 == base2 + size2)
-		return -1;
+	unsigned long lo = 0, hi = rgn->cnt, mid;
+
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (rgn->region[mid].base + rgn->region[mid].size <= addr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
 
-	return 0;
+	return lo;
 }
 
-static long lmb_regions_adjacent(struct lmb_region *rgn,
-		unsigned long r1, unsigned long r2)
+static void lmb_remove_regions(struct lmb_region *rgn, unsigned long r,
+			       unsigned long count)
 {
-	phys_addr_t base1 = rgn->region[r1].base;
-	phys_size_t size1 = rgn->region[r1].size;
-	phys_addr_t base2 = rgn->region[r2].base;
-	phys_size_t size2 = rgn->region[r2].size;
-
-	return lmb_addrs_adjacent(base1, size1, base2, size2);
+	memmove(&rgn->region[r], &rgn->region[r + count],
+		(rgn->cnt - r - count) * sizeof(rgn->region[0]));
+	rgn->cnt -= count;
 }
 
-static void lmb_remove_region(struct lmb_region *rgn, unsigned long r)
+/* Make room for another region, moving to a larger array if needed */
+static int lmb_grow(struct lmb_region *rgn)
 {
-	unsigned long i;
+	struct lmb_property *region;
+	unsigned long max = rgn->max * 2;
 
-	for (i = r; i < rgn->cnt - 1; i++) {
-		rgn->region[i].base = rgn->region[i + 1].base;
-		rgn->region[i].size = rgn->region[i + 1].size;
+	if (rgn->cnt < rgn->max)
+		return 0;
+	if (rgn->region == rgn->initial) {
+		region = malloc(max * sizeof(*region));
+		if (region)
+			memcpy(region, rgn->initial, sizeof(rgn->initial));
+	} else {
+		region = realloc(rgn->region, max * sizeof(*region));
 	}
-	rgn->cnt--;
+	if (!region) {
+		printf("ERROR: No memory for %lu LMB regions\n", max);
+		return -ENOMEM;
+	}
+	rgn->region = region;
+	rgn->max = max;
+
+	return 0;
 }
 
-/* Assumption: base addr of region 1 < base addr of region 2 */
-static void lmb_coalesce_regions(struct lmb_region *rgn,
-		unsigned long r1, unsigned long r2)
+static void lmb_init_region(struct lmb_region *rgn)
 {
-	rgn->region[r1].size += rgn->region[r2].size;
-	lmb_remove_region(rgn, r2);
+	rgn->cnt = 0;
+	rgn->max = MAX_LMB_REGIONS;
+	rgn->size = 0;
+	rgn->region = rgn->initial;
 }
 
 void lmb_init(struct lmb *lmb)
 {
-	/* Create a dummy zero size LMB which will get coalesced away later.
-	 * This simplifies the lmb_add() code below...
-	 */
-	lmb->memory.region[0].base = 0;
-	lmb->memory.region[0].size = 0;
-	lmb->memory.cnt = 1;
-	lmb->memory.size = 0;
-
-	/* Ditto. */
-	lmb->reserved.region[0].base = 0;
-	lmb->reserved.region[0].size = 0;
-	lmb->reserved.cnt = 1;
-	lmb->reserved.size = 0;
+	lmb_init_region(&lmb->memory);
+	lmb_init_region(&lmb->reserved);
 }
 
-/* This routine called with relocation disabled. */
-static long lmb_add_region(struct lmb_region *rgn, phys_addr_t base, phys_size_t size)
+static void lmb_uninit_region(struct lmb_region *rgn)
 {
-	unsigned long coalesced = 0;
-	long adjacent, i;
+	if (rgn->region != rgn->initial)
+		free(rgn->region);
+	lmb_init_region(rgn);
+}
 
-	if ((rgn->cnt == 1) && (rgn->region[0].size == 0)) {
-		rgn->region[0].base = base;
-		rgn->region[0].size = size;
-		return 0;
-	}
+/* Free any regions allocated. This also works on a zeroed struct lmb. */
+void lmb_uninit(struct lmb *lmb)
+{
+	lmb_uninit_region(&lmb->memory);
+	lmb_uninit_region(&lmb->reserved);
+}
 
-	/* First try and coalesce this LMB with another. */
-	for (i=0; i < rgn->cnt; i++) {
-		phys_addr_t rgnbase = rgn->region[i].base;
-		phys_size_t rgnsize = rgn->region[i].size;
-
-		if ((rgnbase == base) && (rgnsize == size))
-			/* Already have this region, so we're done */
-			return 0;
-
-		adjacent = lmb_addrs_adjacent(base,size,rgnbase,rgnsize);
-		if ( adjacent > 0 ) {
-			rgn->region[i].base -= size;
-			rgn->region[i].size += size;
-			coalesced++;
-			break;
-		}
-		else if ( adjacent < 0 ) {
-			rgn->region[i].size += size;
-			coalesced++;
-			break;
-		}
-	}
+/*
+ * Add a region, merging it with any which it overlaps or touches so that
+ * the regions stay sorted and separate. This routine called with
+ * relocation disabled.
+ */
+static long lmb_add_region(struct lmb_region *rgn, phys_addr_t base, phys_size_t size)
+{
+	phys_addr_t end = base + size;
+	unsigned long i, j;
 
-	if ((i < rgn->cnt-1) && lmb_regions_adjacent(rgn, i, i+1) ) {
-		lmb_coalesce_regions(rgn, i, i+1);
-		coalesced++;
-	}
+	if (!size)
+		return 0;
 
-	if (coalesced)
-		return coalesced;
-	if (rgn->cnt >= MAX_LMB_REGIONS)
-		return -1;
+	/* The first region which ends at or after @base */
+	i = base ? lmb_search(rgn, base - 1) : 0;
 
-	/* Couldn't coalesce the LMB, so add it to the sorted table. */
-	for (i = rgn->cnt-1; i >= 0; i--) {
-		if (base < rgn->region[i].base) {
-			rgn->region[i+1].base = rgn->region[i].base;
-			rgn->region[i+1].size = rgn->region[i].size;
-		} else {
-			rgn->region[i+1].base = base;
-			rgn->region[i+1].size = size;
-			break;
-		}
+	/* Merge with each region which starts at or before @end */
+	for (j = i; j < rgn->cnt && rgn->region[j].base <= end; j++) {
+		end = max(end, rgn->region[j].base + rgn->region[j].size);
+		base = min(base, rgn->region[j].base);
 	}
-
-	if (base < rgn->region[0].base) {
-		rgn->region[0].base = base;
-		rgn->region[0].size = size;
+	if (j > i) {
+		rgn->region[i].base = base;
+		rgn->region[i].size = end - base;
+		lmb_remove_regions(rgn, i + 1, j - i - 1);
+		return j - i;
 	}
 
+	/* Couldn't coalesce the LMB, so add it to the sorted table. */
+	if (lmb_grow(rgn))
+		return -1;
+	memmove(&rgn->region[i + 1], &rgn->region[i],
+		(rgn->cnt - i) * sizeof(rgn->region[0]));
+	rgn->region[i].base = base;
+	rgn->region[i].size = size;
 	rgn->cnt++;
 
 	return 0;
@@ -185,26 +179,22 @@ long lmb_free(struct lmb *lmb, phys_addr_t base, phys_size_t size)
 	struct lmb_region *rgn = &(lmb->reserved);
 	phys_addr_t rgnbegin, rgnend;
 	phys_addr_t end = base + size;
-	int i;
-
-	rgnbegin = rgnend = 0; /* supress gcc warnings */
+	unsigned long i;
 
 	/* Find the region where (base, size) belongs to */
-	for (i=0; i < rgn->cnt; i++) {
-		rgnbegin = rgn->region[i].base;
-		rgnend = rgnbegin + rgn->region[i].size;
-
-		if ((rgnbegin <= base) && (end <= rgnend))
-			break;
-	}
+	i = lmb_search(rgn, base);
 
 	/* Didn't find the region */
 	if (i == rgn->cnt)
 		return -1;
+	rgnbegin = rgn->region[i].base;
+	rgnend = rgnbegin + rgn->region[i].size;
+	if ((rgnbegin > base) || (end > rgnend))
+		return -1;
 
 	/* Check to see if we are removing entire region */
 	if ((rgnbegin == base) && (rgnend == end)) {
-		lmb_remove_region(rgn, i);
+		lmb_remove_regions(rgn, i, 1);
 		return 0;
 	}
 
@@ -223,8 +213,11 @@ long lmb_free(struct lmb *lmb, phys_addr_t base, phys_size_t size)
 
 	/*
 	 * We need to split the entry -  adjust the current one to the
-	 * beginging of the hole and add the region after hole.
+	 * beginging of the hole and add the region after hole. Make room
+	 * first, so that the region is left alone if there is none.
 	 */
+	if (lmb_grow(rgn))
+		return -1;
 	rgn->region[i].size = base - rgn->region[i].base;
 	return lmb_add_region(rgn, end, rgnend - end);
 }
@@ -241,15 +234,13 @@ static long lmb_overlaps_region(struct lmb_region *rgn, phys_addr_t base,
 {
 	unsigned long i;
 
-	for (i=0; i < rgn->cnt; i++) {
-		phys_addr_t rgnbase = rgn->region[i].base;
-		phys_size_t rgnsize = rgn->region[i].size;
-		if ( lmb_addrs_overlap(base,size,rgnbase,rgnsize) ) {
-			break;
-		}
-	}
+	/* Later regions start after this one, so only it can overlap */
+	i = lmb_search(rgn, base);
+	if (i < rgn->cnt && lmb_addrs_overlap(base, size, rgn->region[i].base,
+					      rgn->region[i].size))
+		return i;
 
-	return (i < rgn->cnt) ? i : -1;
+	return -1;
 }
 
 phys_addr_t lmb_alloc(struct lmb *lmb, phys_size_t size, ulong align)
@@ -324,15 +315,12 @@ phys_addr_t __lmb_alloc_base(struct lmb *lmb, phys_size_t size, ulong align, phy
 
 int lmb_is_reserved(struct lmb *lmb, phys_addr_t addr)
 {
-	int i;
+	struct lmb_region *rgn = &lmb->reserved;
+	unsigned long i;
 
-	for (i = 0; i < lmb->reserved.cnt; i++) {
-		phys_addr_t upper = lmb->reserved.region[i].base +
-			lmb->reserved.region[i].size - 1;
-		if ((addr >= lmb->reserved.region[i].base) && (addr <= upper))
-			return 1;
-	}
-	return 0;
+	i = lmb_search(rgn, addr);
+
+	return i < rgn->cnt && rgn->region[i].base <= addr;
 }
 
 __weak void board_lmb_reserve(struct lmb *lmb)
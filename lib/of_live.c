@@ -0,0 +1,367 @@
+/*
+ * Live (unflattened) device tree
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <errno.h>
+#include <libfdt.h>
+#include <malloc.h>
+#include <of_live.h>
+
+DECLARE_GLOBAL_DATA_PTR;
+
+static bool of_live_is_phandle(const char *name)
+{
+	return !strcmp(name, "phandle") || !strcmp(name, "linux,phandle");
+}
+
+/**
+ * of_live_unflatten() - Walk the FDT and count or fill in the live tree
+ *
+ * When live->nodes is NULL this only counts the nodes, properties, phandles
+ * and aliases, so that the tree can be allocated in one block. Otherwise
+ * it fills in the nodes and properties, linking them together.
+ *
+ * @blob:		FDT to walk
+ * @live:		Live tree to count into, or fill in
+ * @prop_countp:	Returns the number of properties
+ * @phandle_countp:	Returns the number of phandle properties
+ * @return 0 if OK, -EINVAL if the FDT is invalid
+ */
+static int of_live_unflatten(const void *blob, struct of_live *live,
+			     int *prop_countp, int *phandle_countp)
+{
+	struct of_node *np = NULL, *prev = NULL, *sib;
+	int prop_count = 0, phandle_count = 0;
+	int offset, depth = -1, prev_depth = 0;
+	bool fill = live->nodes;
+	int i;
+
+	live->node_count = 0;
+	live->alias_count = 0;
+	for (offset = fdt_next_node(blob, -1, &depth);
+	     offset >= 0 && depth >= 0;
+	     offset = fdt_next_node(blob, offset, &depth)) {
+		const char *name = fdt_get_name(blob, offset, NULL);
+		bool aliases = depth == 1 && name && !strcmp(name, "aliases");
+		int prop_offset;
+
+		if (!name)
+			return -EINVAL;
+		if (fill) {
+			np = &live->nodes[live->node_count];
+			np->name = name;
+			np->offset = offset;
+			np->props = &live->props[prop_count];
+			if (!prev) {
+				/* This is the root node */
+			} else if (depth > prev_depth) {
+				np->parent = prev;
+				prev->child = np;
+			} else {
+				/* Go back up to the last node at this depth */
+				for (sib = prev, i = prev_depth; i > depth; i--)
+					sib = sib->parent;
+				sib->sibling = np;
+				np->parent = sib->parent;
+			}
+			if (aliases)
+				live->alias_node = np;
+			prev = np;
+			prev_depth = depth;
+		}
+		live->node_count++;
+
+		for (prop_offset = fdt_first_property_offset(blob, offset);
+		     prop_offset >= 0;
+		     prop_offset = fdt_next_property_offset(blob,
+							    prop_offset)) {
+			const char *prop_name;
+			const void *value;
+			int len;
+
+			value = fdt_getprop_by_offset(blob, prop_offset,
+						      &prop_name, &len);
+			if (!value)
+				return -EINVAL;
+			if (of_live_is_phandle(prop_name) && len == 4)
+				phandle_count++;
+			if (aliases && of_live_alias_is_path(value, len)) {
+				if (fill) {
+					struct of_alias *alias;
+
+					alias = &live->aliases[
+							live->alias_count];
+					alias->name = prop_name;
+					alias->leaf = strrchr(value, '/') + 1;
+					alias->id = trailing_strtol(prop_name);
+				}
+				live->alias_count++;
+			}
+			if (fill) {
+				struct of_prop *pp = &np->props[np->prop_count];
+
+				pp->name = prop_name;
+				pp->value = value;
+				pp->len = len;
+				np->prop_count++;
+				if (of_live_is_phandle(prop_name) && len == 4 &&
+				    (!np->phandle || !strcmp(prop_name,
+							     "phandle")))
+					np->phandle = fdt32_to_cpu(
+						*(fdt32_t *)value);
+			}
+			prop_count++;
+		}
+		if (prop_offset != -FDT_ERR_NOTFOUND)
+			return -EINVAL;
+	}
+	if (offset < 0 && offset != -FDT_ERR_NOTFOUND)
+		return -EINVAL;
+	*prop_countp = prop_count;
+	*phandle_countp = phandle_count;
+
+	return 0;
+}
+
+int of_live_build(const void *blob, struct of_live **livep)
+{
+	struct of_live count, *live;
+	int prop_count, phandle_count;
+	uint table_size;
+	size_t size;
+	int ret;
+	int i;
+
+	if (fdt_check_header(blob))
+		return -EINVAL;
+	memset(&count, '\0', sizeof(count));
+	ret = of_live_unflatten(blob, &count, &prop_count, &phandle_count);
+	if (ret)
+		return ret;
+	if (!count.node_count)
+		return -EINVAL;
+
+	/* Keep the phandle table at most half full */
+	for (table_size = 1; table_size < phandle_count * 2; table_size <<= 1)
+		;
+	size = sizeof(*live) + count.node_count * sizeof(struct of_node) +
+		prop_count * sizeof(struct of_prop) +
+		table_size * sizeof(struct of_node *) +
+		count.alias_count * sizeof(struct of_alias);
+	live = calloc(1, size);
+	if (!live)
+		return -ENOMEM;
+	live->blob = blob;
+	live->generation = fdt_generation(blob);
+	live->nodes = (struct of_node *)(live + 1);
+	live->props = (struct of_prop *)(live->nodes + count.node_count);
+	live->phandles = (struct of_node **)(live->props + prop_count);
+	live->phandle_mask = table_size - 1;
+	live->aliases = (struct of_alias *)(live->phandles + table_size);
+	ret = of_live_unflatten(blob, live, &prop_count, &phandle_count);
+	if (ret) {
+		free(live);
+		return ret;
+	}
+
+	/* Nodes are added in offset order, so the first one wins as in libfdt */
+	for (i = 0; i < live->node_count; i++) {
+		struct of_node *np = &live->nodes[i];
+		uint slot;
+
+		if (!np->phandle)
+			continue;
+		for (slot = np->phandle & live->phandle_mask;
+		     live->phandles[slot];
+		     slot = (slot + 1) & live->phandle_mask)
+			;
+		live->phandles[slot] = np;
+	}
+	debug("%s: %d nodes, %d properties, %d aliases, %zu bytes\n", __func__,
+	      live->node_count, prop_count, live->alias_count, size);
+	*livep = live;
+
+	return 0;
+}
+
+void of_live_free(struct of_live *live)
+{
+	free(live);
+}
+
+struct of_live *of_live_get(const void *blob)
+{
+	struct of_live *live = gd->of_live;
+
+	if (!live || live->blob != blob)
+		return NULL;
+
+	/* Offsets and values may be out of date once the FDT is written */
+	if (live->generation != fdt_generation(blob)) {
+		debug("%s: FDT has changed, dropping live tree\n", __func__);
+		gd->of_live = NULL;
+		of_live_free(live);
+		return NULL;
+	}
+
+	return live;
+}
+
+struct of_node *of_live_node(const struct of_live *live, int offset)
+{
+	int low = 0, high = live->node_count - 1;
+
+	while (low <= high) {
+		int mid = (low + high) / 2;
+		struct of_node *np = &live->nodes[mid];
+
+		if (np->offset == offset)
+			return np;
+		if (np->offset < offset)
+			low = mid + 1;
+		else
+			high = mid - 1;
+	}
+
+	return NULL;
+}
+
+const void *of_live_getprop(const struct of_node *np, const char *name,
+			    int *lenp)
+{
+	int i;
+
+	for (i = 0; i < np->prop_count; i++) {
+		const struct of_prop *pp = &np->props[i];
+
+		if (!strcmp(pp->name, name)) {
+			if (lenp)
+				*lenp = pp->len;
+			return pp->value;
+		}
+	}
+	if (lenp)
+		*lenp = -FDT_ERR_NOTFOUND;
+
+	return NULL;
+}
+
+int of_live_node_by_phandle(const struct of_live *live, uint32_t phandle)
+{
+	uint slot;
+
+	if (!phandle || phandle == (uint32_t)-1)
+		return -FDT_ERR_BADPHANDLE;
+	for (slot = phandle & live->phandle_mask;
+	     live->phandles[slot];
+	     slot = (slot + 1) & live->phandle_mask) {
+		if (live->phandles[slot]->phandle == phandle)
+			return live->phandles[slot]->offset;
+	}
+
+	return -FDT_ERR_NOTFOUND;
+}
+
+int of_live_parent_offset(const struct of_live *live, int offset)
+{
+	const struct of_node *np = of_live_node(live, offset);
+
+	if (!np)
+		return -FDT_ERR_BADOFFSET;
+	if (!np->parent)
+		return -FDT_ERR_NOTFOUND;
+
+	return np->parent->offset;
+}
+
+/* Match a path component in the same way as libfdt */
+static bool of_live_name_eq(const char *name, const char *s, int len)
+{
+	if (strncmp(name, s, len))
+		return false;
+	if (!name[len])
+		return true;
+
+	return name[len] == '@' && !memchr(s, '@', len);
+}
+
+/* Find the end of a path component */
+static const char *of_live_path_sep(const char *path)
+{
+	while (*path && *path != '/' && *path != ':')
+		path++;
+
+	return path;
+}
+
+int of_live_path_offset(const struct of_live *live, const char *path)
+{
+	const struct of_node *np = &live->nodes[0];
+	const char *p = path;
+
+	if (*path != '/') {
+		const char *q = of_live_path_sep(path);
+		const char *alias = NULL;
+		int i;
+
+		for (i = 0; live->alias_node && i < live->alias_node->prop_count;
+		     i++) {
+			const struct of_prop *pp = &live->alias_node->props[i];
+
+			if (!strncmp(pp->name, p, q - p) && !pp->name[q - p]) {
+				alias = pp->value;
+				break;
+			}
+		}
+		if (!alias)
+			return -FDT_ERR_BADPATH;
+		np = of_live_node(live, of_live_path_offset(live, alias));
+		if (!np)
+			return -FDT_ERR_NOTFOUND;
+		p = q;
+	}
+
+	while (*p) {
+		const char *q;
+
+		while (*p == '/')
+			p++;
+		if (*p == '\0' || *p == ':')
+			break;
+		q = of_live_path_sep(p);
+		for (np = np->child; np; np = np->sibling) {
+			if (of_live_name_eq(np->name, p, q - p))
+				break;
+		}
+		if (!np)
+			return -FDT_ERR_NOTFOUND;
+		p = q;
+	}
+
+	return np->offset;
+}
+
+int of_live_alias_seq(const struct of_live *live, const char *base,
+		      int offset, int *seqp)
+{
+	const struct of_node *np = of_live_node(live, offset);
+	int base_len = strlen(base);
+	int i;
+
+	if (!np)
+		return -ENOENT;
+	for (i = 0; i < live->alias_count; i++) {
+		const struct of_alias *alias = &live->aliases[i];
+
+		if (strncmp(alias->name, base, base_len) ||
+		    strcmp(alias->leaf, np->name) || alias->id == -1)
+			continue;
+		*seqp = alias->id;
+		return 0;
+	}
+
+	return -ENOENT;
+}
@@ -24,6 +24,32 @@
 /* Default public exponent for backward compatibility */
 #define RSA_DEFAULT_PUBEXP	65537
 
+/* Number of parsed key nodes to remember */
+#define RSA_KEY_CACHE_SIZE	4
+
+/**
+ * struct rsa_key_cache - parsed properties of a key node
+ *
+ * Verifying several configurations and images looks up the same key nodes
+ * over and over, so the parsed properties are kept here. Entries are matched
+ * on the blob and node offset, and are ignored once libfdt writes to their
+ * blob, since the properties point into it.
+ *
+ * @blob:	FDT blob containing the key, NULL if the entry is unused
+ * @gen:	fdt_generation() of @blob when the entry was added
+ * @node:	Offset of the key node
+ * @prop:	Key properties parsed from the node
+ */
+struct rsa_key_cache {
+	const void *blob;
+	unsigned int gen;
+	int node;
+	struct key_prop prop;
+};
+
+static struct rsa_key_cache rsa_key_cache[RSA_KEY_CACHE_SIZE];
+static int rsa_key_cache_next;
+
 /**
  * rsa_verify_key() - Verify a signature against some data using RSA Key
  *
@@ -121,15 +147,27 @@ static int rsa_verify_with_keynode(struct image_sign_info *info,
 				   uint sig_len, int node)
 {
 	const void *blob = info->fdt_blob;
+	struct rsa_key_cache *entry;
 	struct key_prop prop;
+	unsigned int gen;
 	int length;
 	int ret = 0;
+	int i;
 
 	if (node < 0) {
 		debug("%s: Skipping invalid node", __func__);
 		return -EBADF;
 	}
 
+	gen = fdt_generation(blob);
+	for (i = 0; i < RSA_KEY_CACHE_SIZE; i++) {
+		entry = &rsa_key_cache[i];
+		if (entry->blob == blob && entry->gen == gen &&
+		    entry->node == node)
+			return rsa_verify_key(&entry->prop, sig, sig_len, hash,
+					      info->algo->checksum);
+	}
+
 	prop.num_bits = fdtdec_get_int(blob, node, "rsa,num-bits", 0);
 
 	prop.n0inv = fdtdec_get_int(blob, node, "rsa,n0-inverse", 0);
@@ -149,6 +187,13 @@ static int rsa_verify_with_keynode(struct image_sign_info *info,
 		return -EFAULT;
 	}
 
+	entry = &rsa_key_cache[rsa_key_cache_next];
+	rsa_key_cache_next = (rsa_key_cache_next + 1) % RSA_KEY_CACHE_SIZE;
+	entry->blob = blob;
+	entry->gen = gen;
+	entry->node = node;
+	entry->prop = prop;
+
 	ret = rsa_verify_key(&prop, sig, sig_len, hash, info->algo->checksum);
 
 	return ret;
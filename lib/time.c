@@ -8,6 +8,7 @@
 #include <common.h>
 #include <dm.h>
 #include <errno.h>
+#include <serial.h>
 #include <timer.h>
 #include <watchdog.h>
 #include <div64.h>
@@ -147,6 +148,8 @@ void udelay(unsigned long usec)
 {
 	ulong kv;
 
+	/* use the time to send any buffered console output */
+	serial_poll_tx();
 	do {
 		WATCHDOG_RESET();
 		kv = usec > CONFIG_WD_PERIOD ? CONFIG_WD_PERIOD : usec;
@@ -0,0 +1,499 @@
+/*
+ * Two-level segregated fit (TLSF) memory allocator
+ *
+ * Based on the description in "TLSF: a New Dynamic Memory Allocator for
+ * Real-Time Systems" by M. Masmano, I. Ripoll, A. Crespo and J. Real.
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <errno.h>
+#include <tlsf.h>
+#include <linux/bitops.h>
+
+/* Allocations are aligned to two words, which is also the header size */
+#define TLSF_ALIGN_SHIFT	(sizeof(size_t) == 8 ? 4 : 3)
+#define TLSF_ALIGN		(1UL << TLSF_ALIGN_SHIFT)
+
+/* Number of second-level lists for each first-level size range */
+#define TLSF_SL_SHIFT		5
+#define TLSF_SL_COUNT		(1 << TLSF_SL_SHIFT)
+
+/*
+ * Blocks smaller than TLSF_SMALL_SIZE all go in the first first-level list,
+ * with the second level split into steps of TLSF_ALIGN. Each later
+ * first-level list covers a power of two, up to blocks of 1 << TLSF_FL_MAX.
+ */
+#define TLSF_FL_SHIFT		(TLSF_SL_SHIFT + TLSF_ALIGN_SHIFT)
+#define TLSF_SMALL_SIZE		(1UL << TLSF_FL_SHIFT)
+#define TLSF_FL_MAX		(sizeof(size_t) == 8 ? 40 : 31)
+#define TLSF_FL_COUNT		(TLSF_FL_MAX - TLSF_FL_SHIFT + 1)
+#define TLSF_MAX_SIZE		(1UL << (TLSF_FL_MAX - 1))
+
+/* Flag in the size of a block */
+#define TLSF_FREE		1UL
+
+/**
+ * struct tlsf_block - A block of memory in the pool
+ *
+ * @prev_phys:	Block just before this one in memory, NULL if none
+ * @size:	Size of the memory after the header, with TLSF_FREE if free
+ * @next_free:	Next block in the free list (only valid when free)
+ * @prev_free:	Previous block in the free list (only valid when free)
+ */
+struct tlsf_block {
+	struct tlsf_block *prev_phys;
+	size_t size;
+	struct tlsf_block *next_free;
+	struct tlsf_block *prev_free;
+};
+
+#define TLSF_HDR_SIZE		offsetof(struct tlsf_block, next_free)
+#define TLSF_MIN_SIZE		(sizeof(struct tlsf_block) - TLSF_HDR_SIZE)
+#define TLSF_MIN_BLOCK		sizeof(struct tlsf_block)
+
+/**
+ * struct tlsf - Control structure of a pool
+ *
+ * @fl_bitmap:	Bit n set if any list in @sl_bitmap[n] has blocks
+ * @sl_bitmap:	Bit n of entry m set if @free[m][n] has blocks
+ * @free:	Lists of free blocks
+ * @first:	First block in the pool; the last is a zero-sized block which
+ *		is always allocated
+ * @size:	Bytes available for blocks
+ * @free_bytes:	Bytes in free blocks, including headers
+ * @max_used:	Highest number of bytes used so far
+ * @used_blocks: Number of allocated blocks
+ * @free_blocks: Number of free blocks
+ */
+struct tlsf {
+	u32 fl_bitmap;
+	u32 sl_bitmap[TLSF_FL_COUNT];
+	struct tlsf_block *free[TLSF_FL_COUNT][TLSF_SL_COUNT];
+	struct tlsf_block *first;
+	size_t size;
+	size_t free_bytes;
+	size_t max_used;
+	uint used_blocks;
+	uint free_blocks;
+};
+
+static inline size_t block_size(struct tlsf_block *block)
+{
+	return block->size & ~TLSF_FREE;
+}
+
+static inline bool block_is_free(struct tlsf_block *block)
+{
+	return block->size & TLSF_FREE;
+}
+
+static inline void *block_to_ptr(struct tlsf_block *block)
+{
+	return (char *)block + TLSF_HDR_SIZE;
+}
+
+static inline struct tlsf_block *ptr_to_block(void *ptr)
+{
+	return (struct tlsf_block *)((char *)ptr - TLSF_HDR_SIZE);
+}
+
+static inline struct tlsf_block *block_next(struct tlsf_block *block)
+{
+	return (struct tlsf_block *)((char *)block_to_ptr(block) +
+				     block_size(block));
+}
+
+/* Work out which list a block of a given size belongs in */
+static void tlsf_mapping(size_t size, int *flp, int *slp)
+{
+	int bit;
+
+	if (size < TLSF_SMALL_SIZE) {
+		*flp = 0;
+		*slp = size >> TLSF_ALIGN_SHIFT;
+	} else {
+		bit = fls_long(size) - 1;
+		*flp = bit - TLSF_FL_SHIFT + 1;
+		*slp = (size >> (bit - TLSF_SL_SHIFT)) - TLSF_SL_COUNT;
+	}
+}
+
+static void tlsf_insert(struct tlsf *tlsf, struct tlsf_block *block)
+{
+	struct tlsf_block **head;
+	int fl, sl;
+
+	tlsf_mapping(block_size(block), &fl, &sl);
+	head = &tlsf->free[fl][sl];
+	block->prev_free = NULL;
+	block->next_free = *head;
+	if (*head)
+		(*head)->prev_free = block;
+	*head = block;
+	tlsf->fl_bitmap |= 1U << fl;
+	tlsf->sl_bitmap[fl] |= 1U << sl;
+	tlsf->free_bytes += block_size(block) + TLSF_HDR_SIZE;
+	tlsf->free_blocks++;
+}
+
+static void tlsf_remove(struct tlsf *tlsf, struct tlsf_block *block)
+{
+	int fl, sl;
+
+	if (block->next_free)
+		block->next_free->prev_free = block->prev_free;
+	if (block->prev_free) {
+		block->prev_free->next_free = block->next_free;
+	} else {
+		/* Only the head of a list needs to know which list it is in */
+		tlsf_mapping(block_size(block), &fl, &sl);
+		tlsf->free[fl][sl] = block->next_free;
+		if (!block->next_free) {
+			tlsf->sl_bitmap[fl] &= ~(1U << sl);
+			if (!tlsf->sl_bitmap[fl])
+				tlsf->fl_bitmap &= ~(1U << fl);
+		}
+	}
+	tlsf->free_bytes -= block_size(block) + TLSF_HDR_SIZE;
+	tlsf->free_blocks--;
+}
+
+/* Find a free block of at least @size bytes, without removing it */
+static struct tlsf_block *tlsf_find(struct tlsf *tlsf, size_t size)
+{
+	int fl, sl, bit;
+	u32 map;
+
+	/* Round up so that every block in the list is big enough */
+	if (size < TLSF_SMALL_SIZE) {
+		fl = 0;
+		sl = size >> TLSF_ALIGN_SHIFT;
+	} else {
+		bit = fls_long(size) - 1;
+		size += (1UL << (bit - TLSF_SL_SHIFT)) - 1;
+		if (size >> (bit + 1))
+			bit++;
+		fl = bit - TLSF_FL_SHIFT + 1;
+		sl = (size >> (bit - TLSF_SL_SHIFT)) - TLSF_SL_COUNT;
+		if (fl >= TLSF_FL_COUNT)
+			return NULL;
+	}
+
+	map = tlsf->sl_bitmap[fl] & (~0U << sl);
+	if (!map) {
+		if (fl + 1 >= TLSF_FL_COUNT)
+			return NULL;
+		map = tlsf->fl_bitmap & (~0U << (fl + 1));
+		if (!map)
+			return NULL;
+		fl = ffs(map) - 1;
+		map = tlsf->sl_bitmap[fl];
+	}
+	sl = ffs(map) - 1;
+
+	return tlsf->free[fl][sl];
+}
+
+/* Free a block, merging it with its neighbours if they are free */
+static void tlsf_release(struct tlsf *tlsf, struct tlsf_block *block)
+{
+	struct tlsf_block *next = block_next(block);
+	struct tlsf_block *prev = block->prev_phys;
+
+	if (block_is_free(next)) {
+		tlsf_remove(tlsf, next);
+		block->size += block_size(next) + TLSF_HDR_SIZE;
+	}
+	if (prev && block_is_free(prev)) {
+		tlsf_remove(tlsf, prev);
+		prev->size = block_size(prev) + block_size(block) +
+			TLSF_HDR_SIZE;
+		block = prev;
+	}
+	block->size |= TLSF_FREE;
+	block_next(block)->prev_phys = block;
+	tlsf_insert(tlsf, block);
+}
+
+/* Free the end of an allocated block if it is bigger than @size */
+static void tlsf_trim(struct tlsf *tlsf, struct tlsf_block *block,
+		      size_t size)
+{
+	struct tlsf_block *rest;
+	size_t spare = block_size(block) - size;
+
+	if (spare < TLSF_MIN_BLOCK)
+		return;
+	rest = (struct tlsf_block *)((char *)block_to_ptr(block) + size);
+	rest->prev_phys = block;
+	rest->size = spare - TLSF_HDR_SIZE;
+	block->size = size;
+	block_next(rest)->prev_phys = rest;
+	tlsf_release(tlsf, rest);
+}
+
+static void tlsf_update_used(struct tlsf *tlsf)
+{
+	size_t used = tlsf->size - tlsf->free_bytes;
+
+	if (used > tlsf->max_used)
+		tlsf->max_used = used;
+}
+
+/* Get the block size for a request, or 0 if it is too large */
+static size_t tlsf_adjust_size(size_t size)
+{
+	if (size > TLSF_MAX_SIZE)
+		return 0;
+	size = ALIGN(size, TLSF_ALIGN);
+
+	return max(size, TLSF_MIN_SIZE);
+}
+
+struct tlsf *tlsf_create(void *mem, size_t size)
+{
+	struct tlsf_block *block, *end;
+	struct tlsf *tlsf;
+	ulong start, limit;
+
+	start = ALIGN((ulong)mem, TLSF_ALIGN);
+	limit = ((ulong)mem + size) & ~(TLSF_ALIGN - 1);
+	if (limit < start + sizeof(*tlsf) + TLSF_MIN_BLOCK + TLSF_HDR_SIZE)
+		return NULL;
+	tlsf = (struct tlsf *)start;
+	memset(tlsf, '\0', sizeof(*tlsf));
+
+	block = (struct tlsf_block *)ALIGN(start + sizeof(*tlsf), TLSF_ALIGN);
+	end = (struct tlsf_block *)(limit - TLSF_HDR_SIZE);
+	block->prev_phys = NULL;
+	block->size = (ulong)end - (ulong)block - TLSF_HDR_SIZE;
+	end->prev_phys = block;
+	end->size = 0;
+	tlsf->first = block;
+	tlsf->size = (ulong)end - (ulong)block;
+	tlsf_release(tlsf, block);
+
+	return tlsf;
+}
+
+/* Take a free block for use, trimming it to @size */
+static void *tlsf_use(struct tlsf *tlsf, struct tlsf_block *block,
+		      size_t size)
+{
+	tlsf_remove(tlsf, block);
+	block->size = block_size(block);
+	tlsf_trim(tlsf, block, size);
+	tlsf->used_blocks++;
+	tlsf_update_used(tlsf);
+
+	return block_to_ptr(block);
+}
+
+void *tlsf_malloc(struct tlsf *tlsf, size_t size)
+{
+	struct tlsf_block *block;
+
+	size = tlsf_adjust_size(size);
+	if (!size)
+		return NULL;
+	block = tlsf_find(tlsf, size);
+	if (!block)
+		return NULL;
+
+	return tlsf_use(tlsf, block, size);
+}
+
+void *tlsf_memalign(struct tlsf *tlsf, size_t align, size_t size)
+{
+	struct tlsf_block *block, *aligned;
+	size_t gap;
+	ulong ptr;
+
+	if (align <= TLSF_ALIGN)
+		return tlsf_malloc(tlsf, size);
+	size = tlsf_adjust_size(size);
+	if (!size || align > TLSF_MAX_SIZE)
+		return NULL;
+
+	/* Leave room for a free block in front of the aligned one */
+	block = tlsf_find(tlsf, size + align + TLSF_MIN_BLOCK);
+	if (!block)
+		return NULL;
+	ptr = ALIGN((ulong)block_to_ptr(block), align);
+	gap = ptr - (ulong)block_to_ptr(block);
+	if (!gap)
+		return tlsf_use(tlsf, block, size);
+	if (gap < TLSF_MIN_BLOCK) {
+		ptr += align;
+		gap += align;
+	}
+
+	/* Split off the front, which stays free */
+	tlsf_remove(tlsf, block);
+	aligned = ptr_to_block((void *)ptr);
+	aligned->prev_phys = block;
+	aligned->size = block_size(block) - gap;
+	block_next(aligned)->prev_phys = aligned;
+	block->size = (gap - TLSF_HDR_SIZE) | TLSF_FREE;
+	tlsf_insert(tlsf, block);
+
+	tlsf_trim(tlsf, aligned, size);
+	tlsf->used_blocks++;
+	tlsf_update_used(tlsf);
+
+	return (void *)ptr;
+}
+
+void *tlsf_realloc(struct tlsf *tlsf, void *ptr, size_t size)
+{
+	struct tlsf_block *block, *next;
+	size_t want;
+	void *new;
+
+	if (!ptr)
+		return tlsf_malloc(tlsf, size);
+	want = tlsf_adjust_size(size);
+	if (!want)
+		return NULL;
+
+	block = ptr_to_block(ptr);
+	if (want > block_size(block)) {
+		next = block_next(block);
+		if (!block_is_free(next) || block_size(block) + TLSF_HDR_SIZE +
+		    block_size(next) < want) {
+			new = tlsf_malloc(tlsf, size);
+			if (!new)
+				return NULL;
+			memcpy(new, ptr, block_size(block));
+			tlsf_free(tlsf, ptr);
+
+			return new;
+		}
+
+		/* Grow into the next block */
+		tlsf_remove(tlsf, next);
+		block->size += block_size(next) + TLSF_HDR_SIZE;
+		block_next(block)->prev_phys = block;
+	}
+	tlsf_trim(tlsf, block, want);
+	tlsf_update_used(tlsf);
+
+	return ptr;
+}
+
+void tlsf_free(struct tlsf *tlsf, void *ptr)
+{
+	struct tlsf_block *block;
+
+	if (!ptr)
+		return;
+	block = ptr_to_block(ptr);
+	if (block_is_free(block)) {
+		debug("%s: %p is already free\n", __func__, ptr);
+		return;
+	}
+	tlsf->used_blocks--;
+	tlsf_release(tlsf, block);
+}
+
+size_t tlsf_block_size(void *ptr)
+{
+	return block_size(ptr_to_block(ptr));
+}
+
+void tlsf_get_info(struct tlsf *tlsf, struct tlsf_info *info)
+{
+	struct tlsf_block *block;
+	int fl, sl;
+
+	info->size = tlsf->size;
+	info->free = tlsf->free_bytes;
+	info->used = tlsf->size - tlsf->free_bytes;
+	info->max_used = tlsf->max_used;
+	info->used_blocks = tlsf->used_blocks;
+	info->free_blocks = tlsf->free_blocks;
+
+	/* The largest block is in the highest list which has any */
+	info->largest_free = 0;
+	if (!tlsf->fl_bitmap)
+		return;
+	fl = fls(tlsf->fl_bitmap) - 1;
+	sl = fls(tlsf->sl_bitmap[fl]) - 1;
+	for (block = tlsf->free[fl][sl]; block; block = block->next_free)
+		info->largest_free = max(info->largest_free, block_size(block));
+}
+
+void tlsf_walk(struct tlsf *tlsf,
+	       void (*func)(void *ptr, size_t size, bool used, void *priv),
+	       void *priv)
+{
+	struct tlsf_block *block;
+
+	for (block = tlsf->first; block_size(block); block = block_next(block))
+		func(block_to_ptr(block), block_size(block),
+		     !block_is_free(block), priv);
+}
+
+int tlsf_check(struct tlsf *tlsf)
+{
+	struct tlsf_block *block, *prev = NULL, *item;
+	uint used_blocks = 0, free_blocks = 0;
+	size_t total = 0, free_bytes = 0;
+	int fl, sl;
+
+	for (block = tlsf->first; block_size(block);
+	     block = block_next(block)) {
+		if (block->prev_phys != prev ||
+		    block_size(block) & (TLSF_ALIGN - 1) ||
+		    block_size(block) < TLSF_MIN_SIZE)
+			return -EINVAL;
+		total += block_size(block) + TLSF_HDR_SIZE;
+		if (total > tlsf->size)
+			return -EINVAL;
+		if (!block_is_free(block)) {
+			used_blocks++;
+		} else {
+			/* Free neighbours are always merged */
+			if (prev && block_is_free(prev))
+				return -EINVAL;
+			tlsf_mapping(block_size(block), &fl, &sl);
+			for (item = tlsf->free[fl][sl]; item != block;
+			     item = item->next_free) {
+				if (!item)
+					return -EINVAL;
+			}
+			free_blocks++;
+			free_bytes += block_size(block) + TLSF_HDR_SIZE;
+		}
+		prev = block;
+	}
+	if (block->prev_phys != prev || total != tlsf->size ||
+	    used_blocks != tlsf->used_blocks ||
+	    free_blocks != tlsf->free_blocks ||
+	    free_bytes != tlsf->free_bytes)
+		return -EINVAL;
+
+	/* Each list has only free blocks of the right size */
+	for (fl = 0; fl < TLSF_FL_COUNT; fl++) {
+		for (sl = 0; sl < TLSF_SL_COUNT; sl++) {
+			bool set = tlsf->sl_bitmap[fl] & (1U << sl);
+			int bfl, bsl;
+
+			if (set != !!tlsf->free[fl][sl])
+				return -EINVAL;
+			for (item = tlsf->free[fl][sl]; item;
+			     item = item->next_free) {
+				tlsf_mapping(block_size(item), &bfl, &bsl);
+				if (!block_is_free(item) || bfl != fl ||
+				    bsl != sl)
+					return -EINVAL;
+			}
+		}
+		if (!(tlsf->fl_bitmap & (1U << fl)) != !tlsf->sl_bitmap[fl])
+			return -EINVAL;
+	}
+
+	return 0;
+}
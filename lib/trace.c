@@ -15,6 +15,23 @@ DECLARE_GLOBAL_DATA_PTR;
 static char trace_enabled __attribute__((section(".data")));
 static char trace_inited __attribute__((section(".data")));
 
+#ifndef CONFIG_TRACE_CALL_DEPTH_LIMIT
+#define CONFIG_TRACE_CALL_DEPTH_LIMIT		15
+#endif
+
+#ifndef CONFIG_TRACE_EARLY_CALL_DEPTH_LIMIT
+#define CONFIG_TRACE_EARLY_CALL_DEPTH_LIMIT	200
+#endif
+
+#ifndef CONFIG_TRACE_MODE
+#define CONFIG_TRACE_MODE			TRACE_MODE_CALLS
+#endif
+
+enum {
+	/* Deepest call whose entry time we can keep, for function times */
+	TRACE_MAX_DEPTH		= 64,
+};
+
 /* The header block at the start of the trace memory area */
 struct trace_hdr {
 	int func_count;		/* Total number of function call sites */
@@ -28,6 +45,12 @@ struct trace_hdr {
 	 */
 	uintptr_t *call_accum;
 
+	/*
+	 * Total time spent in each function in microseconds, indexed in the
+	 * same way, or NULL if not enabled (see CONFIG_TRACE_FUNC_TIME)
+	 */
+	uint32_t *func_time;
+
 	/* Function trace list */
 	struct trace_call *ftrace;	/* The function call records */
 	ulong ftrace_size;	/* Num. of ftrace records we have space for */
@@ -37,10 +60,23 @@ struct trace_hdr {
 	int depth;
 	int depth_limit;
 	int max_depth;
+
+	enum trace_mode mode;	/* What to record */
+
+	/* Only functions in this range are traced, unless range_end is 0 */
+	ulong range_start;
+	ulong range_end;
+
+	/* Entry time of the function at each depth, for func_time */
+	uint32_t entry_time[TRACE_MAX_DEPTH];
 };
 
 static struct trace_hdr *hdr;	/* Pointer to start of trace buffer */
 
+static const char *const trace_mode_name[TRACE_MODE_COUNT] = {
+	"calls", "ring", "funcs",
+};
+
 static inline uintptr_t __attribute__((no_instrument_function))
 		func_ptr_to_num(void *func_ptr)
 {
@@ -58,22 +94,51 @@ static inline uintptr_t __attribute__((no_instrument_function))
 }
 
 static void __attribute__((no_instrument_function)) add_ftrace(void *func_ptr,
-				void *caller, ulong flags)
+				void *caller, ulong flags, ulong now)
 {
-	if (hdr->depth > hdr->depth_limit) {
-		hdr->ftrace_too_deep_count++;
-		return;
-	}
-	if (hdr->ftrace_count < hdr->ftrace_size) {
-		struct trace_call *rec = &hdr->ftrace[hdr->ftrace_count];
+	struct trace_call *rec;
+	ulong pos = hdr->ftrace_count;
 
-		rec->func = func_ptr_to_num(func_ptr);
-		rec->caller = func_ptr_to_num(caller);
-		rec->flags = flags | (timer_get_us() & FUNCF_TIMESTAMP_MASK);
+	if (pos >= hdr->ftrace_size) {
+		if (hdr->mode != TRACE_MODE_RING) {
+			hdr->ftrace_count++;
+			return;
+		}
+		pos %= hdr->ftrace_size;
 	}
+	rec = &hdr->ftrace[pos];
+	rec->func = func_ptr_to_num(func_ptr);
+	rec->caller = func_ptr_to_num(caller);
+	rec->flags = flags | (now & FUNCF_TIMESTAMP_MASK);
 	hdr->ftrace_count++;
 }
 
+/**
+ * Check whether a function should be traced
+ *
+ * @param func	Function number, from func_ptr_to_num()
+ * @return true if it is within the range set by trace_set_range()
+ */
+static inline bool __attribute__((no_instrument_function))
+		trace_wanted(ulong func)
+{
+	return !hdr->range_end ||
+		(func >= hdr->range_start && func < hdr->range_end);
+}
+
+/**
+ * Check whether we need the time on entry to or exit from a function
+ *
+ * Reading the timer is the most expensive part of tracing, so we avoid it
+ * if we are only counting calls.
+ *
+ * @return true if the time is needed
+ */
+static inline bool __attribute__((no_instrument_function)) trace_timed(void)
+{
+	return hdr->mode != TRACE_MODE_FUNCS || hdr->func_time;
+}
+
 static void __attribute__((no_instrument_function)) add_textbase(void)
 {
 	if (hdr->ftrace_count < hdr->ftrace_size) {
@@ -101,16 +166,27 @@ void __attribute__((no_instrument_function)) __cyg_profile_func_enter(
 	if (trace_enabled) {
 		int func;
 
-		add_ftrace(func_ptr, caller, FUNCF_ENTRY);
 		func = func_ptr_to_num(func_ptr);
+		if (!trace_wanted(func))
+			return;
 		if (func < hdr->func_count) {
 			hdr->call_accum[func]++;
 			hdr->call_count++;
 		} else {
 			hdr->untracked_count++;
 		}
+		if (hdr->depth > hdr->depth_limit) {
+			hdr->ftrace_too_deep_count++;
+		} else if (trace_timed()) {
+			ulong now = timer_get_us();
+
+			if (hdr->mode != TRACE_MODE_FUNCS)
+				add_ftrace(func_ptr, caller, FUNCF_ENTRY, now);
+			if (hdr->depth >= 0 && hdr->depth < TRACE_MAX_DEPTH)
+				hdr->entry_time[hdr->depth] = now;
+		}
 		hdr->depth++;
-		if (hdr->depth > hdr->depth_limit)
+		if (hdr->depth > hdr->max_depth)
 			hdr->max_depth = hdr->depth;
 	}
 }
@@ -118,7 +194,8 @@ void __attribute__((no_instrument_function)) __cyg_profile_func_enter(
 /**
  * This is called on every function exit
  *
- * We do nothing here.
+ * We add to the function's time and to the list of called functions, if
+ * these are being recorded.
  *
  * @param func_ptr	Pointer to function being entered
  * @param caller	Pointer to function which called this function
@@ -127,8 +204,21 @@ void __attribute__((no_instrument_function)) __cyg_profile_func_exit(
 		void *func_ptr, void *caller)
 {
 	if (trace_enabled) {
-		add_ftrace(func_ptr, caller, FUNCF_EXIT);
+		int func;
+		ulong now;
+
+		func = func_ptr_to_num(func_ptr);
+		if (!trace_wanted(func))
+			return;
 		hdr->depth--;
+		if (hdr->depth > hdr->depth_limit || !trace_timed())
+			return;
+		now = timer_get_us();
+		if (hdr->mode != TRACE_MODE_FUNCS)
+			add_ftrace(func_ptr, caller, FUNCF_EXIT, now);
+		if (hdr->func_time && func < hdr->func_count &&
+		    hdr->depth >= 0 && hdr->depth < TRACE_MAX_DEPTH)
+			hdr->func_time[func] += now - hdr->entry_time[hdr->depth];
 	}
 }
 
@@ -170,6 +260,8 @@ int trace_list_functions(void *buff, int buff_size, unsigned int *needed)
 
 			stats->offset = func * FUNC_SITE_SIZE;
 			stats->call_count = calls;
+			stats->time_us = hdr->func_time ? hdr->func_time[func] :
+					 0;
 			upto++;
 		}
 		ptr += sizeof(struct trace_output_func);
@@ -193,7 +285,7 @@ int trace_list_calls(void *buff, int buff_size, unsigned *needed)
 	struct trace_output_hdr *output_hdr = NULL;
 	void *end, *ptr = buff;
 	int rec, upto;
-	int count;
+	int count, start = 0;
 
 	end = buff ? buff + buff_size : NULL;
 
@@ -204,13 +296,19 @@ int trace_list_calls(void *buff, int buff_size, unsigned *needed)
 
 	/* Add information about each call */
 	count = hdr->ftrace_count;
-	if (count > hdr->ftrace_size)
+	if (count > hdr->ftrace_size) {
+		/* In ring mode, the oldest record is the next to be written */
+		if (hdr->mode == TRACE_MODE_RING)
+			start = hdr->ftrace_count % hdr->ftrace_size;
 		count = hdr->ftrace_size;
+	}
 	for (rec = upto = 0; rec < count; rec++) {
 		if (ptr + sizeof(struct trace_call) < end) {
-			struct trace_call *call = &hdr->ftrace[rec];
+			struct trace_call *call;
 			struct trace_call *out = ptr;
 
+			call = &hdr->ftrace[(start + rec) % hdr->ftrace_size];
+
 			out->func = call->func * FUNC_SITE_SIZE;
 			out->caller = call->caller * FUNC_SITE_SIZE;
 			out->flags = call->flags;
@@ -255,14 +353,23 @@ void trace_print_stats(void)
 	print_grouped_ull(count, 10);
 	puts(" traced function calls");
 	if (hdr->ftrace_count > hdr->ftrace_size) {
-		printf(" (%lu dropped due to overflow)",
-		       hdr->ftrace_count - hdr->ftrace_size);
+		printf(" (%lu %s due to overflow)",
+		       hdr->ftrace_count - hdr->ftrace_size,
+		       hdr->mode == TRACE_MODE_RING ? "overwritten" :
+		       "dropped");
 	}
 	puts("\n");
 	printf("%15d maximum observed call depth\n", hdr->max_depth);
 	printf("%15d call depth limit\n", hdr->depth_limit);
 	print_grouped_ull(hdr->ftrace_too_deep_count, 10);
 	puts(" calls not traced due to depth\n");
+	printf("%15s mode%s\n", trace_mode_name[hdr->mode],
+	       hdr->func_time ? ", with function times" : "");
+	if (hdr->range_end) {
+		printf("%15s range %lx-%lx\n", "",
+		       hdr->range_start * FUNC_SITE_SIZE,
+		       hdr->range_end * FUNC_SITE_SIZE);
+	}
 }
 
 void __attribute__((no_instrument_function)) trace_set_enabled(int enabled)
@@ -270,6 +377,127 @@ void __attribute__((no_instrument_function)) trace_set_enabled(int enabled)
 	trace_enabled = enabled != 0;
 }
 
+int trace_lookup_mode(const char *name)
+{
+	int mode;
+
+	for (mode = 0; mode < TRACE_MODE_COUNT; mode++) {
+		if (!strcmp(name, trace_mode_name[mode]))
+			return mode;
+	}
+
+	return -1;
+}
+
+int trace_set_mode(enum trace_mode mode)
+{
+	int was_enabled = trace_enabled;
+
+	if (!trace_inited || mode >= TRACE_MODE_COUNT)
+		return -1;
+
+	/* Records from the old mode are not in the right order for the new */
+	trace_enabled = 0;
+	if (mode != hdr->mode && hdr->ftrace_count > hdr->ftrace_size)
+		hdr->ftrace_count = 0;
+	hdr->mode = mode;
+	trace_enabled = was_enabled;
+
+	return 0;
+}
+
+int trace_set_depth_limit(int depth_limit)
+{
+	if (!trace_inited || depth_limit < 0)
+		return -1;
+	hdr->depth_limit = depth_limit;
+
+	return 0;
+}
+
+int trace_set_range(ulong start, ulong end)
+{
+	if (!trace_inited || start > end)
+		return -1;
+	hdr->range_start = start / FUNC_SITE_SIZE;
+	hdr->range_end = (end + FUNC_SITE_SIZE - 1) / FUNC_SITE_SIZE;
+
+	return 0;
+}
+
+/**
+ * Work out the space needed for the trace header and per-function data
+ *
+ * @param func_count	Number of function sites
+ * @return size in bytes. Any remaining space is used for function call
+ * records
+ */
+static size_t __attribute__((no_instrument_function))
+		trace_fixed_size(ulong func_count)
+{
+	size_t needed = sizeof(*hdr) + func_count * sizeof(uintptr_t);
+
+#ifdef CONFIG_TRACE_FUNC_TIME
+	needed += func_count * sizeof(uint32_t);
+#endif
+	return needed;
+}
+
+/**
+ * Set up the pointers to the parts of the trace buffer
+ *
+ * @param buff		Pointer to trace buffer, which holds the header
+ * @param buff_size	Size of trace buffer
+ * @param needed	Size of header and per-function data
+ */
+static void __attribute__((no_instrument_function))
+		trace_setup_buffer(void *buff, size_t buff_size, size_t needed)
+{
+	hdr->call_accum = (uintptr_t *)(hdr + 1);
+#ifdef CONFIG_TRACE_FUNC_TIME
+	hdr->func_time = (uint32_t *)(hdr->call_accum + hdr->func_count);
+#endif
+
+	/* Use any remaining space for the timed function trace */
+	hdr->ftrace = (struct trace_call *)((char *)buff + needed);
+	hdr->ftrace_size = (buff_size - needed) / sizeof(*hdr->ftrace);
+}
+
+#ifdef CONFIG_TRACE_EARLY
+static void __attribute__((no_instrument_function))
+		reverse_calls(struct trace_call *call, ulong count)
+{
+	struct trace_call tmp, *end = call + count - 1;
+
+	for (; call < end; call++, end--) {
+		tmp = *call;
+		*call = *end;
+		*end = tmp;
+	}
+}
+
+/**
+ * Put the early function call records in order
+ *
+ * If the early buffer was used as a ring and filled up, the oldest record
+ * is in the middle. Rotate the records so that it comes first, ready for
+ * new records to be added after the newest one.
+ */
+static void __attribute__((no_instrument_function)) trace_unwrap_early(void)
+{
+	ulong size = hdr->ftrace_size;
+	ulong start;
+
+	if (hdr->ftrace_count <= size)
+		return;
+	start = hdr->mode == TRACE_MODE_RING ? hdr->ftrace_count % size : 0;
+	reverse_calls(hdr->ftrace, start);
+	reverse_calls(hdr->ftrace + start, size - start);
+	reverse_calls(hdr->ftrace, size);
+	hdr->ftrace_count = size;
+}
+#endif
+
 /**
  * Init the tracing system ready for used, and enable it
  *
@@ -295,6 +523,7 @@ int __attribute__((no_instrument_function)) trace_init(void *buff,
 		trace_enabled = 0;
 		hdr = map_sysmem(CONFIG_TRACE_EARLY_ADDR,
 				 CONFIG_TRACE_EARLY_SIZE);
+		trace_unwrap_early();
 		end = (char *)&hdr->ftrace[hdr->ftrace_count];
 		used = end - (char *)hdr;
 		printf("trace: copying %08lx bytes of early data from %x to %08lx\n",
@@ -307,25 +536,23 @@ int __attribute__((no_instrument_function)) trace_init(void *buff,
 #endif
 	}
 	hdr = (struct trace_hdr *)buff;
-	needed = sizeof(*hdr) + func_count * sizeof(uintptr_t);
+	needed = trace_fixed_size(func_count);
 	if (needed > buff_size) {
 		printf("trace: buffer size %zd bytes: at least %zd needed\n",
 		       buff_size, needed);
 		return -1;
 	}
 
-	if (was_disabled)
+	if (was_disabled) {
 		memset(hdr, '\0', needed);
+		hdr->mode = CONFIG_TRACE_MODE;
+	}
 	hdr->func_count = func_count;
-	hdr->call_accum = (uintptr_t *)(hdr + 1);
-
-	/* Use any remaining space for the timed function trace */
-	hdr->ftrace = (struct trace_call *)(buff + needed);
-	hdr->ftrace_size = (buff_size - needed) / sizeof(*hdr->ftrace);
+	trace_setup_buffer(buff, buff_size, needed);
 	add_textbase();
 
 	puts("trace: enabled\n");
-	hdr->depth_limit = 15;
+	hdr->depth_limit = CONFIG_TRACE_CALL_DEPTH_LIMIT;
 	trace_enabled = 1;
 	trace_inited = 1;
 	return 0;
@@ -343,7 +570,7 @@ int __attribute__((no_instrument_function)) trace_early_init(void)
 		return 0;
 
 	hdr = map_sysmem(CONFIG_TRACE_EARLY_ADDR, CONFIG_TRACE_EARLY_SIZE);
-	needed = sizeof(*hdr) + func_count * sizeof(uintptr_t);
+	needed = trace_fixed_size(func_count);
 	if (needed > buff_size) {
 		printf("trace: buffer size is %zd bytes, at least %zd needed\n",
 		       buff_size, needed);
@@ -351,14 +578,11 @@ int __attribute__((no_instrument_function)) trace_early_init(void)
 	}
 
 	memset(hdr, '\0', needed);
-	hdr->call_accum = (uintptr_t *)(hdr + 1);
 	hdr->func_count = func_count;
-
-	/* Use any remaining space for the timed function trace */
-	hdr->ftrace = (struct trace_call *)((char *)hdr + needed);
-	hdr->ftrace_size = (buff_size - needed) / sizeof(*hdr->ftrace);
+	hdr->mode = CONFIG_TRACE_MODE;
+	trace_setup_buffer(hdr, buff_size, needed);
 	add_textbase();
-	hdr->depth_limit = 200;
+	hdr->depth_limit = CONFIG_TRACE_EARLY_CALL_DEPTH_LIMIT;
 	printf("trace: early enable at %08x\n", CONFIG_TRACE_EARLY_ADDR);
 
 	trace_enabled = 1;
@@ -13,12 +13,28 @@ static int do_ut_all(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[]);
 
 static cmd_tbl_t cmd_ut_sub[] = {
 	U_BOOT_CMD_MKENT(all, CONFIG_SYS_MAXARGS, 1, do_ut_all, "", ""),
+#ifdef CONFIG_UT_CRC
+	U_BOOT_CMD_MKENT(crc, CONFIG_SYS_MAXARGS, 1, do_ut_crc, "", ""),
+#endif
 #if defined(CONFIG_UT_DM)
 	U_BOOT_CMD_MKENT(dm, CONFIG_SYS_MAXARGS, 1, do_ut_dm, "", ""),
 #endif
 #if defined(CONFIG_UT_ENV)
 	U_BOOT_CMD_MKENT(env, CONFIG_SYS_MAXARGS, 1, do_ut_env, "", ""),
 #endif
+#ifdef CONFIG_UT_FIND_CMD
+	U_BOOT_CMD_MKENT(find_cmd, CONFIG_SYS_MAXARGS, 1, do_ut_find_cmd, "",
+			 ""),
+#endif
+#ifdef CONFIG_UT_HUSH
+	U_BOOT_CMD_MKENT(hush, CONFIG_SYS_MAXARGS, 1, do_ut_hush, "", ""),
+#endif
+#ifdef CONFIG_UT_LMB
+	U_BOOT_CMD_MKENT(lmb, CONFIG_SYS_MAXARGS, 1, do_ut_lmb, "", ""),
+#endif
+#ifdef CONFIG_UT_MALLOC
+	U_BOOT_CMD_MKENT(malloc, CONFIG_SYS_MAXARGS, 1, do_ut_malloc, "", ""),
+#endif
 #ifdef CONFIG_UT_TIME
 	U_BOOT_CMD_MKENT(time, CONFIG_SYS_MAXARGS, 1, do_ut_time, "", ""),
 #endif
@@ -62,12 +78,27 @@ static int do_ut(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
 #ifdef CONFIG_SYS_LONGHELP
 static char ut_help_text[] =
 	"all - execute all enabled tests\n"
+#ifdef CONFIG_UT_CRC
+	"ut crc - Test and benchmark of CRC32 functions\n"
+#endif
 #ifdef CONFIG_UT_DM
 	"ut dm [test-name]\n"
 #endif
 #ifdef CONFIG_UT_ENV
 	"ut env [test-name]\n"
 #endif
+#ifdef CONFIG_UT_FIND_CMD
+	"ut find_cmd - Test and benchmark of command lookup\n"
+#endif
+#ifdef CONFIG_UT_HUSH
+	"ut hush - Test and benchmark of the hush script cache\n"
+#endif
+#ifdef CONFIG_UT_LMB
+	"ut lmb - Test of LMB regions and benchmark of bootm setup\n"
+#endif
+#ifdef CONFIG_UT_MALLOC
+	"ut malloc - Test of TLSF and benchmark against malloc()\n"
+#endif
 #ifdef CONFIG_UT_TIME
 	"ut time - Very basic test of time functions\n"
 #endif
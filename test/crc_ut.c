@@ -0,0 +1,193 @@
+/*
+ * Tests and benchmark for the CRC32 and CRC32C routines in lib/crc32.c
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <command.h>
+#include <errno.h>
+#include <malloc.h>
+#include <u-boot/crc.h>
+
+#define CRC32_POLY	0xedb88320
+#define CRC32C_POLY	0x82f63b78
+
+#define BENCH_SIZE	(1 << 20)
+#define BENCH_LOOPS	16
+
+/* Byte-at-a-time table, as used by the original zlib-derived crc32() */
+static uint32_t ref_table[256];
+static uint32_t ref_poly;
+
+static void ref_make_table(uint32_t poly)
+{
+	uint32_t c;
+	int n, k;
+
+	for (n = 0; n < 256; n++) {
+		c = n;
+		for (k = 0; k < 8; k++)
+			c = c & 1 ? poly ^ (c >> 1) : c >> 1;
+		ref_table[n] = c;
+	}
+	ref_poly = poly;
+}
+
+static uint32_t ref_crc(uint32_t poly, uint32_t crc, const uchar *buf,
+			uint len)
+{
+	if (ref_poly != poly)
+		ref_make_table(poly);
+
+	crc = ~crc;
+	while (len--)
+		crc = ref_table[(crc ^ *buf++) & 0xff] ^ (crc >> 8);
+
+	return ~crc;
+}
+
+static void fill_buf(uchar *buf, uint len)
+{
+	uint32_t seed = 0x12345678;
+
+	while (len--) {
+		seed = seed * 1103515245 + 12345;
+		*buf++ = seed >> 16;
+	}
+}
+
+static int test_crc_vectors(void)
+{
+	static const uchar check[] = "123456789";
+	uint32_t crc;
+
+	/* Standard check values for the two polynomials */
+	crc = crc32(0, check, 9);
+	if (crc != 0xcbf43926) {
+		printf("%s: crc32 check value %08x, expected cbf43926\n",
+		       __func__, crc);
+		return -EINVAL;
+	}
+	crc = crc32c(0, check, 9);
+	if (crc != 0xe3069283) {
+		printf("%s: crc32c check value %08x, expected e3069283\n",
+		       __func__, crc);
+		return -EINVAL;
+	}
+
+	/* Empty input leaves the CRC unchanged */
+	if (crc32(0x1234, check, 0) != 0x1234 ||
+	    crc32c(0x1234, check, 0) != 0x1234) {
+		printf("%s: zero-length input changed the CRC\n", __func__);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Compare against the byte-wise loop for every alignment and short length */
+static int test_crc_compare(uchar *buf)
+{
+	uint32_t got, expect;
+	int align, len;
+
+	for (align = 0; align < 8; align++) {
+		for (len = 0; len < 300; len++) {
+			got = crc32(align, buf + align, len);
+			expect = ref_crc(CRC32_POLY, align, buf + align, len);
+			if (got != expect) {
+				printf("%s: crc32 align=%d, len=%d: %08x, expected %08x\n",
+				       __func__, align, len, got, expect);
+				return -EINVAL;
+			}
+			got = crc32c(align, buf + align, len);
+			expect = ref_crc(CRC32C_POLY, align, buf + align, len);
+			if (got != expect) {
+				printf("%s: crc32c align=%d, len=%d: %08x, expected %08x\n",
+				       __func__, align, len, got, expect);
+				return -EINVAL;
+			}
+		}
+	}
+
+	/* Chained calls must match a single call over the whole buffer */
+	got = crc32(0, buf, 1000);
+	got = crc32(got, buf + 1000, BENCH_SIZE - 1000);
+	expect = ref_crc(CRC32_POLY, 0, buf, BENCH_SIZE);
+	if (got != expect) {
+		printf("%s: chained crc32 %08x, expected %08x\n", __func__,
+		       got, expect);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static uint32_t ref_crc32(uint32_t crc, const uchar *buf, uint len)
+{
+	return ref_crc(CRC32_POLY, crc, buf, len);
+}
+
+static uint32_t ref_crc32c(uint32_t crc, const uchar *buf, uint len)
+{
+	return ref_crc(CRC32C_POLY, crc, buf, len);
+}
+
+static ulong bench(const char *name,
+		   uint32_t (*func)(uint32_t crc, const uchar *buf, uint len),
+		   uchar *buf)
+{
+	ulong start, delta;
+	uint32_t crc = 0;
+	int i;
+
+	start = timer_get_us();
+	for (i = 0; i < BENCH_LOOPS; i++)
+		crc = func(crc, buf, BENCH_SIZE);
+	delta = timer_get_us() - start;
+	if (!delta)
+		delta = 1;
+	printf("%-16s %8lu us, %5lu MB/s\n", name, delta,
+	       (ulong)BENCH_LOOPS * BENCH_SIZE / delta);
+
+	return delta;
+}
+
+static void bench_pair(const char *ref_name,
+		       uint32_t (*ref)(uint32_t, const uchar *, uint),
+		       const char *name,
+		       uint32_t (*func)(uint32_t, const uchar *, uint),
+		       uchar *buf)
+{
+	ulong ref_us, new_us;
+
+	ref_us = bench(ref_name, ref, buf);
+	new_us = bench(name, func, buf);
+	printf("Speed-up: %lu.%02lux\n", ref_us / new_us,
+	       ref_us * 100 / new_us % 100);
+}
+
+int do_ut_crc(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
+{
+	uchar *buf;
+	int ret = 0;
+
+	buf = malloc(BENCH_SIZE);
+	if (!buf) {
+		printf("Out of memory\n");
+		return CMD_RET_FAILURE;
+	}
+	fill_buf(buf, BENCH_SIZE);
+
+	ret |= test_crc_vectors();
+	ret |= test_crc_compare(buf);
+
+	bench_pair("byte-wise crc32", ref_crc32, "crc32()", crc32, buf);
+	bench_pair("byte-wise crc32c", ref_crc32c, "crc32c()", crc32c, buf);
+
+	free(buf);
+	printf("Test %s\n", ret ? "failed" : "passed");
+
+	return ret ? CMD_RET_FAILURE : CMD_RET_SUCCESS;
+}
@@ -41,10 +41,28 @@ static int do_dm_dump_devres(cmd_tbl_t *cmdtp, int flag, int argc,
 	return 0;
 }
 
+#if CONFIG_IS_ENABLED(DM_TIMING)
+static int do_dm_dump_time(cmd_tbl_t *cmdtp, int flag, int argc,
+			   char * const argv[])
+{
+	dm_dump_time();
+
+	return 0;
+}
+
+#define DM_TIME_HELP \
+	"\ndm time          Dump bind/probe time for each device, slowest first"
+#else
+#define DM_TIME_HELP
+#endif
+
 static cmd_tbl_t test_commands[] = {
 	U_BOOT_CMD_MKENT(tree, 0, 1, do_dm_dump_all, "", ""),
 	U_BOOT_CMD_MKENT(uclass, 1, 1, do_dm_dump_uclass, "", ""),
 	U_BOOT_CMD_MKENT(devres, 1, 1, do_dm_dump_devres, "", ""),
+#if CONFIG_IS_ENABLED(DM_TIMING)
+	U_BOOT_CMD_MKENT(time, 1, 1, do_dm_dump_time, "", ""),
+#endif
 };
 
 static __maybe_unused void dm_reloc(void)
@@ -86,4 +104,5 @@ U_BOOT_CMD(
 	"tree         Dump driver model tree ('*' = activated)\n"
 	"dm uclass        Dump list of instances for each uclass\n"
 	"dm devres        Dump list of device resources for each device"
+	DM_TIME_HELP
 );
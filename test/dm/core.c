@@ -7,11 +7,14 @@
  */
 
 #include <common.h>
+#include <console.h>
 #include <errno.h>
 #include <dm.h>
 #include <fdtdec.h>
 #include <malloc.h>
+#include <asm/test.h>
 #include <dm/device-internal.h>
+#include <dm/lists.h>
 #include <dm/root.h>
 #include <dm/util.h>
 #include <dm/test.h>
@@ -796,3 +799,275 @@ static int dm_test_device_get_uclass_id(struct unit_test_state *uts)
 	return 0;
 }
 DM_TEST(dm_test_device_get_uclass_id, DM_TESTF_SCAN_PDATA);
+
+/* Find a device by walking the uclass list, as a reference for the index */
+static struct udevice *dm_test_walk_uclass(struct uclass *uc, const char *name,
+					   int node, int seq, int req_seq)
+{
+	struct udevice *dev;
+
+	list_for_each_entry(dev, &uc->dev_head, uclass_node) {
+		if ((name && !strcmp(dev->name, name)) ||
+		    (node >= 0 && dev->of_offset == node) ||
+		    (seq >= 0 && dev->seq == seq) ||
+		    (req_seq >= 0 && dev->req_seq == req_seq))
+			return dev;
+	}
+
+	return NULL;
+}
+
+/* Check that lookups of every device in a uclass find the right one */
+static int dm_test_check_uclass_lookup(struct unit_test_state *uts,
+				       enum uclass_id id)
+{
+	struct udevice *dev, *found;
+	struct uclass *uc;
+
+	ut_assertok(uclass_get(id, &uc));
+	list_for_each_entry(dev, &uc->dev_head, uclass_node) {
+		ut_assertok(uclass_find_device_by_name(id, dev->name, &found));
+		ut_asserteq_ptr(dm_test_walk_uclass(uc, dev->name, -1, -1, -1),
+				found);
+		if (dev->of_offset >= 0) {
+			ut_assertok(uclass_find_device_by_of_offset(id,
+					dev->of_offset, &found));
+			ut_asserteq_ptr(dm_test_walk_uclass(uc, NULL,
+					dev->of_offset, -1, -1), found);
+		}
+		if (dev->seq != -1) {
+			ut_assertok(uclass_find_device_by_seq(id, dev->seq,
+							      false, &found));
+			ut_asserteq_ptr(dev, found);
+		}
+		if (dev->req_seq != -1) {
+			ut_assertok(uclass_find_device_by_seq(id, dev->req_seq,
+							      true, &found));
+			ut_asserteq_ptr(dm_test_walk_uclass(uc, NULL, -1, -1,
+					dev->req_seq), found);
+		}
+	}
+	ut_asserteq(-ENODEV, uclass_find_device_by_seq(id, 100, false, &found));
+	ut_asserteq(-ENODEV, uclass_find_device_by_name(id, "no-such-device",
+							&found));
+
+	return 0;
+}
+
+/* Test that device lookups stay correct as devices come and go */
+static int dm_test_uclass_lookup(struct unit_test_state *uts)
+{
+	struct dm_test_state *dms = uts->priv;
+	struct udevice *dev, *found;
+	char name[20];
+	int node;
+	int i;
+
+	/* We don't care about the numbering for this test */
+	dms->skip_post_probe = 1;
+
+	ut_assertok(dm_test_check_uclass_lookup(uts, UCLASS_TEST_FDT));
+
+	/* Probing allocates sequence numbers */
+	for (uclass_first_device(UCLASS_TEST_FDT, &dev); dev;
+	     uclass_next_device(&dev))
+		;
+	ut_assertok(dm_test_check_uclass_lookup(uts, UCLASS_TEST_FDT));
+	ut_assertok(uclass_find_device_by_seq(UCLASS_TEST_FDT, 8, false, &dev));
+	ut_asserteq_str("a-test", dev->name);
+
+	/* Removing a device frees its sequence number */
+	ut_assertok(device_remove(dev));
+	ut_asserteq(-ENODEV, uclass_find_device_by_seq(UCLASS_TEST_FDT, 8,
+						       false, &found));
+	ut_assertok(uclass_find_device_by_seq(UCLASS_TEST_FDT, 8, true,
+					      &found));
+	ut_asserteq_ptr(dev, found);
+	ut_assertok(dm_test_check_uclass_lookup(uts, UCLASS_TEST_FDT));
+
+	/* Unbinding removes it completely */
+	node = dev->of_offset;
+	ut_assertok(device_unbind(dev));
+	ut_asserteq(-ENODEV, uclass_find_device_by_seq(UCLASS_TEST_FDT, 8,
+						       true, &found));
+	ut_asserteq(-ENODEV, uclass_find_device_by_of_offset(UCLASS_TEST_FDT,
+							     node, &found));
+	ut_assertok(dm_test_check_uclass_lookup(uts, UCLASS_TEST_FDT));
+
+	/* A renamed device is found by its new name only */
+	ut_assertok(uclass_find_device_by_name(UCLASS_TEST_FDT, "b-test",
+					       &dev));
+	ut_assertok(device_set_name(dev, "renamed"));
+	ut_assertok(uclass_find_device_by_name(UCLASS_TEST_FDT, "renamed",
+					       &found));
+	ut_asserteq_ptr(dev, found);
+	ut_asserteq(-ENODEV, uclass_find_device_by_name(UCLASS_TEST_FDT,
+							"b-test", &found));
+
+	/* A name prefix still finds a device, with an exact name preferred */
+	ut_assertok(uclass_find_device_by_name(UCLASS_TEST_FDT, "rename",
+					       &found));
+	ut_asserteq_ptr(dev, found);
+
+	/* Add enough devices to enlarge the lookup tables a few times */
+	for (i = 0; i < 40; i++) {
+		ut_assertok(device_bind_by_name(gd->dm_root, false,
+						&driver_info_manual, &dev));
+		snprintf(name, sizeof(name), "manual%d", i);
+		ut_assertok(device_set_name(dev, name));
+		ut_assertok(device_probe(dev));
+	}
+	ut_assertok(dm_test_check_uclass_lookup(uts, UCLASS_TEST));
+	ut_assertok(uclass_find_device_by_name(UCLASS_TEST, "manual33", &dev));
+	ut_asserteq_str("manual33", dev->name);
+
+	/*
+	 * An exact name is preferred over an earlier device whose name only
+	 * starts with it. Otherwise the first device with the prefix is found.
+	 */
+	ut_assertok(uclass_find_device_by_name(UCLASS_TEST, "manual0", &dev));
+	ut_assertok(device_set_name(dev, "manual10x"));
+	ut_assertok(uclass_find_device_by_name(UCLASS_TEST, "manual10", &found));
+	ut_asserteq_str("manual10", found->name);
+	ut_assertok(uclass_find_device_by_name(UCLASS_TEST, "manua", &found));
+	ut_asserteq_ptr(dev, found);
+	ut_assertok(uclass_get_device_by_name(UCLASS_TEST, "manual10", &found));
+	ut_asserteq_str("manual10", found->name);
+	ut_assertok(dm_test_check_uclass_lookup(uts, UCLASS_TEST_FDT));
+
+	return 0;
+}
+DM_TEST(dm_test_uclass_lookup, DM_TESTF_SCAN_PDATA | DM_TESTF_SCAN_FDT);
+
+#if CONFIG_IS_ENABLED(DM_UCLASS_INDEX)
+/* Time lookups in a large uclass with and without the index */
+static int dm_test_uclass_lookup_speed(struct unit_test_state *uts)
+{
+	const int count = 200, loops = 20;
+	struct udevice *dev, *found[2];
+	ulong start, time[2];
+	struct uclass *uc;
+	char name[20];
+	int pass, i, j;
+
+	for (i = 0; i < count * 2; i++) {
+		ut_assertok(device_bind_by_name(gd->dm_root, false,
+						&driver_info_manual, &dev));
+		/* Renaming re-indexes the device, including its node */
+		if (i >= count)
+			dev->of_offset = 0x10000 + i * 4;
+		snprintf(name, sizeof(name), "lookup%d", i);
+		ut_assertok(device_set_name(dev, name));
+		if (i < count)
+			ut_assertok(device_probe(dev));
+	}
+	ut_assertok(uclass_get(UCLASS_TEST, &uc));
+
+	for (pass = 0; pass < 2; pass++) {
+		uc->no_index = pass;
+		start = timer_get_us();
+		for (j = 0; j < loops; j++) {
+			for (i = 0; i < count; i++) {
+				snprintf(name, sizeof(name), "lookup%d", i);
+				ut_assertok(uclass_find_device_by_name(
+					UCLASS_TEST, name, &found[pass]));
+				ut_assertok(uclass_find_device_by_seq(
+					UCLASS_TEST, i, false, &dev));
+				ut_asserteq_ptr(found[pass], dev);
+				ut_assertok(uclass_find_device_by_of_offset(
+					UCLASS_TEST, 0x10000 + (count + i) * 4,
+					&dev));
+			}
+		}
+		time[pass] = timer_get_us() - start;
+	}
+	uc->no_index = false;
+	ut_asserteq_ptr(found[0], found[1]);
+	printf("%d lookups: indexed %lu us, linear %lu us\n",
+	       count * loops * 3, time[0], time[1]);
+
+	return 0;
+}
+DM_TEST(dm_test_uclass_lookup_speed, 0);
+#endif
+
+#if CONFIG_IS_ENABLED(DM_TIMING)
+enum {
+	TIMING_BIND_MS		= 10,
+	TIMING_PROBE_MS		= 20,
+};
+
+/* The top-level device binds a child, so that the bind times are nested */
+static int test_timing_bind(struct udevice *dev)
+{
+	sandbox_timer_add_offset(TIMING_BIND_MS);
+	if (dev->parent == dm_root())
+		return device_bind(dev, dev->driver, "timing-child", NULL, -1,
+				   NULL);
+
+	return 0;
+}
+
+static int test_timing_probe(struct udevice *dev)
+{
+	sandbox_timer_add_offset(TIMING_PROBE_MS);
+
+	return 0;
+}
+
+U_BOOT_DRIVER(test_timing_drv) = {
+	.name	= "test_timing_drv",
+	.id	= UCLASS_TEST,
+	.bind	= test_timing_bind,
+	.probe	= test_timing_probe,
+	.platdata_auto_alloc_size = sizeof(struct dm_test_pdata),
+};
+
+/* Check that a recorded time is close to the delay the driver added */
+static int check_timing(struct unit_test_state *uts, uint time_us, int ms)
+{
+	ut_assert(time_us >= ms * 1000);
+	ut_assert(time_us < ms * 1000 + 5000);
+
+	return 0;
+}
+
+/* Test that bind and probe times exclude nested devices */
+static int dm_test_timing(struct unit_test_state *uts)
+{
+	static const char header[] =
+		"  Bind(us)  Probe(us)  Uclass      Device\n";
+	struct dm_test_state *dms = uts->priv;
+	struct udevice *parent, *child;
+	char *data, *line;
+	int len;
+
+	ut_assertok(device_bind(dms->root,
+				lists_driver_lookup_name("test_timing_drv"),
+				"timing-parent", NULL, -1, &parent));
+	ut_assertok(device_find_first_child(parent, &child));
+	ut_assertnonnull(child);
+	ut_assertok(check_timing(uts, parent->bind_time, TIMING_BIND_MS));
+	ut_assertok(check_timing(uts, child->bind_time, TIMING_BIND_MS));
+	ut_asserteq(0, parent->probe_time);
+
+	/* Probing the child probes the parent first */
+	ut_assertok(device_probe(child));
+	ut_assertok(check_timing(uts, parent->probe_time, TIMING_PROBE_MS));
+	ut_assertok(check_timing(uts, child->probe_time, TIMING_PROBE_MS));
+
+	/* The report lists the slowest devices first */
+	console_record_reset_enable();
+	dm_dump_time();
+	len = membuff_getraw(&gd->console_out, -1, true, &data);
+	ut_assert(len > sizeof(header));
+	data[len] = '\0';
+	ut_assertok(strncmp(header, data, sizeof(header) - 1));
+	line = data + sizeof(header) - 1;
+	*strchr(line, '\n') = '\0';
+	ut_assertnonnull(strstr(line, " timing-"));
+
+	return 0;
+}
+DM_TEST(dm_test_timing, 0);
+#endif
@@ -0,0 +1,75 @@
+/*
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <dm.h>
+#include <membuff.h>
+#include <serial.h>
+#include <stdio_dev.h>
+#include <asm/test.h>
+#include <dm/test.h>
+#include <test/ut.h>
+
+/* Get the output waiting in a serial device's buffer */
+static int serial_get_queued(struct udevice *dev, char *buf, int size)
+{
+	struct serial_dev_priv *upriv = dev_get_uclass_priv(dev);
+	struct membuff copy = upriv->tx_buf;
+	int len;
+
+	len = membuff_get(&copy, buf, size - 1);
+	buf[len] = '\0';
+
+	return len;
+}
+
+/* Test that output waits in the buffer while the UART is busy */
+static int dm_test_serial_tx_buffer(struct unit_test_state *uts)
+{
+	struct serial_dev_priv *upriv;
+	char queued[4][20];
+	struct stdio_dev *sdev;
+	struct udevice *dev;
+
+	ut_assertok(uclass_get_device(UCLASS_SERIAL, 0, &dev));
+	upriv = dev_get_uclass_priv(dev);
+	sdev = upriv->sdev;
+	ut_assertnonnull(sdev);
+
+	/*
+	 * Check nothing until the UART can take output again, since a failed
+	 * check would otherwise leave the device stuck when it is removed
+	 */
+	sandbox_serial_set_tx_space(dev, 0);
+	sdev->puts(sdev, "buffered\n");
+	sdev->putc(sdev, 'x');
+	serial_get_queued(dev, queued[0], sizeof(queued[0]));
+
+	/* checking for input sends what the UART can take */
+	sandbox_serial_set_tx_space(dev, 4);
+	sdev->tstc(sdev);
+	serial_get_queued(dev, queued[1], sizeof(queued[1]));
+
+	/* so does a delay */
+	sandbox_serial_set_tx_space(dev, 3);
+	udelay(1);
+	serial_get_queued(dev, queued[2], sizeof(queued[2]));
+
+	/* flushing waits until everything has been sent */
+	sandbox_serial_set_tx_space(dev, -1);
+	sdev->flush(sdev);
+	serial_get_queued(dev, queued[3], sizeof(queued[3]));
+
+	ut_asserteq_str("buffered\n\rx", queued[0]);
+	ut_asserteq_str("ered\n\rx", queued[1]);
+	ut_asserteq_str("d\n\rx", queued[2]);
+	ut_asserteq_str("", queued[3]);
+
+	/* with the UART free, output is sent straight away */
+	sdev->puts(sdev, "direct\n");
+	ut_assert(membuff_isempty(&upriv->tx_buf));
+
+	return 0;
+}
+DM_TEST(dm_test_serial_tx_buffer, DM_TESTF_SCAN_FDT);
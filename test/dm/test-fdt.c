@@ -9,7 +9,10 @@
 #include <errno.h>
 #include <fdtdec.h>
 #include <malloc.h>
+#include <of_live.h>
 #include <asm/io.h>
+#include <dm/device-internal.h>
+#include <dm/lists.h>
 #include <dm/test.h>
 #include <dm/root.h>
 #include <dm/uclass-internal.h>
@@ -37,8 +40,7 @@ static int testfdt_ofdata_to_platdata(struct udevice *dev)
 {
 	struct dm_test_pdata *pdata = dev_get_platdata(dev);
 
-	pdata->ping_add = fdtdec_get_int(gd->fdt_blob, dev->of_offset,
-					"ping-add", -1);
+	pdata->ping_add = dev_read_u32_default(dev, "ping-add", -1);
 	pdata->base = fdtdec_get_addr(gd->fdt_blob, dev->of_offset,
 				      "ping-expect");
 
@@ -80,6 +82,7 @@ U_BOOT_DRIVER(testfdt_drv) = {
 	.ops	= &test_ops,
 	.priv_auto_alloc_size = sizeof(struct dm_test_priv),
 	.platdata_auto_alloc_size = sizeof(struct dm_test_pdata),
+	.flags	= DM_FLAG_KEEP_PROBED,
 };
 
 /* From here is the testfdt uclass code */
@@ -266,3 +269,562 @@ static int dm_test_fdt_offset(struct unit_test_state *uts)
 	return 0;
 }
 DM_TEST(dm_test_fdt_offset, DM_TESTF_SCAN_PDATA | DM_TESTF_SCAN_FDT);
+
+/* Number of times to look up every compatible string when timing lookups */
+#define COMPAT_LOOKUP_PASSES	100
+
+/* Maximum number of compatible strings to time */
+#define COMPAT_LOOKUP_MAX	256
+
+/*
+ * Look up the driver for each compatible string in the device tree
+ *
+ * @use_index:	true to use the compatible-string index, false to search all
+ *		drivers
+ * @usp:	Returns the time taken by COMPAT_LOOKUP_PASSES passes, in us
+ */
+static int dm_test_lookup_all_compat(struct unit_test_state *uts,
+				     bool use_index, ulong *usp)
+{
+	const char *compats[COMPAT_LOOKUP_MAX];
+	const void *blob = gd->fdt_blob;
+	const struct udevice_id *id, *linear_id;
+	struct driver *drv, *linear_drv;
+	const char *compat;
+	int count = 0;
+	ulong start;
+	int offset, len, i, pass;
+	int ret;
+
+	/* Both methods must find the same driver */
+	for (offset = fdt_next_node(blob, 0, NULL); offset > 0;
+	     offset = fdt_next_node(blob, offset, NULL)) {
+		compat = fdt_getprop(blob, offset, "compatible", &len);
+		for (i = 0; compat && i < len; i += strlen(compat + i) + 1) {
+			if (count < COMPAT_LOOKUP_MAX)
+				compats[count++] = compat + i;
+			ret = lists_driver_lookup_compat(compat + i, use_index,
+							 &drv, &id);
+			if (lists_driver_lookup_compat(compat + i, false,
+						       &linear_drv,
+						       &linear_id)) {
+				ut_asserteq(-ENOENT, ret);
+				continue;
+			}
+			ut_assertok(ret);
+			ut_asserteq_ptr(linear_drv, drv);
+			ut_asserteq_ptr(linear_id, id);
+		}
+	}
+
+	start = timer_get_us();
+	for (pass = 0; pass < COMPAT_LOOKUP_PASSES; pass++) {
+		for (i = 0; i < count; i++)
+			lists_driver_lookup_compat(compats[i], use_index, &drv,
+						   &id);
+	}
+	*usp = timer_get_us() - start;
+
+	return 0;
+}
+
+/* Test that the compatible-string index finds drivers faster */
+static int dm_test_fdt_compat_index(struct unit_test_state *uts)
+{
+	const struct udevice_id *id;
+	struct driver *drv;
+	ulong linear, indexed;
+
+	ut_assertok(lists_driver_lookup_compat("denx,u-boot-fdt-test", true,
+					       &drv, &id));
+	ut_asserteq_str("testfdt_drv", drv->name);
+	ut_asserteq(-ENOENT, lists_driver_lookup_compat("not,a-driver", true,
+							&drv, &id));
+
+	ut_assertok(dm_test_lookup_all_compat(uts, false, &linear));
+	ut_assertok(dm_test_lookup_all_compat(uts, true, &indexed));
+	printf("Compatible-string lookups: linear %lu us, indexed %lu us\n",
+	       linear, indexed);
+	ut_assert(indexed < linear);
+
+	return 0;
+}
+DM_TEST(dm_test_fdt_compat_index, 0);
+
+#if CONFIG_IS_ENABLED(DM_LAZY_BIND) || CONFIG_IS_ENABLED(DM_KEEP_PRE_RELOC)
+/* Add a line for a device and each of its children to a description */
+static void dm_test_describe_dev(struct udevice *dev, int depth, char **bufp,
+				 char *end)
+{
+	struct udevice *child;
+
+	if (*bufp < end)
+		*bufp += snprintf(*bufp, end - *bufp, "%d %s %s\n", depth,
+				  dev->uclass->uc_drv->name, dev->name);
+	list_for_each_entry(child, &dev->child_head, sibling_node)
+		dm_test_describe_dev(child, depth + 1, bufp, end);
+}
+
+/*
+ * Describe the device tree and the devices in each uclass, without creating
+ * any uclasses or binding anything
+ */
+static int dm_test_describe(struct unit_test_state *uts, char *buf, int size)
+{
+	char *end = buf + size;
+	struct udevice *dev;
+	struct uclass *uc;
+	int id;
+
+	dm_test_describe_dev(dm_root(), 0, &buf, end);
+	for (id = 0; id < UCLASS_COUNT; id++) {
+		uc = uclass_find(id);
+		if (!uc || list_empty(&uc->dev_head))
+			continue;
+		list_for_each_entry(dev, &uc->dev_head, uclass_node) {
+			if (buf < end)
+				buf += snprintf(buf, end - buf, "%s: %s\n",
+						uc->uc_drv->name, dev->name);
+		}
+	}
+	ut_assert(buf < end);
+
+	return 0;
+}
+
+/* Start driver model again, as test-main.c does between tests */
+static int dm_test_restart(struct unit_test_state *uts)
+{
+	struct uclass *uc;
+	int id;
+
+	for (id = 0; id < UCLASS_COUNT; id++) {
+		uc = uclass_find(id);
+		if (uc)
+			ut_assertok(uclass_destroy(uc));
+	}
+	gd->dm_root = NULL;
+	ut_assertok(dm_init());
+
+	return 0;
+}
+#endif
+
+#if CONFIG_IS_ENABLED(DM_LAZY_BIND)
+/* Test that nodes bound on demand end up as if bound by a full scan */
+static int dm_test_fdt_lazy_bind(struct unit_test_state *uts)
+{
+	const int size = 16 << 10;
+	ulong full_used, lazy_used, base;
+	char *full, *lazy;
+	struct udevice *dev;
+
+	full = malloc(size);
+	lazy = malloc(size);
+	ut_assert(full && lazy);
+
+	base = mallinfo().uordblks;
+	ut_assertok(dm_scan_platdata(false));
+	ut_assertok(dm_scan_fdt(gd->fdt_blob, false));
+	full_used = mallinfo().uordblks - base;
+	ut_assertok(dm_test_describe(uts, full, size));
+	ut_assertok(dm_test_restart(uts));
+
+	base = mallinfo().uordblks;
+	ut_assertok(dm_scan_platdata(false));
+	ut_assertok(dm_scan_fdt_lazy(gd->fdt_blob));
+	lazy_used = mallinfo().uordblks - base;
+	printf("Memory used by scan: full %lu, lazy %lu\n", full_used,
+	       lazy_used);
+	ut_assert(lazy_used < full_used);
+	ut_assert(!uclass_find(UCLASS_TEST_FDT));
+
+	/* Looking up a device by its alias binds it */
+	ut_assertok(uclass_find_device_by_seq(UCLASS_TEST_FDT, 8, true, &dev));
+	ut_asserteq_str("a-test", dev->name);
+	ut_assert(!uclass_find(UCLASS_SPI));
+
+	/* A PMIC's regulators are bound by name, not from compatible strings */
+	ut_assertok(uclass_find_first_device(UCLASS_REGULATOR, &dev));
+	ut_assert(dev);
+	ut_assert(!uclass_find(UCLASS_SPI));
+
+	/* Once everything is bound it should look the same as a full scan */
+	ut_assertok(dm_bind_pending_all());
+	ut_assertok(dm_test_describe(uts, lazy, size));
+	ut_asserteq_str(full, lazy);
+	free(full);
+	free(lazy);
+
+	return 0;
+}
+DM_TEST(dm_test_fdt_lazy_bind, 0);
+
+/*
+ * Test that getting each uclass on its own binds all of its devices. This
+ * catches a driver which binds devices by name in another uclass without
+ * giving that uclass in bind_uclass.
+ */
+static int dm_test_fdt_lazy_bind_uclass(struct unit_test_state *uts)
+{
+	int full_count[UCLASS_COUNT];
+	struct udevice *dev;
+	struct uclass *uc;
+	int id, count;
+
+	ut_assertok(dm_scan_platdata(false));
+	ut_assertok(dm_scan_fdt(gd->fdt_blob, false));
+	for (id = 0; id < UCLASS_COUNT; id++) {
+		full_count[id] = 0;
+		uc = uclass_find(id);
+		if (uc) {
+			list_for_each_entry(dev, &uc->dev_head, uclass_node)
+				full_count[id]++;
+		}
+	}
+
+	for (id = 0; id < UCLASS_COUNT; id++) {
+		if (!full_count[id])
+			continue;
+		ut_assertok(dm_test_restart(uts));
+		ut_assertok(dm_scan_platdata(false));
+		ut_assertok(dm_scan_fdt_lazy(gd->fdt_blob));
+		ut_assertok(uclass_get(id, &uc));
+		count = 0;
+		list_for_each_entry(dev, &uc->dev_head, uclass_node)
+			count++;
+		if (count != full_count[id]) {
+			printf("Uclass '%s' has %d devices, expected %d: is bind_uclass missing?\n",
+			       uc->uc_drv->name, count, full_count[id]);
+		}
+		ut_asserteq(full_count[id], count);
+	}
+
+	return 0;
+}
+DM_TEST(dm_test_fdt_lazy_bind_uclass, 0);
+
+/* Test that a by-name lookup finds devices bound without bind_uclass */
+static int dm_test_fdt_lazy_bind_name(struct unit_test_state *uts)
+{
+	enum uclass_id bind_uclass;
+	struct udevice *dev;
+	struct driver *drv;
+
+	/* Pretend that the PMIC driver does not declare its regulators */
+	drv = lists_driver_lookup_name("sandbox_pmic");
+	ut_assertnonnull(drv);
+	bind_uclass = drv->bind_uclass;
+	drv->bind_uclass = UCLASS_ROOT;
+	ut_assertok(dm_scan_platdata(false));
+	ut_assertok(dm_scan_fdt_lazy(gd->fdt_blob));
+	drv->bind_uclass = bind_uclass;
+
+	ut_assertok(uclass_find_first_device(UCLASS_REGULATOR, &dev));
+	ut_assert(!dev);
+	ut_assert(dm_has_pending());
+
+	/* The miss binds the remaining nodes, so the regulator is found */
+	ut_assertok(uclass_find_device_by_name(UCLASS_REGULATOR, "buck1",
+					       &dev));
+	ut_asserteq_str("buck1", dev->name);
+	ut_assert(!dm_has_pending());
+	ut_asserteq(-ENODEV, uclass_find_device_by_name(UCLASS_REGULATOR,
+							"not-a-regulator",
+							&dev));
+
+	return 0;
+}
+DM_TEST(dm_test_fdt_lazy_bind_name, 0);
+#endif
+
+#if CONFIG_IS_ENABLED(DM_KEEP_PRE_RELOC)
+static const struct dm_test_pdata keep_pdata = {
+	.ping_add	= 7,
+};
+
+static struct driver_info keep_info = {
+	.name		= "test_pre_reloc_drv",
+	.platdata	= &keep_pdata,
+};
+
+/* Test that devices bound before relocation are kept, not bound again */
+static int dm_test_fdt_keep_pre_reloc(struct unit_test_state *uts)
+{
+	const int size = 16 << 10;
+	struct udevice *old_dev, *old_bus, *old_manual, *dev, *bus;
+	int ping_total, pingret, seq;
+	struct dm_test_priv *priv;
+	char *full, *kept;
+	int node;
+
+	full = malloc(size);
+	kept = malloc(size);
+	ut_assert(full && kept);
+
+	ut_assertok(dm_scan_platdata(false));
+	ut_assertok(dm_scan_fdt(gd->fdt_blob, false));
+	ut_assertok(dm_test_describe(uts, full, size));
+	ut_assertok(dm_test_restart(uts));
+
+	/* Bind the pre-relocation devices and probe one */
+	ut_assertok(dm_scan_platdata(true));
+	ut_assertok(dm_scan_fdt(gd->fdt_blob, true));
+	ut_assertok(uclass_get_device_by_name(UCLASS_TEST_FDT, "a-test",
+					      &old_dev));
+	ut_assertok(test_ping(old_dev, 100, &pingret));
+	priv = dev_get_priv(old_dev);
+	ping_total = priv->ping_total;
+	seq = old_dev->seq;
+	ut_assert(seq != -1);
+
+	/* A device whose platform data is not auto-allocated is not kept */
+	ut_assertok(device_bind_by_name(gd->dm_root, true, &keep_info,
+					&old_manual));
+
+	/* Bind a bus without its children, as happens before relocation */
+	node = fdt_path_offset(gd->fdt_blob, "/some-bus");
+	ut_assert(node > 0);
+	ut_assertok(lists_bind_fdt(gd->dm_root, gd->fdt_blob, node, &old_bus));
+	ut_assertok(dm_scan_fdt_node(old_bus, gd->fdt_blob, node, true));
+	ut_assert(list_empty(&old_bus->child_head));
+
+	/* Now start again after 'relocation' */
+	gd->dm_root_f = gd->dm_root;
+	gd->dm_root = NULL;
+	ut_assertok(dm_init_and_scan(false));
+	gd->dm_root_f = NULL;
+
+	/* The probed device is a copy which was not probed again */
+	ut_assertok(uclass_find_device_by_name(UCLASS_TEST_FDT, "a-test",
+					       &dev));
+	ut_assert(dev != old_dev);
+	ut_assert(dev->flags & DM_FLAG_RELOCATED);
+	ut_assert(device_active(dev));
+	ut_asserteq(seq, dev->seq);
+	ut_asserteq(dev_get_driver_data(old_dev), dev_get_driver_data(dev));
+	priv = dev_get_priv(dev);
+	ut_assert(priv != dev_get_priv(old_dev));
+	ut_asserteq(ping_total, priv->ping_total);
+
+	ut_asserteq(-ENODEV, uclass_find_device_by_name(UCLASS_TEST,
+							keep_info.name, &dev));
+	ut_assert(!device_can_relocate(old_manual));
+
+	/* Devices which were not probed are kept but not probed */
+	ut_assertok(uclass_find_device_by_name(UCLASS_TEST_BUS, "some-bus",
+					       &bus));
+	ut_assert(bus->flags & DM_FLAG_RELOCATED);
+	ut_assert(!device_active(bus));
+
+	/* Apart from that it should look the same as a full scan */
+	ut_assertok(dm_bind_pending_all());
+	ut_assertok(dm_test_describe(uts, kept, size));
+	ut_asserteq_str(full, kept);
+	free(full);
+	free(kept);
+
+	/* The bus binds its other children when probed */
+	ut_assert(bus->flags & DM_FLAG_PRE_RELOC_CHILDREN);
+	ut_assert(list_empty(&bus->child_head));
+	ut_assertok(device_probe(bus));
+	ut_assert(!(bus->flags & DM_FLAG_PRE_RELOC_CHILDREN));
+	ut_assertok(device_find_first_child(bus, &dev));
+	ut_asserteq_str("c-test@5", dev->name);
+	ut_assert(!(dev->flags & DM_FLAG_RELOCATED));
+
+	return 0;
+}
+DM_TEST(dm_test_fdt_keep_pre_reloc, 0);
+#endif
+
+#if CONFIG_IS_ENABLED(OF_LIVE)
+static const char *const live_alias_bases[] = {
+	"eth", "i2c", "spi", "testbus", "testfdt", "usb",
+};
+
+/* Check that the live node at an offset matches the FDT */
+static int dm_test_check_live_node(struct unit_test_state *uts,
+				   struct of_live *live, int offset)
+{
+	const void *blob = gd->fdt_blob;
+	int prop_offset, count = 0;
+	struct of_node *np;
+	uint32_t phandle;
+	int i;
+
+	np = of_live_node(live, offset);
+	ut_assertnonnull(np);
+	ut_asserteq_str(fdt_get_name(blob, offset, NULL), np->name);
+	ut_asserteq(fdt_parent_offset(blob, offset),
+		    of_live_parent_offset(live, offset));
+
+	for (prop_offset = fdt_first_property_offset(blob, offset);
+	     prop_offset >= 0;
+	     prop_offset = fdt_next_property_offset(blob, prop_offset)) {
+		const char *name;
+		const void *value;
+		int len, live_len;
+
+		value = fdt_getprop_by_offset(blob, prop_offset, &name, &len);
+		ut_asserteq_ptr(value, of_live_getprop(np, name, &live_len));
+		ut_asserteq(len, live_len);
+		count++;
+	}
+	ut_asserteq(count, np->prop_count);
+
+	phandle = fdt_get_phandle(blob, offset);
+	ut_asserteq(phandle, np->phandle);
+	if (phandle) {
+		ut_asserteq(fdt_node_offset_by_phandle(blob, phandle),
+			    of_live_node_by_phandle(live, phandle));
+	}
+
+	/* gd->of_live is NULL here, so this uses the FDT */
+	for (i = 0; i < ARRAY_SIZE(live_alias_bases); i++) {
+		const char *base = live_alias_bases[i];
+		int seq = -1, live_seq = -1;
+
+		ut_asserteq(fdtdec_get_alias_seq(blob, base, offset, &seq),
+			    of_live_alias_seq(live, base, offset, &live_seq));
+		ut_asserteq(seq, live_seq);
+	}
+
+	return 0;
+}
+
+/* Test that the live tree matches the FDT and is used for lookups */
+static int dm_test_fdt_live(struct unit_test_state *uts)
+{
+	static const char *const paths[] = {
+		"/", "/a-test", "/some-bus/c-test@5", "/some-bus/c-test",
+		"/i2c@0/pmic", "testfdt5", "testfdt3/", "/missing",
+		"/some-bus/c-test@9", "missing", "missing/a-test",
+	};
+	const void *blob = gd->fdt_blob;
+	struct of_live *saved = gd->of_live;
+	struct of_live *live, *copy_live;
+	int offset, depth = 0, count = 0;
+	const int loops = 2000;
+	ulong start, time[2];
+	struct udevice *dev;
+	int phandle_node;
+	int pass, i, seq;
+	u32 reg[2];
+	void *copy, *scratch;
+
+	ut_assertok(of_live_build(blob, &live));
+	gd->of_live = NULL;
+	for (offset = 0; offset >= 0 && depth >= 0;
+	     offset = fdt_next_node(blob, offset, &depth)) {
+		ut_assertok(dm_test_check_live_node(uts, live, offset));
+		count++;
+	}
+	ut_asserteq(count, live->node_count);
+	ut_asserteq_ptr(NULL, of_live_node(live, 4));
+	for (i = 0; i < ARRAY_SIZE(paths); i++) {
+		ut_asserteq(fdt_path_offset(blob, paths[i]),
+			    of_live_path_offset(live, paths[i]));
+	}
+
+	/* The dev_read functions give the same results with either tree */
+	ut_assertok(uclass_get_device_by_name(UCLASS_TEST_FDT, "a-test", &dev));
+	phandle_node = dev_read_phandle(dev, "test-gpios");
+	ut_assert(phandle_node > 0);
+	for (pass = 0; pass < 2; pass++) {
+		gd->of_live = pass ? live : NULL;
+		ut_asserteq(phandle_node, dev_read_phandle(dev, "test-gpios"));
+		ut_asserteq(phandle_node,
+			    fdtdec_lookup_phandle(blob, dev->of_offset,
+						  "test-gpios"));
+		ut_asserteq(0, dev_read_u32_default(dev, "ping-add", -1));
+		ut_asserteq(-1, dev_read_u32_default(dev, "missing", -1));
+		ut_asserteq_str("denx,u-boot-fdt-test",
+				dev_read_string(dev, "compatible"));
+		ut_assert(dev_read_bool(dev, "u-boot,dm-pre-reloc"));
+		ut_assert(!dev_read_bool(dev, "missing"));
+		ut_assertok(dev_read_u32_array(dev, "reg", reg, 2));
+		ut_asserteq(0, reg[0]);
+		ut_asserteq(1, reg[1]);
+		ut_asserteq(-FDT_ERR_BADLAYOUT,
+			    dev_read_u32_array(dev, "reg", reg, 3));
+		ut_assertok(dev_read_alias_seq(dev, &seq));
+		ut_asserteq(8, seq);
+	}
+
+	/* Compare the time taken by phandle and alias lookups */
+	for (pass = 0; pass < 2; pass++) {
+		gd->of_live = pass ? NULL : live;
+		start = timer_get_us();
+		for (i = 0; i < loops; i++) {
+			fdtdec_lookup_phandle(blob, dev->of_offset,
+					      "test-gpios");
+			fdtdec_get_alias_seq(blob, "testfdt", dev->of_offset,
+					     &seq);
+			fdtdec_get_chosen_node(blob, "stdout-path");
+		}
+		time[pass] = timer_get_us() - start;
+	}
+	printf("%d lookups: live tree %lu us, flat tree %lu us\n", loops * 3,
+	       time[0], time[1]);
+
+	copy = malloc(fdt_totalsize(blob) + 256);
+	ut_assertnonnull(copy);
+	ut_assertok(fdt_open_into(blob, copy, fdt_totalsize(blob) + 256));
+
+	/* Writing to a different FDT leaves the live tree alone */
+	scratch = malloc(fdt_totalsize(blob) + 256);
+	ut_assertnonnull(scratch);
+	ut_assertok(of_live_build(copy, &copy_live));
+	gd->of_live = copy_live;
+	ut_assertok(fdt_open_into(blob, scratch, fdt_totalsize(blob) + 256));
+	ut_assertok(fdt_setprop_u32(scratch, 0, "new-prop", 1));
+	ut_asserteq_ptr(copy_live, of_live_get(copy));
+	free(scratch);
+	gd->of_live = NULL;
+	of_live_free(copy_live);
+
+	/* Writing to the FDT, even in place, makes the live tree out of date */
+	for (pass = 0; pass < 2; pass++) {
+		ut_assertok(of_live_build(copy, &copy_live));
+		gd->of_live = copy_live;
+		ut_asserteq_ptr(copy_live, of_live_get(copy));
+		ut_asserteq_ptr(NULL, of_live_get(blob));
+		if (pass) {
+			ut_assertok(fdt_setprop_u32(copy, 0, "new-prop", 1));
+		} else {
+			ut_assertok(fdt_setprop_inplace_u32(copy,
+							    dev->of_offset,
+							    "ping-add", 1));
+		}
+		ut_asserteq_ptr(NULL, of_live_get(copy));
+		ut_asserteq_ptr(NULL, gd->of_live);
+	}
+
+	/* Only aliases which hold a full path give a sequence number */
+	offset = fdt_path_offset(copy, "/aliases");
+	ut_assert(offset >= 0);
+	ut_assertok(fdt_setprop_string(copy, offset, "live4", "a-test"));
+	ut_assertok(fdt_setprop_string(copy, offset, "live5", "/a-test"));
+	ut_assertok(fdt_setprop_string(copy, offset, "livetest6", "a-test"));
+	ut_assertok(of_live_build(copy, &copy_live));
+	gd->of_live = NULL;
+	offset = fdt_path_offset(copy, "/a-test");
+	ut_assertok(fdtdec_get_alias_seq(copy, "live", offset, &seq));
+	ut_asserteq(5, seq);
+	ut_assertok(of_live_alias_seq(copy_live, "live", offset, &seq));
+	ut_asserteq(5, seq);
+	ut_asserteq(-ENOENT,
+		    fdtdec_get_alias_seq(copy, "livetest", offset, &seq));
+	ut_asserteq(-ENOENT,
+		    of_live_alias_seq(copy_live, "livetest", offset, &seq));
+	of_live_free(copy_live);
+	free(copy);
+
+	gd->of_live = saved;
+	of_live_free(live);
+
+	return 0;
+}
+DM_TEST(dm_test_fdt_live, DM_TESTF_SCAN_PDATA | DM_TESTF_SCAN_FDT);
+#endif
@@ -61,6 +61,67 @@ static int env_test_attrs_lookup(struct unit_test_state *uts)
 }
 ENV_TEST(env_test_attrs_lookup, 0);
 
+/* Look up a name in an index built from a static and a dynamic list */
+static const char *index_lookup(struct env_attr_index *index,
+				const char *static_list, const char *list,
+				const char *name)
+{
+	env_attr_index_free(index);
+	if (env_attr_index_update(index, static_list, list))
+		return NULL;
+
+	return env_attr_index_lookup(index, name);
+}
+
+static int env_test_attrs_index(struct unit_test_state *uts)
+{
+	struct env_attr_index index = {};
+	const char *attrs;
+	char value[32];
+
+	ut_asserteq_str("bar", index_lookup(&index, "", "foo:bar", "foo"));
+	ut_asserteq_str("bar", index_lookup(&index, "", ",foo:bar,", "foo"));
+	ut_asserteq_str("bar", index_lookup(&index, "", " foo: bar ", "foo"));
+	ut_asserteq_str("bar", index_lookup(&index, "", ",foo:bar,goo:baz",
+					    "foo"));
+	ut_asserteq_str("", index_lookup(&index, "", "foo", "foo"));
+	ut_asserteq_ptr(NULL, index_lookup(&index, "", ",,", "foo"));
+	ut_asserteq_ptr(NULL, index_lookup(&index, "", "goo:baz", "foo"));
+	ut_asserteq_ptr(NULL, index_lookup(&index, "", NULL, "foo"));
+	ut_asserteq_str("baz", index_lookup(&index, "",
+		"foo:bar,foo:bat,foo:baz", "foo"));
+	ut_asserteq_str("bat", index_lookup(&index, "",
+		" foo : bar , foo : bat , foot : baz ", "foo"));
+	ut_asserteq_str("bat", index_lookup(&index, "",
+		" foo : bar , foo : bat , ufoo : baz ", "foo"));
+
+	/* values are parsed as env_attr_lookup() does */
+	ut_assertok(env_attr_lookup("foo: bar baz", "foo", value));
+	ut_asserteq_str(value, index_lookup(&index, "", "foo: bar baz",
+					    "foo"));
+
+	/* the dynamic list overrides the static one */
+	ut_asserteq_str("dyn", index_lookup(&index, "foo:stat", "foo:dyn",
+					    "foo"));
+	ut_asserteq_str("stat", index_lookup(&index, "foo:stat", "goo:dyn",
+					     "foo"));
+	ut_asserteq_str("stat", index_lookup(&index, "foo:stat", NULL, "foo"));
+
+	/* the index is only rebuilt when the dynamic list changes */
+	attrs = index_lookup(&index, "foo:stat", "goo:dyn", "goo");
+	ut_assertok(env_attr_index_update(&index, "foo:stat", "goo:dyn"));
+	ut_asserteq_ptr(attrs, env_attr_index_lookup(&index, "goo"));
+	ut_assertok(env_attr_index_update(&index, "foo:stat", "goo:new"));
+	ut_asserteq_str("new", env_attr_index_lookup(&index, "goo"));
+	ut_assertok(env_attr_index_update(&index, "foo:stat", NULL));
+	ut_asserteq_ptr(NULL, env_attr_index_lookup(&index, "goo"));
+
+	env_attr_index_free(&index);
+
+	return 0;
+}
+ENV_TEST(env_test_attrs_index, 0);
+
 #ifdef CONFIG_REGEX
 static int env_test_attrs_lookup_regex(struct unit_test_state *uts)
 {
@@ -86,4 +147,29 @@ static int env_test_attrs_lookup_regex(struct unit_test_state *uts)
 	return 0;
 }
 ENV_TEST(env_test_attrs_lookup_regex, 0);
+
+static int env_test_attrs_index_regex(struct unit_test_state *uts)
+{
+	struct env_attr_index index = {};
+
+	ut_asserteq_str("bar", index_lookup(&index, "", "foo1?:bar", "foo"));
+	ut_asserteq_str("bar", index_lookup(&index, "", "foo1?:bar", "foo1"));
+	ut_asserteq_str("bar", index_lookup(&index, "", ".foo:bar", ".foo"));
+	ut_asserteq_str("bar", index_lookup(&index, "", ".foo:bar", "ufoo"));
+	ut_asserteq_str("bar", index_lookup(&index, "", "\\.foo:bar", ".foo"));
+	ut_asserteq_ptr(NULL, index_lookup(&index, "", "\\.foo:bar", "ufoo"));
+
+	/* the last matching entry wins, whether it is a regex or not */
+	ut_asserteq_str("b", index_lookup(&index, "", "foo1?:a,foo:b", "foo"));
+	ut_asserteq_str("a", index_lookup(&index, "", "foo:b,foo1?:a", "foo"));
+	ut_asserteq_str("dyn", index_lookup(&index, "eth\\d?addr:stat",
+					    "ethaddr:dyn", "ethaddr"));
+	ut_asserteq_str("stat", index_lookup(&index, "eth\\d?addr:stat",
+					     "ethaddr:dyn", "eth1addr"));
+
+	env_attr_index_free(&index);
+
+	return 0;
+}
+ENV_TEST(env_test_attrs_index_regex, 0);
 #endif
@@ -0,0 +1,247 @@
+/*
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <environment.h>
+#include <malloc.h>
+#include <search.h>
+#include <test/env.h>
+#include <test/ut.h>
+
+/* Number of variables and flag entries in the test environment (~64KB) */
+#define IMPORT_VARS		2048
+#define IMPORT_FLAGS		64
+
+/* Build a list of "bench<n>:do" entries for ".flags" */
+static char *import_flags_list(void)
+{
+	char *list, *ptr;
+	int i;
+
+	list = malloc(IMPORT_FLAGS * 16);
+	if (!list)
+		return NULL;
+	for (i = 0, ptr = list; i < IMPORT_FLAGS; i++)
+		ptr += sprintf(ptr, "%sbench%d:do", i ? "," : "",
+			       i * (IMPORT_VARS / IMPORT_FLAGS));
+
+	return list;
+}
+
+/* Build an environment in "env import" format, returning its size */
+static int import_env(char **envp)
+{
+	char *env, *ptr;
+	int i;
+
+	env = malloc(IMPORT_VARS * 40 + 1);
+	if (!env)
+		return -ENOMEM;
+	for (i = 0, ptr = env; i < IMPORT_VARS; i++)
+		ptr += sprintf(ptr, "bench%d=value of %014d",
+			       i, i) + 1;
+	*ptr++ = '\0';
+	*envp = env;
+
+	return ptr - env;
+}
+
+/* Time the lookups which importing the environment used to do */
+static ulong import_time_old(const char *flags_list)
+{
+	const char *callback_list = getenv(ENV_CALLBACK_VAR);
+	char attrs[256], name[16];
+	ulong start;
+	int i;
+
+	start = timer_get_us();
+	for (i = 0; i < IMPORT_VARS; i++) {
+		sprintf(name, "bench%d", i);
+		if (!callback_list ||
+		    env_attr_lookup(callback_list, name, attrs))
+			env_attr_lookup(ENV_CALLBACK_LIST_STATIC, name, attrs);
+		if (env_attr_lookup(flags_list, name, attrs))
+			env_attr_lookup(ENV_FLAGS_LIST_STATIC, name, attrs);
+	}
+
+	return timer_get_us() - start;
+}
+
+/*
+ * Import a large environment with a ".flags" list, check that the flags are
+ * applied and report how long it took
+ */
+static int env_test_import_bench(struct unit_test_state *uts)
+{
+	struct hsearch_data htab;
+	ulong import_us, old_us;
+	char *env, *flags_list;
+	ENTRY e, *ep;
+	int size;
+
+	flags_list = import_flags_list();
+	ut_assertnonnull(flags_list);
+	size = import_env(&env);
+	ut_assert(size > 0);
+	ut_assertok(setenv(ENV_FLAGS_VAR, flags_list));
+
+	/* the table must be sized for all the variables, not just 512 */
+	memset(&htab, '\0', sizeof(htab));
+	import_us = timer_get_us();
+	ut_assert(himport_r(&htab, env, size, '\0', 0, 0, 0, NULL));
+	import_us = timer_get_us() - import_us;
+	ut_asserteq(IMPORT_VARS, htab.filled);
+
+	/* bench0 is in ".flags" and bench1 is not */
+	e.key = "bench0";
+	e.data = NULL;
+	ut_assert(hsearch_r(e, FIND, &ep, &htab, 0));
+	ut_asserteq(env_flags_vartype_decimal |
+		    ENV_FLAGS_VARACCESS_PREVENT_DELETE |
+		    ENV_FLAGS_VARACCESS_PREVENT_OVERWR, ep->flags);
+	e.key = "bench1";
+	ut_assert(hsearch_r(e, FIND, &ep, &htab, 0));
+	ut_asserteq(0, ep->flags);
+
+	old_us = import_time_old(flags_list);
+	printf("Imported %d variables (%d bytes) in %lu us; attribute list lookups alone took %lu us before\n",
+	       IMPORT_VARS, size, import_us, old_us);
+
+	hdestroy_r(&htab);
+	ut_assertok(setenv(ENV_FLAGS_VAR, NULL));
+	free(env);
+	free(flags_list);
+
+	return 0;
+}
+ENV_TEST(env_test_import_bench, 0);
+
+static struct hsearch_data *count_htab;
+static int count_allocs;
+
+/* Count the strings in an entry which have their own allocation */
+static int import_count_entry(ENTRY *ep)
+{
+	const char *arena = count_htab->arena;
+	const char *arena_end = arena + count_htab->arena_size;
+
+	if (ep->key < arena || ep->key >= arena_end)
+		count_allocs++;
+	if (ep->data < arena || ep->data >= arena_end)
+		count_allocs++;
+
+	return 0;
+}
+
+/*
+ * Import an environment with or without H_ARENA, returning the time taken,
+ * the number of malloc() calls and the heap space used
+ */
+static int import_measure(struct unit_test_state *uts,
+			  struct hsearch_data *htab, const char *env, int size,
+			  int flag, ulong *usp, int *allocsp, int *heapp)
+{
+	int heap = mallinfo().uordblks;
+
+	memset(htab, '\0', sizeof(*htab));
+	*usp = timer_get_us();
+	ut_assert(himport_r(htab, env, size, '\0', flag, 0, 0, NULL));
+	*usp = timer_get_us() - *usp;
+	*heapp = mallinfo().uordblks - heap;
+	ut_asserteq(IMPORT_VARS, htab->filled);
+
+	/* the table and the copy of the data, plus any separate strings */
+	count_htab = htab;
+	count_allocs = 2;
+	hwalk_r(htab, import_count_entry);
+	*allocsp = count_allocs;
+
+	return 0;
+}
+
+/*
+ * Compare importing into an arena with copying each string, and check that
+ * entries in the arena can still be changed and deleted
+ */
+static int env_test_import_arena(struct unit_test_state *uts)
+{
+	int copy_allocs, arena_allocs, copy_heap, arena_heap;
+	struct hsearch_data htab;
+	ulong copy_us, arena_us;
+	ENTRY e, *ep;
+	char *env;
+	int size;
+
+	size = import_env(&env);
+	ut_assert(size > 0);
+
+	ut_assertok(import_measure(uts, &htab, env, size, 0, &copy_us,
+				   &copy_allocs, &copy_heap));
+	ut_asserteq_ptr(NULL, htab.arena);
+	ut_asserteq(2 + IMPORT_VARS * 2, copy_allocs);
+	hdestroy_r(&htab);
+
+	ut_assertok(import_measure(uts, &htab, env, size, H_ARENA, &arena_us,
+				   &arena_allocs, &arena_heap));
+	ut_assertnonnull(htab.arena);
+	ut_asserteq(2, arena_allocs);
+
+	/* changing a variable gives it its own copy of the value */
+	e.key = "bench1";
+	e.data = "changed";
+	ut_assert(hsearch_r(e, ENTER, &ep, &htab, 0));
+	ut_asserteq_str("changed", ep->data);
+	ut_assert(ep->data < htab.arena ||
+		  ep->data >= htab.arena + htab.arena_size);
+	ut_assert(hdelete_r("bench1", &htab, 0));
+	ut_assert(hdelete_r("bench2", &htab, 0));
+	e.key = "bench2";
+	e.data = NULL;
+	ut_asserteq(0, hsearch_r(e, FIND, &ep, &htab, 0));
+	e.key = "bench3";
+	ut_assert(hsearch_r(e, FIND, &ep, &htab, 0));
+	ut_asserteq_str("value of 00000000000003", ep->data);
+	hdestroy_r(&htab);
+	ut_asserteq_ptr(NULL, htab.arena);
+
+	printf("Imported %d variables: copying %d mallocs, %d bytes, %lu us; arena %d mallocs, %d bytes, %lu us\n",
+	       IMPORT_VARS, copy_allocs, copy_heap, copy_us, arena_allocs,
+	       arena_heap, arena_us);
+	free(env);
+
+	return 0;
+}
+ENV_TEST(env_test_import_arena, 0);
+
+/*
+ * Check that the table is sized for the whole environment area, while only
+ * the variables in it are copied
+ */
+static int env_test_import_size(struct unit_test_state *uts)
+{
+	static const char vars[] = "a=1\0b=2\0";
+	struct hsearch_data small, full;
+	char *env;
+
+	env = calloc(1, CONFIG_ENV_SIZE);
+	ut_assertnonnull(env);
+	memcpy(env, vars, sizeof(vars));
+
+	memset(&small, '\0', sizeof(small));
+	ut_assert(himport_r(&small, env, sizeof(vars), '\0', H_ARENA, 0, 0,
+			    NULL));
+	memset(&full, '\0', sizeof(full));
+	ut_assert(himport_r(&full, env, CONFIG_ENV_SIZE, '\0', H_ARENA, 0, 0,
+			    NULL));
+	ut_asserteq(2, full.filled);
+	ut_asserteq(sizeof(vars) - 1 + 2, full.arena_size);
+	ut_assert(full.size > small.size);
+
+	hdestroy_r(&small);
+	hdestroy_r(&full);
+	free(env);
+
+	return 0;
+}
+ENV_TEST(env_test_import_size, 0);
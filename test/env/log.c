@@ -0,0 +1,333 @@
+/*
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <command.h>
+#include <env_log.h>
+#include <environment.h>
+#include <malloc.h>
+#include <sandboxblockdev.h>
+#include <search.h>
+#include <spi_flash.h>
+#include <test/env.h>
+#include <test/ut.h>
+
+#define LOG_SLOTS	3
+
+static const char log_env[] =
+	"arch=sandbox\0"
+	"baudrate=115200\0"
+	"bootcmd=run distro_bootcmd\0"
+	"bootdelay=3\0"
+	"stderr=serial\0"
+	"stdin=serial\0"
+	"stdout=serial\0";
+
+/* The storage methods being tested, with counts of what they do */
+static const struct env_log_ops *log_ops;
+static int log_erases, log_writes, log_bytes;
+
+static int log_read(struct env_log *log, ulong offset, size_t size, void *buf)
+{
+	return log_ops->read(log, offset, size, buf);
+}
+
+static int log_write(struct env_log *log, ulong offset, size_t size,
+		     const void *buf)
+{
+	log_writes++;
+	log_bytes += size;
+
+	return log_ops->write(log, offset, size, buf);
+}
+
+static int log_erase(struct env_log *log, ulong offset, size_t size)
+{
+	log_erases++;
+
+	return log_ops->erase(log, offset, size);
+}
+
+static const struct env_log_ops log_counting_ops = {
+	.read	= log_read,
+	.write	= log_write,
+	.erase	= log_erase,
+};
+
+static const struct env_log_ops log_counting_noerase_ops = {
+	.read	= log_read,
+	.write	= log_write,
+};
+
+/* Set a variable in a table, or delete it if @value is NULL */
+static int log_setenv(struct hsearch_data *htab, const char *name,
+		      const char *value)
+{
+	ENTRY e, *ep;
+
+	if (!value)
+		return hdelete_r(name, htab, 0) ? 0 : -ENOENT;
+	e.key = name;
+	e.data = (char *)value;
+	e.callback = NULL;
+
+	return hsearch_r(e, ENTER, &ep, htab, 0) ? 0 : -EINVAL;
+}
+
+/* Erase all the slots, or fill them with zeroes if there is no erase */
+static int log_clear(struct unit_test_state *uts, struct env_log *log)
+{
+	char *buf;
+	int ret;
+	int i;
+
+	buf = calloc(1, log->slot_size);
+	ut_assertnonnull(buf);
+	for (i = 0; i < log->slots; i++) {
+		ulong offset = log->offset + i * log->slot_size;
+
+		if (log_ops->erase)
+			ret = log_ops->erase(log, offset, log->slot_size);
+		else
+			ret = log_ops->write(log, offset, log->slot_size, buf);
+		ut_assertok(ret);
+	}
+	free(buf);
+
+	return 0;
+}
+
+/* Check that loading the log gives the same variables as @htab */
+static int log_check(struct unit_test_state *uts, struct env_log *log,
+		     struct hsearch_data *htab)
+{
+	struct env_log check = *log;
+	struct hsearch_data loaded;
+	char *expect = NULL, *actual = NULL;
+	ssize_t size;
+
+	check.saved = NULL;
+	memset(&loaded, '\0', sizeof(loaded));
+	ut_assertok(env_log_load(&check, &loaded, H_ARENA));
+	ut_asserteq(log->slot, check.slot);
+	ut_asserteq(log->used, check.used);
+
+	size = hexport_r(htab, '\0', 0, &expect, 0, 0, NULL);
+	ut_assert(size > 0);
+	ut_asserteq(size, hexport_r(&loaded, '\0', 0, &actual, 0, 0, NULL));
+	ut_assertok(memcmp(expect, actual, size));
+
+	free(expect);
+	free(actual);
+	env_log_free(&check);
+	hdestroy_r(&loaded);
+
+	return 0;
+}
+
+/*
+ * Run through saving and loading a log: small changes should be appended,
+ * a full slot should move to the next one and a partly written record
+ * should be ignored
+ */
+static int log_test(struct unit_test_state *uts, struct env_log *log,
+		    const char *name)
+{
+	struct hsearch_data htab;
+	char value[80];
+	int erases, saves;
+	struct env_log_slot hdr;
+	ulong offset;
+	int slot;
+	uint used;
+	ENTRY e, *ep;
+	env_t *env;
+	char *buf;
+	u32 seq;
+	int ret;
+	int i;
+
+	/* start with empty storage */
+	memset(&htab, '\0', sizeof(htab));
+	ut_assertok(log_clear(uts, log));
+	ut_asserteq(-ENOENT, env_log_load(log, &htab, 0));
+	ut_asserteq(-1, log->slot);
+
+	ut_assert(himport_r(&htab, log_env, sizeof(log_env), '\0', 0, 0, 0,
+			    NULL));
+	ut_assertok(log_setenv(&htab, "bootcount", "0"));
+	log_erases = 0;
+	log_writes = 0;
+	log_bytes = 0;
+
+	/* the first save writes the whole environment */
+	ut_assertok(env_log_save(log, &htab));
+	ut_asserteq(0, log->slot);
+	ut_asserteq(log_ops->erase ? 1 : 0, log_erases);
+	ut_assertok(log_check(uts, log, &htab));
+	saves = 1;
+
+	/* a boot counter should only append small records */
+	used = log->used;
+	for (i = 1; i <= 20; i++) {
+		sprintf(value, "%d", i);
+		ut_assertok(log_setenv(&htab, "bootcount", value));
+		ut_assertok(env_log_save(log, &htab));
+		saves++;
+	}
+	ut_asserteq(0, log->slot);
+	ut_asserteq(log_ops->erase ? 1 : 0, log_erases);
+	ut_assert(log->used - used < 20 * 32);
+	ut_assertok(log_check(uts, log, &htab));
+
+	/* nothing changed, so nothing is written */
+	used = log->used;
+	ut_assertok(env_log_save(log, &htab));
+	ut_asserteq(used, log->used);
+
+	/* deleting and adding variables */
+	ut_assertok(log_setenv(&htab, "bootcount", NULL));
+	ut_assertok(log_setenv(&htab, "newvar", "new value"));
+	ut_assertok(env_log_save(log, &htab));
+	saves++;
+	ut_assertok(log_check(uts, log, &htab));
+
+	/* fill the slots so that the log moves through all of them */
+	erases = log_erases;
+	seq = log->seq;
+	for (i = 0; log->seq - seq < log->slots; i++) {
+		sprintf(value, "value %d which is long enough to fill the log",
+			i);
+		ut_assertok(log_setenv(&htab, "bigvar", value));
+		ut_assertok(env_log_save(log, &htab));
+		saves++;
+		ut_assert(i < 10000);
+	}
+	ut_asserteq(0, log->slot);
+	if (log_ops->erase)
+		ut_asserteq(erases + log->slots, log_erases);
+	ut_assertok(log_check(uts, log, &htab));
+
+	/* a record which was only partly written is ignored */
+	ut_assertok(log_setenv(&htab, "torn", "lost"));
+	used = log->used;
+	ut_assertok(env_log_save(log, &htab));
+	buf = calloc(1, 4);
+	ut_assertnonnull(buf);
+	ret = log_ops->write(log, log->offset + log->slot * log->slot_size +
+			     log->used - 4, 4, buf);
+	ut_assertok(ret);
+	free(buf);
+	ut_assertok(log_setenv(&htab, "torn", NULL));
+	log->used = used;
+	ut_assertok(log_check(uts, log, &htab));
+
+	/* after that the log goes on from the last good record */
+	ut_assertok(env_log_load(log, &htab, 0));
+	ut_asserteq(used, log->used);
+	ut_assertok(log_setenv(&htab, "after", "torn"));
+	ut_assertok(env_log_save(log, &htab));
+	saves++;
+	ut_assertok(log_check(uts, log, &htab));
+
+	printf("%s: %d saves: %d erases, %d writes, %d bytes; rewriting the whole environment would need %d erases, %d bytes\n",
+	       name, saves, log_erases, log_writes, log_bytes,
+	       log_ops->erase ? saves : 0, saves * CONFIG_ENV_SIZE);
+
+	/* if compaction stopped after the header, the older slot is used... */
+	slot = log->slot;
+	seq = log->seq;
+	offset = log->offset + (slot + 1) % log->slots * log->slot_size;
+	if (log_ops->erase)
+		ut_assertok(log_ops->erase(log, offset, log->slot_size));
+	hdr.magic = cpu_to_le32(ENV_LOG_MAGIC);
+	hdr.seq = cpu_to_le32(seq + 1);
+	hdr.crc = cpu_to_le32(crc32(0, (const uchar *)&hdr,
+				    offsetof(struct env_log_slot, crc)));
+	ut_assertok(log_ops->write(log, offset, sizeof(hdr), &hdr));
+	ut_assertok(env_log_load(log, &htab, 0));
+	ut_asserteq(slot, log->slot);
+	ut_asserteq(seq + 1, log->seq);
+
+	/* ...and the next save starts a new slot, with a new number */
+	ut_assertok(log_setenv(&htab, "fallback", "1"));
+	ut_assertok(env_log_save(log, &htab));
+	ut_asserteq((slot + 1) % log->slots, log->slot);
+	ut_asserteq(seq + 2, log->seq);
+	ut_assertok(log_check(uts, log, &htab));
+
+	/* an environment in the old format is loaded, then moved to slot 1 */
+	ut_assertok(log_clear(uts, log));
+	buf = calloc(1, CONFIG_ENV_SIZE);
+	ut_assertnonnull(buf);
+	env = (env_t *)buf;
+	memcpy(env->data, log_env, sizeof(log_env));
+	env->crc = crc32(0, env->data, ENV_SIZE);
+	ut_assertok(log_ops->write(log, log->offset, CONFIG_ENV_SIZE, buf));
+	free(buf);
+	hdestroy_r(&htab);
+	memset(&htab, '\0', sizeof(htab));
+	ut_assertok(env_log_load(log, &htab, 0));
+	e.key = "bootdelay";
+	e.data = NULL;
+	ut_assert(hsearch_r(e, FIND, &ep, &htab, 0));
+	ut_asserteq_str("3", ep->data);
+	ut_assertok(env_log_save(log, &htab));
+	ut_asserteq(1, log->slot);
+	ut_assertok(log_check(uts, log, &htab));
+
+	env_log_free(log);
+	hdestroy_r(&htab);
+
+	return 0;
+}
+
+/* Test the log on the sandbox SPI flash */
+static int env_test_log_sf(struct unit_test_state *uts)
+{
+	struct spi_flash *flash;
+	struct env_log log;
+
+	ut_assertok(run_command("sb save hostfs - 0 spi.bin 200000", 0));
+	flash = spi_flash_probe(0, 0, 0, 0);
+	ut_assertnonnull(flash);
+
+	memset(&log, '\0', sizeof(log));
+	log.ops = &log_counting_ops;
+	log.priv = flash;
+	log.offset = 0x100000;
+	log.slot_size = flash->erase_size;
+	log.slots = LOG_SLOTS;
+	log_ops = &env_log_sf_ops;
+	ut_assertok(log_test(uts, &log, "SPI flash"));
+	spi_flash_free(flash);
+
+	return 0;
+}
+ENV_TEST(env_test_log_sf, 0);
+
+/* Test the log on a block device, as used for MMC */
+static int env_test_log_blk(struct unit_test_state *uts)
+{
+	block_dev_desc_t *desc;
+	struct env_log log;
+
+	ut_assertok(run_command("sb save hostfs - 0 env_log.img 10000", 0));
+	ut_assertok(host_dev_bind(0, "env_log.img"));
+	desc = host_get_dev(0);
+	ut_assertnonnull(desc);
+
+	memset(&log, '\0', sizeof(log));
+	log.ops = &log_counting_noerase_ops;
+	log.priv = desc;
+	log.offset = 0x200;
+	log.slot_size = CONFIG_ENV_SIZE;
+	log.slots = LOG_SLOTS;
+	log_ops = &env_log_blk_ops;
+	ut_assertok(log_test(uts, &log, "Block device"));
+	ut_assertok(host_dev_bind(0, NULL));
+
+	return 0;
+}
+ENV_TEST(env_test_log_blk, 0);
@@ -0,0 +1,148 @@
+/*
+ * Tests and benchmark for command lookup in common/command.c
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <command.h>
+#include <errno.h>
+#include <malloc.h>
+
+#define BENCH_LOOPS	200
+#define SCRIPT_VALUES	100
+#define SCRIPT_LOOPS	10
+
+/* Commands run by each pass of the script's loop */
+#define SCRIPT_CMDS	4
+
+/* Check that find_cmd() agrees with a linear search of the table */
+static int test_find_cmd_one(const char *name)
+{
+	cmd_tbl_t *start = ll_entry_start(cmd_tbl_t, cmd);
+	const int count = ll_entry_count(cmd_tbl_t, cmd);
+	cmd_tbl_t *got, *expect;
+
+	got = find_cmd(name);
+	expect = find_cmd_tbl(name, start, count);
+	if (got != expect) {
+		printf("%s: '%s' found '%s', expected '%s'\n", __func__, name,
+		       got ? got->name : "(none)",
+		       expect ? expect->name : "(none)");
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Try every command, each abbreviation of it and some unknown names */
+static int test_find_cmd_compare(void)
+{
+	cmd_tbl_t *start = ll_entry_start(cmd_tbl_t, cmd);
+	const int count = ll_entry_count(cmd_tbl_t, cmd);
+	static const char *const other[] = {
+		"", ".", "md.b", "cp.l", "nosuchcommand", "zzz", "~", "e", "s",
+	};
+	cmd_tbl_t *cmdtp;
+	char name[40];
+	int i, len;
+
+	for (cmdtp = start; cmdtp != start + count; cmdtp++) {
+		strlcpy(name, cmdtp->name, sizeof(name));
+		for (len = strlen(name); len > 0; len--) {
+			name[len] = '\0';
+			if (test_find_cmd_one(name))
+				return -EINVAL;
+		}
+		snprintf(name, sizeof(name), "%s.w", cmdtp->name);
+		if (test_find_cmd_one(name))
+			return -EINVAL;
+		snprintf(name, sizeof(name), "%sx", cmdtp->name);
+		if (test_find_cmd_one(name))
+			return -EINVAL;
+	}
+	for (i = 0; i < ARRAY_SIZE(other); i++) {
+		if (test_find_cmd_one(other[i]))
+			return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Time looking up every command, returning the time per lookup in ns */
+static ulong bench_lookup(const char *what, bool linear)
+{
+	cmd_tbl_t *start = ll_entry_start(cmd_tbl_t, cmd);
+	const int count = ll_entry_count(cmd_tbl_t, cmd);
+	ulong delta, start_us;
+	cmd_tbl_t *cmdtp;
+	int loop;
+
+	start_us = timer_get_us();
+	for (loop = 0; loop < BENCH_LOOPS; loop++) {
+		for (cmdtp = start; cmdtp != start + count; cmdtp++) {
+			if (linear)
+				find_cmd_tbl(cmdtp->name, start, count);
+			else
+				find_cmd(cmdtp->name);
+		}
+	}
+	delta = timer_get_us() - start_us;
+	delta = delta * 1000 / (BENCH_LOOPS * count);
+	printf("%-8s %6lu ns per lookup\n", what, delta);
+
+	return delta;
+}
+
+/* Run a script which executes a lot of short commands */
+static int bench_script(ulong linear_ns, ulong index_ns)
+{
+	ulong delta, start_us, cmds;
+	char *script, *p;
+	int ret = 0;
+	int i;
+
+	script = malloc(SCRIPT_VALUES * 5 + 200);
+	if (!script)
+		return -ENOMEM;
+	p = script + sprintf(script, "for i in");
+	for (i = 0; i < SCRIPT_VALUES; i++)
+		p += sprintf(p, " %d", i);
+	strcpy(p, "; do setenv x ${i}; test ${x} = ${i}; true; false || true; "
+		  "done");
+
+	start_us = timer_get_us();
+	for (i = 0; i < SCRIPT_LOOPS; i++) {
+		if (run_command_list(script, -1, 0)) {
+			printf("%s: script failed\n", __func__);
+			ret = -EINVAL;
+			break;
+		}
+	}
+	delta = timer_get_us() - start_us;
+	free(script);
+
+	cmds = SCRIPT_LOOPS * SCRIPT_VALUES * SCRIPT_CMDS;
+	printf("Script ran %lu commands in %lu us; looking them up took %lu us, %lu us with a linear search\n",
+	       cmds, delta, cmds * index_ns / 1000, cmds * linear_ns / 1000);
+
+	return ret;
+}
+
+int do_ut_find_cmd(cmd_tbl_t *cmdtp, int flag, int argc,
+		   char * const argv[])
+{
+	ulong linear_ns, index_ns;
+	int ret = 0;
+
+	ret |= test_find_cmd_compare();
+
+	printf("%d commands\n", ll_entry_count(cmd_tbl_t, cmd));
+	linear_ns = bench_lookup("linear", true);
+	index_ns = bench_lookup("index", false);
+	ret |= bench_script(linear_ns, index_ns);
+
+	printf("Test %s\n", ret ? "failed" : "passed");
+
+	return ret ? CMD_RET_FAILURE : CMD_RET_SUCCESS;
+}
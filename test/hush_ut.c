@@ -0,0 +1,151 @@
+/*
+ * Tests and benchmark for the cache of parsed hush scripts
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <cli.h>
+#include <cli_hush.h>
+#include <command.h>
+#include <errno.h>
+
+DECLARE_GLOBAL_DATA_PTR;
+
+#define BENCH_LOOPS	50
+
+struct hush_test {
+	const char *script;	/* script to run */
+	int ret;		/* expected return value */
+	const char *var;	/* variable to check afterwards */
+	const char *value;	/* expected value of var */
+};
+
+static const struct hush_test hush_tests[] = {
+	{ "setenv r; for i in a b c; do setenv r ${r}${i}; done", 0,
+		"r", "abc" },
+	{ "if test x = y; then setenv r yes; else setenv r no; fi", 0,
+		"r", "no" },
+	{ "setenv r 1; false || setenv r ${r}2; true && setenv r ${r}3", 0,
+		"r", "123" },
+	{ "setenv r 1\nsetenv r ${r}2\n\nsetenv r ${r}3\n", 0, "r", "123" },
+	{ "s=x; setenv r ${s}${s}", 0, "r", "xx" },
+	{ "setenv r a; for i in 1 2; do for j in 3 4; do "
+		"setenv r ${r}${i}${j}; done; done", 0, "r", "a13142324" },
+	{ "setenv r 1; exit; setenv r 2", 0, "r", "1" },
+	{ "setenv r 1; false", 1, "r", "1" },
+	{ "if true; then", 1, NULL, NULL },
+	{ "setenv n; run rec", 0, "n", "xxx" },
+};
+
+/* Run each script several times and check it does the same every time */
+static int test_hush_scripts(void)
+{
+	const struct hush_test *test;
+	const char *value;
+	int i, pass, ret;
+
+	setenv("rec", "if test \"${n}\" != xxx; then setenv n ${n}x; run rec; "
+	       "else true; fi");
+	for (i = 0; i < ARRAY_SIZE(hush_tests); i++) {
+		test = &hush_tests[i];
+		for (pass = 0; pass < 3; pass++) {
+			ret = run_command_list(test->script, -1, 0);
+			if (ret != test->ret) {
+				printf("%s: '%s' pass %d returned %d, expected %d\n",
+				       __func__, test->script, pass, ret,
+				       test->ret);
+				return -EINVAL;
+			}
+			if (!test->var)
+				continue;
+			value = getenv(test->var);
+			if (!value || strcmp(value, test->value)) {
+				printf("%s: '%s' pass %d set %s='%s', expected '%s'\n",
+				       __func__, test->script, pass, test->var,
+				       value ? value : "(null)", test->value);
+				return -EINVAL;
+			}
+		}
+	}
+
+	/* changing a variable runs the new script */
+	setenv("s", "setenv r 1");
+	run_command("run s", 0);
+	setenv("s", "setenv r 2");
+	run_command("run s", 0);
+	value = getenv("r");
+	if (!value || strcmp(value, "2")) {
+		printf("%s: changed variable ran the old script\n", __func__);
+		return -EINVAL;
+	}
+	setenv("r", NULL);
+	setenv("s", NULL);
+	setenv("n", NULL);
+	setenv("rec", NULL);
+
+	return 0;
+}
+
+/* Time running a script from the environment, returning the time in us */
+static ulong bench_run(const char *name, const char *cmd, bool cache)
+{
+	ulong start, delta;
+	int i;
+
+	hush_cache_enable(cache);
+	gd->flags |= GD_FLG_SILENT;
+	start = timer_get_us();
+	for (i = 0; i < BENCH_LOOPS; i++)
+		run_command(cmd, 0);
+	delta = timer_get_us() - start;
+	gd->flags &= ~GD_FLG_SILENT;
+	printf("%-26s %-9s %6lu us per run\n", name,
+	       cache ? "cached" : "uncached", delta / BENCH_LOOPS);
+
+	return delta;
+}
+
+/* Run the distro boot scripts against a blank host device */
+static int bench_distro(void)
+{
+	static const char *const cmds[] = {
+		"run scan_dev_for_boot",
+		"run distro_bootcmd",
+	};
+	ulong uncached, cached;
+	int i;
+
+	if (run_command("sb save hostfs - 0 hush_ut.img 100000", 0) ||
+	    run_command("host bind 0 hush_ut.img", 0))
+		return -EIO;
+	setenv("devtype", "host");
+	setenv("devnum", "0");
+	setenv("distro_bootpart", "1");
+	for (i = 0; i < ARRAY_SIZE(cmds); i++) {
+		uncached = bench_run(cmds[i], cmds[i], false);
+		cached = bench_run(cmds[i], cmds[i], true);
+		if (!cached)
+			cached = 1;
+		printf("Speed-up: %lu.%02lux\n", uncached / cached,
+		       uncached * 100 / cached % 100);
+	}
+	run_command("host bind 0", 0);
+
+	return 0;
+}
+
+int do_ut_hush(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
+{
+	int ret = 0;
+
+	hush_cache_enable(false);
+	ret |= test_hush_scripts();
+	hush_cache_enable(true);
+	ret |= test_hush_scripts();
+	ret |= bench_distro();
+
+	printf("Test %s\n", ret ? "failed" : "passed");
+
+	return ret ? CMD_RET_FAILURE : CMD_RET_SUCCESS;
+}
@@ -0,0 +1,144 @@
+#!/bin/bash
+#
+# Timing comparison for hashing the images of a large FIT in mkimage and
+# fit_check_sign, using a single thread and one thread per CPU
+#
+# SPDX-License-Identifier:	GPL-2.0+
+#
+# To run this:
+#
+# make O=sandbox sandbox_config
+# make O=sandbox
+# ./test/image/test-fit-hash-speed.sh [num_dtbs [ramdisk_mb]]
+
+BASEDIR=sandbox
+WORKDIR=${BASEDIR}/fit-hash-speed
+MKIMAGE=${BASEDIR}/tools/mkimage
+FIT_CHECK_SIGN=${BASEDIR}/tools/fit_check_sign
+DTC=${DTC:-dtc}
+NUM_DTBS=${1:-32}
+RAMDISK_MB=${2:-256}
+
+set -e
+
+# Create the image data and a .its which references it
+create_its()
+{
+	local i
+
+	dd if=/dev/urandom of=${WORKDIR}/vmlinux bs=1M count=16 2>/dev/null
+	dd if=/dev/urandom of=${WORKDIR}/ramdisk bs=1M count=${RAMDISK_MB} \
+		2>/dev/null
+	dd if=/dev/urandom of=${WORKDIR}/pad bs=1K count=256 2>/dev/null
+	echo '/dts-v1/; / { };' | ${DTC} -O dtb -o ${WORKDIR}/key.dtb
+
+	cat >${WORKDIR}/test.its <<EOF
+/dts-v1/;
+
+/ {
+	description = "FIT with many hashed images";
+	#address-cells = <1>;
+
+	images {
+		kernel@1 {
+			data = /incbin/("vmlinux");
+			type = "kernel";
+			arch = "sandbox";
+			os = "linux";
+			compression = "none";
+			load = <0x100000>;
+			entry = <0x100000>;
+			hash@1 {
+				algo = "sha256";
+			};
+		};
+		ramdisk@1 {
+			data = /incbin/("ramdisk");
+			type = "ramdisk";
+			arch = "sandbox";
+			os = "linux";
+			compression = "none";
+			hash@1 {
+				algo = "sha256";
+			};
+			hash@2 {
+				algo = "crc32";
+			};
+		};
+EOF
+	for ((i = 1; i <= NUM_DTBS; i++)); do
+		echo "/dts-v1/; / { model = \"board ${i}\"; pad = /incbin/(\"pad\"); };" |
+			${DTC} -i ${WORKDIR} -O dtb -o ${WORKDIR}/board${i}.dtb
+		cat >>${WORKDIR}/test.its <<EOF
+		fdt@${i} {
+			data = /incbin/("board${i}.dtb");
+			type = "flat_dt";
+			arch = "sandbox";
+			compression = "none";
+			hash@1 {
+				algo = "sha256";
+			};
+		};
+EOF
+	done
+	cat >>${WORKDIR}/test.its <<EOF
+	};
+
+	configurations {
+		default = "conf@1";
+		conf@1 {
+			kernel = "kernel@1";
+			ramdisk = "ramdisk@1";
+			fdt = "fdt@1";
+		};
+	};
+};
+EOF
+}
+
+# Run a command and print how long it took
+# $1: Description
+# $2...: Command to run
+time_cmd()
+{
+	local desc=$1
+	local start end
+
+	shift
+	start=$(date +%s%N)
+	"$@" >${WORKDIR}/output 2>&1 || {
+		cat ${WORKDIR}/output
+		echo "${desc}: failed"
+		exit 1
+	}
+	end=$(date +%s%N)
+	printf "%-32s %6d ms\n" "${desc}" $(( (end - start) / 1000000 ))
+}
+
+rm -rf ${WORKDIR}
+mkdir -p ${WORKDIR}
+create_its
+
+echo "FIT with ${NUM_DTBS} DTBs and a ${RAMDISK_MB}MB ramdisk, $(nproc) CPUs"
+time_cmd "mkimage -j 1" ${MKIMAGE} -D "-I dts -O dtb -p 2000" -j 1 \
+	-f ${WORKDIR}/test.its ${WORKDIR}/serial.fit
+time_cmd "mkimage" ${MKIMAGE} -D "-I dts -O dtb -p 2000" \
+	-f ${WORKDIR}/test.its ${WORKDIR}/parallel.fit
+
+# The timestamp is the only thing which may differ between the two
+${MKIMAGE} -l ${WORKDIR}/serial.fit | grep -v Created >${WORKDIR}/serial.txt
+${MKIMAGE} -l ${WORKDIR}/parallel.fit | grep -v Created \
+	>${WORKDIR}/parallel.txt
+if ! cmp -s ${WORKDIR}/serial.txt ${WORKDIR}/parallel.txt; then
+	diff -u ${WORKDIR}/serial.txt ${WORKDIR}/parallel.txt
+	echo "Hash values differ"
+	exit 1
+fi
+
+time_cmd "fit_check_sign -j 1" ${FIT_CHECK_SIGN} -j 1 \
+	-f ${WORKDIR}/parallel.fit -k ${WORKDIR}/key.dtb
+time_cmd "fit_check_sign" ${FIT_CHECK_SIGN} \
+	-f ${WORKDIR}/parallel.fit -k ${WORKDIR}/key.dtb
+
+rm -rf ${WORKDIR}
+echo "Test passed"
@@ -0,0 +1,347 @@
+/*
+ * Tests and benchmark for logical memory blocks
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <command.h>
+#include <errno.h>
+#include <lmb.h>
+#include <malloc.h>
+
+#define TEST_RAM_BASE	0x80000000
+#define TEST_RAM_SIZE	0x20000000
+
+/* Pages used to check random operations against a simple model */
+#define MODEL_PAGE	0x1000
+#define MODEL_PAGES	1024
+#define MODEL_OPS	5000
+
+#define BENCH_LOOPS	200
+
+/* Simple pseudo-random numbers so that each run is the same */
+static uint test_rand(uint *seed)
+{
+	*seed = *seed * 1103515245 + 12345;
+
+	return *seed >> 8;
+}
+
+/* Check that the regions are sorted and neither overlap nor touch */
+static int test_check_regions(struct lmb_region *rgn)
+{
+	unsigned long i;
+
+	if (rgn->cnt > rgn->max) {
+		printf("%s: %lu regions but space for %lu\n", __func__,
+		       rgn->cnt, rgn->max);
+		return -EINVAL;
+	}
+	for (i = 0; i < rgn->cnt; i++) {
+		if (!rgn->region[i].size ||
+		    (i && rgn->region[i - 1].base + rgn->region[i - 1].size >=
+		     rgn->region[i].base)) {
+			printf("%s: region %lu is out of order\n", __func__, i);
+			lmb_dump_all(NULL);
+			return -EINVAL;
+		}
+	}
+
+	return 0;
+}
+
+/* Reserve more regions than fit in struct lmb, then free them again */
+static int test_lmb_many(void)
+{
+	const int count = 100;
+	phys_addr_t base, addr;
+	struct lmb lmb;
+	int ret = -EINVAL;
+	uint i, j;
+
+	lmb_init(&lmb);
+	lmb_add(&lmb, TEST_RAM_BASE, TEST_RAM_SIZE);
+
+	/* Reserve 4KB every 64KB, in a scattered order */
+	for (i = 0; i < count; i++) {
+		j = (i * 37) % count;
+		base = TEST_RAM_BASE + j * 0x10000;
+		if (lmb_reserve(&lmb, base, 0x1000) < 0) {
+			printf("%s: cannot reserve region %d\n", __func__, j);
+			goto err;
+		}
+	}
+	if (lmb.reserved.cnt != count || test_check_regions(&lmb.reserved))
+		goto err;
+	for (i = 0; i < count; i++) {
+		base = TEST_RAM_BASE + i * 0x10000;
+		if (!lmb_is_reserved(&lmb, base) ||
+		    !lmb_is_reserved(&lmb, base + 0xfff) ||
+		    lmb_is_reserved(&lmb, base + 0x1000) ||
+		    lmb_is_reserved(&lmb, base + 0xffff)) {
+			printf("%s: region %d is wrong\n", __func__, i);
+			goto err;
+		}
+	}
+
+	/* Allocations must fit between the reservations */
+	addr = lmb_alloc_base(&lmb, 0x8000, 0x1000, TEST_RAM_BASE + 0x20000);
+	if (addr != TEST_RAM_BASE + 0x18000) {
+		printf("%s: allocated at %llx\n", __func__,
+		       (unsigned long long)addr);
+		goto err;
+	}
+	if (lmb_free(&lmb, addr, 0x8000) < 0 ||
+	    lmb_alloc_base(&lmb, 0x10000, 0x1000, TEST_RAM_BASE + 0x20000)) {
+		printf("%s: allocation was not freed or overlaps\n", __func__);
+		goto err;
+	}
+
+	/* A reservation which covers others merges them */
+	lmb_reserve(&lmb, TEST_RAM_BASE + 0x800, 0x30000);
+	if (lmb.reserved.cnt != count - 3 ||
+	    test_check_regions(&lmb.reserved))
+		goto err;
+
+	/* Freeing the middle of a region splits it */
+	if (lmb_free(&lmb, TEST_RAM_BASE + 0x10000, 0x1000) < 0 ||
+	    lmb.reserved.cnt != count - 2 ||
+	    lmb_free(&lmb, TEST_RAM_BASE + 0x10000, 0x1000) != -1) {
+		printf("%s: free did not split the region\n", __func__);
+		goto err;
+	}
+	for (i = 3; i < count; i++) {
+		if (lmb_free(&lmb, TEST_RAM_BASE + i * 0x10000, 0x1000) < 0)
+			goto err;
+	}
+	if (lmb.reserved.cnt != 2 || test_check_regions(&lmb.reserved))
+		goto err;
+	ret = 0;
+err:
+	lmb_uninit(&lmb);
+
+	return ret;
+}
+
+/* Split a region while malloc() has no memory left */
+static int test_lmb_split_nomem_run(void *priv)
+{
+	struct lmb *lmb = priv;
+	void **ptr, *head = NULL;
+	int ret;
+
+	/* Use up the heap, so that the table of regions cannot grow */
+	while ((ptr = malloc(sizeof(void *)))) {
+		*ptr = head;
+		head = ptr;
+	}
+	ret = lmb_free(lmb, TEST_RAM_BASE + 0x1000, 0x1000) == -1 ? 0 : -EINVAL;
+	while (head) {
+		ptr = head;
+		head = *ptr;
+		free(ptr);
+	}
+
+	return ret;
+}
+
+/* A split which cannot add the new region must leave the old one alone */
+static int test_lmb_split_nomem(void)
+{
+	const ulong arena_size = 16 << 10;
+	struct lmb lmb;
+	void *arena;
+	int ret = -EINVAL;
+	int i;
+
+	arena = malloc(arena_size);
+	if (!arena)
+		return -ENOMEM;
+	lmb_init(&lmb);
+	lmb_add(&lmb, TEST_RAM_BASE, TEST_RAM_SIZE);
+	for (i = 0; i < MAX_LMB_REGIONS; i++)
+		lmb_reserve(&lmb, TEST_RAM_BASE + i * 0x10000, 0x3000);
+	if (malloc_run_in_arena(arena, arena_size, test_lmb_split_nomem_run,
+				&lmb)) {
+		printf("%s: split did not fail\n", __func__);
+		goto err;
+	}
+	if (lmb.reserved.cnt != MAX_LMB_REGIONS ||
+	    lmb.reserved.region[0].size != 0x3000 ||
+	    !lmb_is_reserved(&lmb, TEST_RAM_BASE + 0x2fff)) {
+		printf("%s: region was changed\n", __func__);
+		goto err;
+	}
+
+	/* With memory available the split works */
+	if (lmb_free(&lmb, TEST_RAM_BASE + 0x1000, 0x1000) < 0 ||
+	    lmb.reserved.cnt != MAX_LMB_REGIONS + 1 ||
+	    test_check_regions(&lmb.reserved))
+		goto err;
+	ret = 0;
+err:
+	lmb_uninit(&lmb);
+	free(arena);
+
+	return ret;
+}
+
+static int test_model_check(struct lmb *lmb, const u8 *model)
+{
+	int i;
+
+	if (test_check_regions(&lmb->reserved))
+		return -EINVAL;
+	for (i = 0; i < MODEL_PAGES; i++) {
+		if (lmb_is_reserved(lmb, TEST_RAM_BASE + i * MODEL_PAGE) !=
+		    model[i]) {
+			printf("%s: page %d should be %s\n", __func__, i,
+			       model[i] ? "reserved" : "free");
+			return -EINVAL;
+		}
+	}
+
+	return 0;
+}
+
+/* Run random operations and check them against a map of the pages */
+static int test_lmb_model(void)
+{
+	static u8 model[MODEL_PAGES];
+	phys_addr_t addr;
+	struct lmb lmb;
+	uint seed = 1;
+	int ret = -EINVAL;
+	int i, op, page, pages, p;
+
+	memset(model, '\0', sizeof(model));
+	lmb_init(&lmb);
+	lmb_add(&lmb, TEST_RAM_BASE, MODEL_PAGES * MODEL_PAGE);
+	for (i = 0; i < MODEL_OPS; i++) {
+		op = test_rand(&seed) % 3;
+		page = test_rand(&seed) % MODEL_PAGES;
+		pages = 1 + test_rand(&seed) % 8;
+		pages = min(pages, MODEL_PAGES - page);
+		addr = TEST_RAM_BASE + page * MODEL_PAGE;
+
+		if (op == 0) {
+			if (lmb_reserve(&lmb, addr, pages * MODEL_PAGE) < 0)
+				goto err;
+			memset(model + page, 1, pages);
+		} else if (op == 1) {
+			/* Only free pages which are all reserved */
+			for (p = page; p < page + pages && model[p]; p++)
+				;
+			if (p != page + pages)
+				continue;
+			if (lmb_free(&lmb, addr, pages * MODEL_PAGE) < 0) {
+				printf("%s: cannot free %llx\n", __func__,
+				       (unsigned long long)addr);
+				goto err;
+			}
+			memset(model + page, '\0', pages);
+		} else {
+			addr = __lmb_alloc_base(&lmb, pages * MODEL_PAGE,
+						MODEL_PAGE, 0);
+			if (!addr)
+				continue;
+			page = (addr - TEST_RAM_BASE) / MODEL_PAGE;
+			for (p = page; p < page + pages; p++) {
+				if (model[p]) {
+					printf("%s: %llx is already reserved\n",
+					       __func__,
+					       (unsigned long long)addr);
+					goto err;
+				}
+				model[p] = 1;
+			}
+		}
+		if (!(i % 16) && test_model_check(&lmb, model))
+			goto err;
+	}
+	if (test_model_check(&lmb, model))
+		goto err;
+	ret = 0;
+err:
+	lmb_uninit(&lmb);
+
+	return ret;
+}
+
+/*
+ * Set up the regions as boot_start_lmb() and bootm do, with @count regions
+ * from the FDT's reserved memory, then place the ramdisk, FDT, command line
+ * and board info
+ */
+static int bench_setup(struct lmb *lmb, int count)
+{
+	phys_addr_t top = TEST_RAM_BASE + TEST_RAM_SIZE;
+	int i;
+
+	lmb_init(lmb);
+	lmb_add(lmb, TEST_RAM_BASE, TEST_RAM_SIZE);
+
+	/* arch_lmb_reserve(): U-Boot from its stack to the top of RAM */
+	lmb_reserve(lmb, top - 0x1000000, 0x1000000);
+
+	/* The kernel, then reserved memory spread through the rest of RAM */
+	lmb_reserve(lmb, TEST_RAM_BASE + 0x8000, 0x800000);
+	for (i = 0; i < count; i++) {
+		if (lmb_reserve(lmb, TEST_RAM_BASE + 0x1000000 +
+				i * (0xe000000 / count), 0x10000) < 0)
+			return -ENOMEM;
+	}
+
+	if (!lmb_alloc_base(lmb, 0x1000000, 0x1000, top) ||
+	    !lmb_alloc_base(lmb, 0x10000, 0x1000, top) ||
+	    !lmb_alloc_base(lmb, 0x1000, 0x10, top) ||
+	    !lmb_alloc_base(lmb, 0x100, 0x10, top))
+		return -ENOMEM;
+
+	return 0;
+}
+
+static int bench_lmb(void)
+{
+	static const int counts[] = { 4, 64, 512 };
+	ulong start, us;
+	struct lmb lmb;
+	int i, loop, ret;
+
+	printf("%-20s %10s %10s\n", "reserved-memory", "regions", "us/setup");
+	for (i = 0; i < ARRAY_SIZE(counts); i++) {
+		start = timer_get_us();
+		for (loop = 0; loop < BENCH_LOOPS; loop++) {
+			ret = bench_setup(&lmb, counts[i]);
+			if (!ret)
+				ret = test_check_regions(&lmb.reserved);
+			if (ret) {
+				lmb_uninit(&lmb);
+				return ret;
+			}
+			if (loop < BENCH_LOOPS - 1)
+				lmb_uninit(&lmb);
+		}
+		us = timer_get_us() - start;
+		printf("%-20d %10lu %10lu\n", counts[i], lmb.reserved.cnt,
+		       us / BENCH_LOOPS);
+		lmb_uninit(&lmb);
+	}
+
+	return 0;
+}
+
+int do_ut_lmb(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
+{
+	int ret = 0;
+
+	ret |= test_lmb_many();
+	ret |= test_lmb_split_nomem();
+	ret |= test_lmb_model();
+	ret |= bench_lmb();
+
+	printf("Test %s\n", ret ? "failed" : "passed");
+
+	return ret ? CMD_RET_FAILURE : CMD_RET_SUCCESS;
+}
@@ -0,0 +1,1927 @@
+/*
+ * Allocations recorded while booting sandbox
+ *
+ * This was recorded by logging each call to malloc(), calloc(), memalign(),
+ * realloc() and free() after relocation, while running:
+ *
+ *   host bind 0 disk.img; run distro_bootcmd; env export -t 100000;
+ *   md5sum 1000000 400000
+ *
+ * where disk.img holds an ext4 partition with an extlinux.conf, a 4MB
+ * kernel and a device tree. Each live allocation is given a slot number
+ * and slots are reused once freed. Allocations made before the trace
+ * started are left out, as are frees of them.
+ *
+ * M(slot, size)	malloc()
+ * C(slot, size)	calloc()
+ * A(slot, align, size)	memalign()
+ * R(slot, size)	realloc()
+ * F(slot)		free()
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#define MALLOC_TRACE_SLOTS	567
+
+static const struct malloc_trace_op malloc_trace[] = {
+	M(0, 4096), M(1, 256), M(2, 13), C(3, 9160), C(4, 96), C(5, 200),
+	C(6, 64), C(7, 64), C(8, 4), M(9, 128), C(10, 96), C(11, 200),
+	M(12, 14), C(13, 64), C(14, 64), C(15, 96), C(16, 200), M(17, 15),
+	C(18, 64), C(19, 64), C(20, 96), C(21, 4), C(22, 200), C(23, 12),
+	C(24, 64), C(25, 64), C(26, 200), C(27, 12), C(28, 200), C(29, 12),
+	C(30, 96), C(31, 200), C(32, 64), C(33, 64), C(34, 96), C(35, 200),
+	C(36, 64), C(37, 64), C(38, 96), C(39, 200), C(40, 24), C(41, 64),
+	C(42, 64), C(43, 96), C(44, 200), C(45, 64), C(46, 64), C(47, 96),
+	C(48, 200), C(49, 8), M(50, 256), C(51, 64), C(52, 64), C(53, 96),
+	C(54, 200), C(55, 32), C(56, 16), C(57, 64), C(58, 64), C(59, 200),
+	C(60, 4), C(61, 8), C(62, 72), M(63, 128), C(64, 120), C(65, 600),
+	M(66, 1160), C(67, 200), C(68, 8), M(69, 128), C(70, 96), M(71, 4096),
+	M(72, 1865), C(73, 12320), M(74, 271), M(75, 456), M(76, 552),
+	M(77, 92), M(78, 264), M(79, 552), C(80, 96), C(81, 8), C(82, 200),
+	C(83, 20), C(84, 64), C(85, 64), C(86, 200), C(87, 20), M(88, 128),
+	C(89, 200), C(90, 20), C(91, 200), C(92, 20), M(93, 13), M(94, 15),
+	M(95, 13), F(93), C(93, 96), C(96, 72), M(97, 128), C(98, 512), F(96),
+	C(96, 120), C(99, 120), M(100, 256), M(101, 7), M(102, 7), F(101),
+	M(101, 7), M(103, 7), F(101), M(101, 7), M(104, 7), F(101), C(101, 96),
+	C(105, 32), C(106, 4), C(107, 32), C(108, 4), C(109, 32), C(110, 4),
+	C(111, 32), C(112, 4), M(113, 32), C(114, 48), M(115, 97), M(116, 98),
+	M(117, 32), M(118, 40), M(119, 101), M(120, 5), M(121, 16), M(122, 8),
+	M(123, 5), R(121, 24), R(122, 12), M(124, 2), R(121, 32), R(122, 16),
+	M(125, 20), R(121, 40), R(122, 20), R(118, 80), M(126, 32), M(127, 40),
+	M(128, 4), M(129, 16), M(130, 8), M(131, 15), R(129, 24), R(130, 12),
+	R(127, 80), M(132, 32), M(133, 40), M(134, 4), M(135, 16), M(136, 8),
+	M(137, 7), R(135, 24), R(136, 12), M(138, 3), R(135, 32), R(136, 16),
+	M(139, 7), R(135, 40), R(136, 20), R(133, 80), M(140, 32), M(141, 40),
+	M(142, 7), M(143, 16), M(144, 8), M(145, 8), R(143, 24), R(144, 12),
+	M(146, 7), R(143, 32), R(144, 16), R(141, 80), M(147, 32), M(148, 40),
+	M(149, 32), M(150, 40), M(151, 848), M(152, 20), C(153, 48),
+	M(154, 62), M(155, 63), M(156, 32), M(157, 40), M(158, 101),
+	M(159, 48), M(160, 32), M(161, 40), M(162, 7), M(163, 16), M(164, 8),
+	R(161, 80), M(165, 32), M(166, 40), M(167, 15), M(168, 16), M(169, 8),
+	R(166, 80), M(170, 32), M(171, 40), M(172, 4), M(173, 16), M(174, 8),
+	M(175, 17), R(173, 24), R(174, 12), R(171, 80), M(176, 32), M(177, 40),
+	M(178, 32), M(179, 40), F(159), R(157, 80), M(159, 32), M(180, 40),
+	M(181, 32), M(182, 40), M(183, 8), M(184, 13), R(184, 13), R(183, 16),
+	M(185, 13), R(183, 24), M(186, 13), F(184), M(184, 13), F(184),
+	M(184, 13), M(187, 32), M(188, 7), M(189, 6), F(184), M(184, 5),
+	M(190, 8), R(190, 14), R(190, 14), R(184, 19), F(190), M(190, 32),
+	M(191, 40), M(192, 101), M(193, 4), M(194, 16), M(195, 8), M(196, 14),
+	R(194, 24), R(195, 12), R(191, 80), M(197, 32), M(198, 40), M(199, 32),
+	M(200, 40), C(201, 48), M(202, 31), M(203, 32), M(204, 32), M(205, 40),
+	M(206, 101), M(207, 7), M(208, 16), M(209, 8), M(210, 7), R(208, 24),
+	R(209, 12), M(211, 2), R(208, 32), R(209, 16), R(205, 80), M(212, 32),
+	M(213, 40), M(214, 4), M(215, 16), M(216, 8), M(217, 10), R(215, 24),
+	R(216, 12), R(213, 80), M(218, 32), M(219, 40), M(220, 32), M(221, 40),
+	M(222, 2), M(223, 7), M(224, 2), F(222), C(222, 48), M(225, 80),
+	M(226, 81), M(227, 32), M(228, 40), M(229, 101), M(230, 48),
+	M(231, 32), M(232, 40), M(233, 5), M(234, 16), M(235, 8), M(236, 4),
+	R(234, 24), R(235, 12), M(237, 9), R(234, 32), R(235, 16), R(232, 80),
+	M(238, 32), M(239, 40), M(240, 7), M(241, 16), M(242, 8), M(243, 8),
+	R(241, 24), R(242, 12), M(244, 5), R(241, 32), R(242, 16), R(239, 80),
+	M(245, 32), M(246, 40), M(247, 4), M(248, 16), M(249, 8), M(250, 23),
+	R(248, 24), R(249, 12), R(246, 80), M(251, 32), M(252, 40), M(253, 32),
+	M(254, 40), F(230), R(228, 80), M(230, 32), M(255, 40), M(256, 32),
+	M(257, 40), M(258, 6), R(258, 10), M(259, 2), R(259, 2), R(258, 12),
+	F(259), M(259, 32), M(260, 40), M(261, 101), M(262, 5), M(263, 16),
+	M(264, 8), M(265, 4), R(263, 24), R(264, 12), M(266, 2), R(263, 32),
+	R(264, 16), R(260, 80), M(267, 32), M(268, 40), M(269, 32), M(270, 40),
+	F(262), F(265), F(266), F(263), F(264), F(260), F(259), F(268), F(267),
+	F(270), F(269), F(261), F(258), M(258, 64), F(229), F(226), M(226, 64),
+	F(206), F(203), F(193), F(196), F(194), F(195), F(191), F(190), F(198),
+	F(197), F(200), F(199), F(192), F(184), F(185), M(185, 13), F(185),
+	M(185, 13), F(189), M(189, 6), F(185), M(185, 5), M(184, 8),
+	R(184, 14), R(184, 14), R(185, 19), F(184), M(184, 32), M(192, 40),
+	M(199, 101), M(200, 4), M(197, 16), M(198, 8), M(190, 14), R(197, 24),
+	R(198, 12), R(192, 80), M(191, 32), M(195, 40), M(194, 32), M(196, 40),
+	C(193, 48), M(203, 31), M(206, 32), M(229, 32), M(261, 40),
+	M(269, 101), M(270, 7), M(267, 16), M(268, 8), M(259, 7), R(267, 24),
+	R(268, 12), M(260, 2), R(267, 32), R(268, 16), R(261, 80), M(264, 32),
+	M(263, 40), M(266, 4), M(265, 16), M(262, 8), M(271, 10), R(265, 24),
+	R(262, 12), R(263, 80), M(272, 32), M(273, 40), M(274, 32), M(275, 40),
+	M(276, 2), F(224), M(224, 2), F(276), M(276, 6), R(276, 10), M(277, 2),
+	R(277, 2), R(276, 12), F(277), M(277, 32), M(278, 40), M(279, 101),
+	M(280, 5), M(281, 16), M(282, 8), M(283, 4), R(281, 24), R(282, 12),
+	M(284, 2), R(281, 32), R(282, 16), R(278, 80), M(285, 32), M(286, 40),
+	M(287, 32), M(288, 40), F(280), F(283), F(284), F(281), F(282), F(278),
+	F(277), F(286), F(285), F(288), F(287), F(279), F(276), M(276, 5),
+	M(279, 8), M(287, 5), F(276), C(276, 48), M(288, 231), M(285, 232),
+	M(286, 32), M(277, 40), M(278, 101), M(282, 5), M(281, 16), M(284, 8),
+	M(283, 5), R(281, 24), R(284, 12), M(280, 10), R(281, 32), R(284, 16),
+	M(289, 9), R(281, 40), R(284, 20), M(290, 10), R(281, 48), R(284, 24),
+	M(291, 9), R(281, 56), R(284, 28), R(277, 80), M(292, 32), M(293, 40),
+	M(294, 4), M(295, 16), M(296, 8), M(297, 7), R(295, 24), R(296, 12),
+	M(298, 9), R(295, 32), R(296, 16), R(293, 80), M(299, 32), M(300, 40),
+	M(301, 7), M(302, 16), M(303, 8), M(304, 9), R(302, 24), R(303, 12),
+	M(305, 2), R(302, 32), R(303, 16), R(300, 80), M(306, 32), M(307, 40),
+	M(308, 48), M(309, 32), M(310, 40), M(311, 16), M(312, 16), M(313, 8),
+	R(310, 80), M(314, 32), M(315, 40), M(316, 11), M(317, 16), M(318, 8),
+	R(315, 80), M(319, 32), M(320, 40), M(321, 48), M(322, 32), M(323, 40),
+	M(324, 7), M(325, 16), M(326, 8), M(327, 10), R(325, 24), R(326, 12),
+	M(328, 27), R(325, 32), R(326, 16), M(329, 11), R(325, 40), R(326, 20),
+	R(323, 80), M(330, 32), M(331, 40), M(332, 4), M(333, 16), M(334, 8),
+	M(335, 18), R(333, 24), R(334, 12), R(331, 80), M(336, 32), M(337, 40),
+	M(338, 32), M(339, 40), F(321), R(320, 80), M(321, 32), M(340, 40),
+	M(341, 32), M(342, 40), F(308), R(307, 80), M(308, 32), M(343, 40),
+	M(344, 32), M(345, 40), M(346, 6), R(346, 11), M(347, 5), R(347, 5),
+	R(346, 16), F(347), M(347, 2), R(347, 2), R(346, 18), F(347),
+	R(346, 28), R(346, 37), M(347, 32), M(348, 40), M(349, 101), M(350, 5),
+	M(351, 16), M(352, 8), M(353, 5), R(351, 24), R(352, 12), M(354, 5),
+	R(351, 32), R(352, 16), M(355, 2), R(351, 40), R(352, 20), M(356, 10),
+	R(351, 48), R(352, 24), M(357, 9), R(351, 56), R(352, 28), R(348, 80),
+	M(358, 32), M(359, 40), M(360, 32), M(361, 40), M(362, 2), M(363, 9),
+	M(364, 2), F(362), F(350), F(353), F(354), F(355), F(356), F(357),
+	F(351), F(352), F(348), F(347), F(359), F(358), F(361), F(360), F(349),
+	F(346), M(346, 8), M(349, 2), R(349, 2), R(346, 16), M(360, 18),
+	F(349), M(349, 18), F(349), M(349, 18), M(361, 32), M(358, 16),
+	M(359, 2), F(349), M(349, 8), M(347, 5), R(347, 5), R(349, 13), F(347),
+	M(347, 2), R(347, 2), R(347, 4), R(347, 4), R(349, 17), F(347),
+	R(349, 28), M(347, 32), M(348, 40), M(352, 101), M(351, 7), M(357, 16),
+	M(356, 8), M(355, 5), R(357, 24), R(356, 12), M(354, 4), R(357, 32),
+	R(356, 16), M(353, 11), R(357, 40), R(356, 20), R(348, 80), M(350, 32),
+	M(362, 40), M(365, 32), M(366, 40), M(367, 4), F(367),
+	A(367, 16, 1024), M(368, 5), M(369, 11), M(370, 5), F(368), F(351),
+	F(355), F(354), F(353), F(357), F(356), F(348), F(347), F(362), F(350),
+	F(366), F(365), F(352), F(349), C(349, 48), M(352, 151), M(365, 152),
+	M(366, 32), M(350, 40), M(362, 101), M(347, 5), M(348, 16), M(356, 8),
+	M(357, 9), R(348, 24), R(356, 12), M(353, 10), R(348, 32), R(356, 16),
+	M(354, 30), R(348, 40), R(356, 20), R(350, 80), M(355, 32), M(351, 40),
+	M(368, 48), M(371, 32), M(372, 40), M(373, 7), M(374, 16), M(375, 8),
+	R(372, 80), M(376, 32), M(377, 40), M(378, 16), M(379, 16), M(380, 8),
+	R(377, 80), M(381, 32), M(382, 40), M(383, 4), M(384, 16), M(385, 8),
+	M(386, 22), R(384, 24), R(385, 12), R(382, 80), M(387, 32), M(388, 40),
+	M(389, 4), M(390, 16), M(391, 8), M(392, 21), R(390, 24), R(391, 12),
+	R(388, 80), M(393, 32), M(394, 40), M(395, 32), M(396, 40), F(368),
+	R(351, 80), M(368, 32), M(397, 40), M(398, 32), M(399, 40), M(400, 6),
+	R(400, 15), M(401, 5), R(401, 5), R(400, 20), F(401), M(401, 2),
+	R(401, 2), R(401, 4), R(401, 7), R(400, 27), F(401), M(401, 32),
+	M(402, 40), M(403, 101), M(404, 5), M(405, 16), M(406, 8), M(407, 9),
+	R(405, 24), R(406, 12), M(408, 5), R(405, 32), R(406, 16), M(409, 7),
+	R(405, 40), R(406, 20), R(402, 80), M(410, 32), M(411, 40), M(412, 32),
+	M(413, 40), F(404), F(407), F(408), F(409), F(405), F(406), F(402),
+	F(401), F(411), F(410), F(413), F(412), F(403), F(400), M(400, 8),
+	M(403, 9), R(403, 9), R(400, 16), M(412, 9), R(400, 24), M(413, 14),
+	F(403), M(403, 9), F(403), M(403, 9), M(410, 32), M(411, 7), M(401, 2),
+	F(403), C(403, 48), M(402, 190), M(406, 191), M(405, 32), M(409, 40),
+	M(408, 101), M(407, 48), M(404, 32), M(414, 40), M(415, 5), M(416, 16),
+	M(417, 8), M(418, 3), R(416, 24), R(417, 12), M(419, 10), R(416, 32),
+	R(417, 16), M(420, 27), R(416, 40), R(417, 20), M(421, 31), R(416, 48),
+	R(417, 24), R(414, 80), M(422, 32), M(423, 40), M(424, 5), M(425, 16),
+	M(426, 8), M(427, 6), R(425, 24), R(426, 12), M(428, 31), R(425, 32),
+	R(426, 16), R(423, 80), M(429, 32), M(430, 40), M(431, 4), M(432, 16),
+	M(433, 8), M(434, 14), R(432, 24), R(433, 12), R(430, 80), M(435, 32),
+	M(436, 40), M(437, 5), M(438, 16), M(439, 8), M(440, 7), R(438, 24),
+	R(439, 12), M(441, 8), R(438, 32), R(439, 16), M(442, 14), R(438, 40),
+	R(439, 20), R(436, 80), M(443, 32), M(444, 40), M(445, 32), M(446, 40),
+	F(407), R(409, 80), M(407, 32), M(447, 40), M(448, 32), M(449, 40),
+	M(450, 6), R(450, 9), M(451, 5), R(451, 5), R(450, 14), F(451),
+	M(451, 2), R(451, 2), R(451, 4), R(451, 4), R(450, 18), F(451),
+	M(451, 2), R(451, 24), R(450, 42), F(451), M(451, 32), M(452, 40),
+	M(453, 101), M(454, 5), M(455, 16), M(456, 8), M(457, 3), R(455, 24),
+	R(456, 12), M(458, 5), R(455, 32), R(456, 16), M(459, 4), R(455, 40),
+	R(456, 20), M(460, 24), R(455, 48), R(456, 24), R(452, 80), M(461, 32),
+	M(462, 40), M(463, 32), M(464, 40), M(465, 4), F(465),
+	A(465, 16, 1024), A(466, 16, 1024), F(466), A(466, 16, 1024), F(466),
+	A(466, 16, 144), F(466), A(466, 16, 1024), F(466), A(466, 16, 1024),
+	F(466), A(466, 16, 144), F(466), A(466, 16, 1024), F(466),
+	A(466, 16, 1024), F(466), A(466, 16, 144), F(466), A(466, 16, 1024),
+	F(466), A(466, 16, 1024), F(466), A(466, 16, 144), F(466),
+	A(466, 16, 1024), F(466), A(466, 16, 1024), F(466), A(466, 16, 144),
+	A(467, 16, 1024), F(467), A(467, 16, 1024), F(467), A(467, 16, 144),
+	F(467), A(467, 16, 1024), F(467), A(467, 16, 1024), F(467),
+	A(467, 16, 144), F(467), A(467, 16, 1024), F(467), A(467, 16, 1024),
+	F(467), A(467, 16, 144), F(466), F(467), F(465), F(454), F(457),
+	F(458), F(459), F(460), F(455), F(456), F(452), F(451), F(462), F(461),
+	F(464), F(463), F(453), F(450), M(450, 6), R(450, 12), M(453, 2),
+	R(453, 24), R(450, 36), F(453), M(453, 32), M(463, 40), M(464, 101),
+	M(461, 5), M(462, 16), M(451, 8), M(452, 6), R(462, 24), R(451, 12),
+	M(456, 24), R(462, 32), R(451, 16), R(463, 80), M(455, 32), M(460, 40),
+	M(459, 32), M(458, 40), F(461), F(452), F(456), F(462), F(451), F(463),
+	F(453), F(460), F(455), F(458), F(459), F(464), F(450), C(450, 48),
+	M(464, 98), M(459, 99), M(458, 32), M(455, 40), M(460, 101), M(453, 8),
+	M(463, 16), M(451, 8), M(462, 10), R(463, 24), R(451, 12), M(456, 27),
+	R(463, 32), R(451, 16), M(452, 4), R(463, 40), R(451, 20), M(461, 13),
+	R(463, 48), R(451, 24), M(457, 31), R(463, 56), R(451, 28), R(455, 80),
+	M(454, 32), M(465, 40), M(467, 32), M(466, 40), M(468, 9), M(469, 5),
+	R(469, 5), R(468, 14), F(469), M(469, 2), R(469, 2), R(469, 4),
+	R(469, 4), R(468, 18), F(469), R(468, 22), M(469, 7), R(469, 7),
+	R(468, 29), F(469), M(469, 2), R(469, 24), R(468, 53), F(469),
+	M(469, 32), M(470, 40), M(471, 101), M(472, 8), M(473, 16), M(474, 8),
+	M(475, 5), R(473, 24), R(474, 12), M(476, 4), R(473, 32), R(474, 16),
+	M(477, 4), R(473, 40), R(474, 20), M(478, 7), R(473, 48), R(474, 24),
+	M(479, 24), R(473, 56), R(474, 28), R(470, 80), M(480, 32), M(481, 40),
+	M(482, 32), M(483, 40), M(484, 24), M(485, 9), M(486, 24), F(484),
+	M(484, 4), F(484), A(484, 16, 1024), A(487, 16, 1024), F(487),
+	A(487, 16, 1024), F(487), A(487, 16, 144), F(487), A(487, 16, 1024),
+	F(487), A(487, 16, 1024), F(487), A(487, 16, 144), F(487),
+	A(487, 16, 1024), F(487), A(487, 16, 1024), F(487), A(487, 16, 144),
+	F(487), A(487, 16, 1024), F(487), A(487, 16, 1024), F(487),
+	A(487, 16, 144), F(487), A(487, 16, 1024), F(487), A(487, 16, 1024),
+	F(487), A(487, 16, 144), A(488, 16, 1024), F(488), A(488, 16, 1024),
+	F(488), A(488, 16, 144), F(488), A(488, 16, 1024), F(488),
+	A(488, 16, 1024), F(488), A(488, 16, 144), F(488), A(488, 16, 1024),
+	F(488), A(488, 16, 1024), F(488), A(488, 16, 144), F(487),
+	A(487, 16, 1024), F(487), F(488), F(484), M(484, 5), M(488, 9),
+	M(487, 5), F(484), M(484, 3), M(489, 9), M(490, 3), F(484), M(484, 40),
+	M(491, 8), M(492, 6), M(493, 5), M(494, 6), M(495, 5), M(496, 8),
+	M(497, 2), F(497), M(497, 6), M(498, 96), M(499, 6), M(500, 7),
+	M(501, 8), M(502, 4), M(503, 11), M(504, 7), M(505, 55), M(506, 72),
+	M(507, 5), M(508, 32), M(509, 2), F(509), F(508), F(507), F(506),
+	M(506, 4), F(506), A(506, 16, 1024), A(507, 16, 1024), F(507),
+	A(507, 16, 1024), F(507), A(507, 16, 144), F(507), A(507, 16, 1024),
+	F(507), A(507, 16, 1024), F(507), A(507, 16, 144), F(507),
+	A(507, 16, 1024), F(507), A(507, 16, 1024), F(507), A(507, 16, 144),
+	F(507), A(507, 16, 1024), F(507), A(507, 16, 1024), F(507),
+	A(507, 16, 144), F(507), A(507, 16, 1024), F(507), A(507, 16, 1024),
+	F(507), A(507, 16, 144), F(507), A(507, 16, 1024), F(507),
+	A(507, 16, 1024), F(507), A(507, 16, 144), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), A(508, 16, 1024), F(508), A(508, 16, 1024),
+	F(508), A(508, 16, 1024), F(508), A(508, 16, 1024), F(508),
+	A(508, 16, 1024), F(508), F(507), F(506), M(506, 8), F(487), M(487, 8),
+	F(506), M(506, 7), F(490), M(490, 7), F(506), M(506, 55), M(507, 9),
+	M(508, 55), F(506), M(506, 4), F(506), A(506, 16, 1024),
+	A(509, 16, 1024), F(509), A(509, 16, 1024), F(509), A(509, 16, 144),
+	F(509), A(509, 16, 1024), F(509), A(509, 16, 1024), F(509),
+	A(509, 16, 144), F(509), A(509, 16, 1024), F(509), A(509, 16, 1024),
+	F(509), A(509, 16, 144), F(509), A(509, 16, 1024), F(509),
+	A(509, 16, 1024), F(509), A(509, 16, 144), A(510, 16, 1024), F(510),
+	A(510, 16, 1024), F(510), A(510, 16, 1024), F(510), A(510, 16, 1024),
+	F(510), A(510, 16, 1024), F(510), A(510, 16, 1024), F(510),
+	A(510, 16, 1024), F(510), F(509), F(506), M(506, 7), F(487), M(487, 7),
+	F(506), M(506, 5), F(490), M(490, 5), F(506), F(495), F(492), F(499),
+	F(501), F(505), F(503), F(498), F(484), F(472), F(475), F(476), F(477),
+	F(478), F(479), F(473), F(474), F(470), F(469), F(481), F(480), F(483),
+	F(482), F(471), F(468), M(468, 64), F(460), F(459), M(459, 64), F(408),
+	F(406), C(406, 48), M(408, 218), M(460, 219), M(471, 32), M(482, 40),
+	M(483, 101), M(480, 48), M(481, 32), M(469, 40), M(470, 7), M(474, 16),
+	M(473, 8), R(469, 80), M(479, 32), M(478, 40), M(477, 15), M(476, 16),
+	M(475, 8), R(478, 80), M(472, 32), M(484, 40), M(498, 48), M(503, 32),
+	M(505, 40), M(501, 5), M(499, 16), M(492, 8), M(495, 3), R(499, 24),
+	R(492, 12), M(506, 10), R(499, 32), R(492, 16), M(509, 27), R(499, 40),
+	R(492, 20), M(510, 17), R(499, 48), R(492, 24), R(505, 80), M(511, 32),
+	M(512, 40), M(513, 5), M(514, 16), M(515, 8), M(516, 6), R(514, 24),
+	R(515, 12), M(517, 7), R(514, 32), R(515, 16), M(518, 7), R(514, 40),
+	R(515, 20), M(519, 17), R(514, 48), R(515, 24), R(512, 80), M(520, 32),
+	M(521, 40), M(522, 4), M(523, 16), M(524, 8), M(525, 14), R(523, 24),
+	R(524, 12), R(521, 80), M(526, 32), M(527, 40), M(528, 5), M(529, 16),
+	M(530, 8), M(531, 7), R(529, 24), R(530, 12), M(532, 8), R(529, 32),
+	R(530, 16), M(533, 14), R(529, 40), R(530, 20), R(527, 80), M(534, 32),
+	M(535, 40), M(536, 32), M(537, 40), F(498), R(484, 80), M(498, 32),
+	M(538, 40), M(539, 32), M(540, 40), F(480), R(482, 80), M(480, 32),
+	M(541, 40), M(542, 32), M(543, 40), M(544, 8), M(545, 23), R(545, 23),
+	R(544, 16), M(546, 21), R(544, 24), M(547, 16), F(545), M(545, 21),
+	F(545), M(545, 21), M(548, 32), M(549, 7), M(550, 14), F(545),
+	M(545, 6), R(545, 9), M(551, 5), R(551, 5), R(545, 14), F(551),
+	M(551, 2), R(551, 2), R(551, 4), R(551, 4), R(545, 18), F(551),
+	M(551, 2), R(551, 15), R(551, 15), R(545, 33), F(551), M(551, 32),
+	M(552, 40), M(553, 101), M(554, 5), M(555, 16), M(556, 8), M(557, 3),
+	R(555, 24), R(556, 12), M(558, 5), R(555, 32), R(556, 16), M(559, 4),
+	R(555, 40), R(556, 20), M(560, 15), R(555, 48), R(556, 24), R(552, 80),
+	M(561, 32), M(562, 40), M(563, 32), M(564, 40), M(565, 4), F(565),
+	A(565, 16, 1024), A(566, 16, 1024), F(566), A(566, 16, 1024), F(566),
+	A(566, 16, 144), F(566), A(566, 16, 1024), F(566), A(566, 16, 1024),
+	F(566), A(566, 16, 144), F(566), A(566, 16, 1024), F(566),
+	A(566, 16, 1024), F(566), A(566, 16, 144), F(566), A(566, 16, 1024),
+	F(566), A(566, 16, 1024), F(566), A(566, 16, 144), F(566),
+	A(566, 16, 1024), F(566), A(566, 16, 1024), F(566), A(566, 16, 144),
+	F(566), A(566, 16, 1024), F(566), A(566, 16, 1024), F(566),
+	A(566, 16, 144), F(566), A(566, 16, 1024), F(566), F(565), F(554),
+	F(557), F(558), F(559), F(560), F(555), F(556), F(552), F(551), F(562),
+	F(561), F(564), F(563), F(553), F(545), F(546), M(546, 16), F(546),
+	M(546, 16), F(550), M(550, 9), F(546), M(546, 6), R(546, 9), M(545, 5),
+	R(545, 5), R(546, 14), F(545), M(545, 2), R(545, 2), R(545, 4),
+	R(545, 4), R(546, 18), F(545), M(545, 2), R(545, 10), R(545, 10),
+	R(546, 28), F(545), M(545, 32), M(553, 40), M(563, 101), M(564, 5),
+	M(561, 16), M(562, 8), M(551, 3), R(561, 24), R(562, 12), M(552, 5),
+	R(561, 32), R(562, 16), M(556, 4), R(561, 40), R(562, 20), M(555, 10),
+	R(561, 48), R(562, 24), R(553, 80), M(560, 32), M(559, 40), M(558, 32),
+	M(557, 40), M(554, 4), F(554), A(554, 16, 1024), A(565, 16, 1024),
+	F(565), A(565, 16, 1024), F(565), A(565, 16, 144), F(565),
+	A(565, 16, 1024), F(565), A(565, 16, 1024), F(565), A(565, 16, 144),
+	F(565), A(565, 16, 1024), F(565), A(565, 16, 1024), F(565),
+	A(565, 16, 144), F(565), A(565, 16, 1024), F(565), A(565, 16, 1024),
+	F(565), A(565, 16, 144), F(565), A(565, 16, 1024), F(565),
+	A(565, 16, 1024), F(565), A(565, 16, 144), F(565), A(565, 16, 1024),
+	F(565), A(565, 16, 1024), F(565), A(565, 16, 144), F(565),
+	A(565, 16, 1024), F(565), F(554), F(564), F(551), F(552), F(556),
+	F(555), F(561), F(562), F(553), F(545), F(559), F(560), F(557), F(558),
+	F(563), F(546), F(547), F(544), M(544, 64), F(483), F(460), F(412),
+	M(412, 14), F(412), M(412, 14), F(401), M(401, 7), F(412), M(412, 6),
+	R(412, 9), M(460, 5), R(460, 5), R(412, 14), F(460), M(460, 2),
+	R(460, 2), R(460, 4), R(460, 4), R(412, 18), F(460), M(460, 7),
+	R(460, 29), R(412, 47), F(460), M(460, 32), M(483, 40), M(547, 101),
+	M(546, 5), M(563, 16), M(558, 8), M(557, 3), R(563, 24), R(558, 12),
+	M(560, 5), R(563, 32), R(558, 16), M(559, 4), R(563, 40), R(558, 20),
+	M(545, 29), R(563, 48), R(558, 24), R(483, 80), M(553, 32), M(562, 40),
+	M(561, 32), M(555, 40), M(556, 4), F(556), A(556, 16, 1024),
+	A(552, 16, 1024), F(552), A(552, 16, 1024), F(552), A(552, 16, 144),
+	F(552), A(552, 16, 1024), F(552), A(552, 16, 1024), F(552),
+	A(552, 16, 144), F(552), A(552, 16, 1024), F(552), A(552, 16, 1024),
+	F(552), A(552, 16, 144), F(552), A(552, 16, 1024), F(552),
+	A(552, 16, 1024), F(552), A(552, 16, 144), F(552), A(552, 16, 1024),
+	F(552), A(552, 16, 1024), F(552), A(552, 16, 144), F(552),
+	A(552, 16, 1024), F(552), A(552, 16, 1024), F(552), A(552, 16, 144),
+	F(552), A(552, 16, 1024), F(552), F(556), F(546), F(557), F(560),
+	F(559), F(545), F(563), F(558), F(483), F(460), F(562), F(553), F(555),
+	F(561), F(547), F(412), M(412, 8), M(547, 23), R(547, 23), R(412, 16),
+	M(561, 21), R(412, 24), M(555, 16), F(547), M(547, 21), F(547),
+	M(547, 21), F(550), M(550, 14), F(547), M(547, 6), R(547, 9),
+	M(553, 5), R(553, 5), R(547, 14), F(553), M(553, 2), R(553, 2),
+	R(553, 4), R(553, 4), R(547, 18), F(553), M(553, 7), R(553, 20),
+	R(553, 20), R(547, 38), F(553), M(553, 32), M(562, 40), M(460, 101),
+	M(483, 5), M(558, 16), M(563, 8), M(545, 3), R(558, 24), R(563, 12),
+	M(559, 5), R(558, 32), R(563, 16), M(560, 4), R(558, 40), R(563, 20),
+	M(557, 20), R(558, 48), R(563, 24), R(562, 80), M(546, 32), M(556, 40),
+	M(552, 32), M(551, 40), M(564, 4), F(564), A(564, 16, 1024),
+	A(554, 16, 1024), F(554), A(554, 16, 1024), F(554), A(554, 16, 144),
+	F(554), A(554, 16, 1024), F(554), A(554, 16, 1024), F(554),
+	A(554, 16, 144), F(554), A(554, 16, 1024), F(554), A(554, 16, 1024),
+	F(554), A(554, 16, 144), F(554), A(554, 16, 1024), F(554),
+	A(554, 16, 1024), F(554), A(554, 16, 144), F(554), A(554, 16, 1024),
+	F(554), A(554, 16, 1024), F(554), A(554, 16, 144), F(554),
+	A(554, 16, 1024), F(554), A(554, 16, 1024), F(554), A(554, 16, 144),
+	F(554), A(554, 16, 1024), F(554), F(564), F(483), F(545), F(559),
+	F(560), F(557), F(558), F(563), F(562), F(553), F(556), F(546), F(551),
+	F(552), F(460), F(547), F(561), M(561, 16), F(561), M(561, 16), F(550),
+	M(550, 9), F(561), M(561, 6), R(561, 9), M(547, 5), R(547, 5),
+	R(561, 14), F(547), M(547, 2), R(547, 2), R(547, 4), R(547, 4),
+	R(561, 18), F(547), M(547, 7), R(547, 15), R(547, 15), R(561, 33),
+	F(547), M(547, 32), M(460, 40), M(552, 101), M(551, 5), M(546, 16),
+	M(556, 8), M(553, 3), R(546, 24), R(556, 12), M(562, 5), R(546, 32),
+	R(556, 16), M(563, 4), R(546, 40), R(556, 20), M(558, 15), R(546, 48),
+	R(556, 24), R(460, 80), M(557, 32), M(560, 40), M(559, 32), M(545, 40),
+	M(483, 4), F(483), A(483, 16, 1024), A(564, 16, 1024), F(564),
+	A(564, 16, 1024), F(564), A(564, 16, 144), F(564), A(564, 16, 1024),
+	F(564), A(564, 16, 1024), F(564), A(564, 16, 144), F(564),
+	A(564, 16, 1024), F(564), A(564, 16, 1024), F(564), A(564, 16, 144),
+	F(564), A(564, 16, 1024), F(564), A(564, 16, 1024), F(564),
+	A(564, 16, 144), F(564), A(564, 16, 1024), F(564), A(564, 16, 1024),
+	F(564), A(564, 16, 144), F(564), A(564, 16, 1024), F(564),
+	A(564, 16, 1024), F(564), A(564, 16, 144), F(564), A(564, 16, 1024),
+	F(564), F(483), F(551), F(553), F(562), F(563), F(558), F(546), F(556),
+	F(460), F(547), F(560), F(557), F(545), F(559), F(552), F(561), F(555),
+	F(412), F(413), F(400), M(400, 64), F(362), F(365), F(360), F(346),
+	M(346, 64), F(278), F(285), M(285, 64), F(269), F(206), F(200), F(190),
+	F(197), F(198), F(192), F(184), F(195), F(191), F(196), F(194), F(199),
+	F(185), F(186), F(183), M(183, 64), F(158), F(155), M(155, 4), F(490),
+	M(490, 4), F(155), M(155, 64), F(119), F(116),
+};
@@ -0,0 +1,597 @@
+/*
+ * Tests for the TLSF allocator, the pool used before relocation and
+ * malloc() tracing, and a benchmark against malloc()
+ *
+ * SPDX-License-Identifier:	GPL-2.0+
+ */
+
+#include <common.h>
+#include <command.h>
+#include <errno.h>
+#include <malloc.h>
+#include <mapmem.h>
+#include <tlsf.h>
+
+#define TEST_POOL_SIZE	(256 << 10)
+#define TEST_SLOTS	200
+#define TEST_OPS	20000
+#define BENCH_POOL_SIZE	(1 << 20)
+#define BENCH_LOOPS	20
+#define SIMPLE_POOL_SIZE	4096
+#define SIMPLE_SLOTS	32
+
+DECLARE_GLOBAL_DATA_PTR;
+
+/* Alignment used for DMA buffers on the i.MX6ULL (its cache line size) */
+#define BENCH_DMA_ALIGN	64
+
+enum malloc_trace_type {
+	MT_MALLOC,
+	MT_CALLOC,
+	MT_MEMALIGN,
+	MT_REALLOC,
+	MT_FREE,
+};
+
+struct malloc_trace_op {
+	u8 type;
+	u16 slot;
+	u16 align;
+	u32 size;
+};
+
+#define M(_slot, _size)		{ MT_MALLOC, _slot, 0, _size }
+#define C(_slot, _size)		{ MT_CALLOC, _slot, 0, _size }
+#define A(_slot, _align, _size)	{ MT_MEMALIGN, _slot, _align, _size }
+#define R(_slot, _size)		{ MT_REALLOC, _slot, 0, _size }
+#define F(_slot)		{ MT_FREE, _slot, 0, 0 }
+
+#include "malloc_trace.h"
+
+/* Simple pseudo-random numbers so that each run is the same */
+static uint test_rand(uint *seed)
+{
+	*seed = *seed * 1103515245 + 12345;
+
+	return *seed >> 8;
+}
+
+struct test_slot {
+	u8 *ptr;
+	size_t size;
+	u8 fill;
+};
+
+static int test_check_slot(struct test_slot *slot)
+{
+	size_t i;
+
+	for (i = 0; i < slot->size; i++) {
+		if (slot->ptr[i] != (u8)(slot->fill + i)) {
+			printf("%s: corrupted at %p + %zx\n", __func__,
+			       slot->ptr, i);
+			return -EINVAL;
+		}
+	}
+
+	return 0;
+}
+
+static void test_fill_slot(struct test_slot *slot, size_t start)
+{
+	size_t i;
+
+	for (i = start; i < slot->size; i++)
+		slot->ptr[i] = slot->fill + i;
+}
+
+static void test_count_block(void *ptr, size_t size, bool used, void *priv)
+{
+	uint *count = priv;
+
+	count[used]++;
+}
+
+/* Run random operations on a private pool, checking it as we go */
+static int test_tlsf_random(void)
+{
+	struct test_slot slots[TEST_SLOTS];
+	struct test_slot *slot;
+	struct tlsf_info info;
+	uint count[2] = { 0, 0 };
+	struct tlsf *tlsf;
+	uint seed = 1;
+	size_t size, align, start;
+	void *pool, *ptr;
+	int ret = -EINVAL;
+	int i, op;
+
+	pool = malloc(TEST_POOL_SIZE);
+	if (!pool)
+		return -ENOMEM;
+	tlsf = tlsf_create(pool, TEST_POOL_SIZE);
+	if (!tlsf)
+		goto err;
+	memset(slots, '\0', sizeof(slots));
+	for (i = 0; i < TEST_OPS; i++) {
+		slot = &slots[test_rand(&seed) % TEST_SLOTS];
+		op = test_rand(&seed) % 4;
+		size = test_rand(&seed) % (test_rand(&seed) % 8 ? 200 : 8000);
+		if (slot->ptr && test_check_slot(slot))
+			goto err;
+		if (op == 3 && slot->ptr) {
+			ptr = tlsf_realloc(tlsf, slot->ptr, size);
+			if (!ptr)
+				continue;
+			/* The start of the data must have been kept */
+			slot->ptr = ptr;
+			slot->size = min(slot->size, size);
+			if (test_check_slot(slot))
+				goto err;
+			start = slot->size;
+			slot->size = size;
+			test_fill_slot(slot, start);
+		} else if (slot->ptr) {
+			tlsf_free(tlsf, slot->ptr);
+			slot->ptr = NULL;
+		} else {
+			align = op == 2 ? 1 << (test_rand(&seed) % 13) : 0;
+			ptr = align ? tlsf_memalign(tlsf, align, size) :
+				tlsf_malloc(tlsf, size);
+			if (!ptr)
+				continue;
+			if (align && (ulong)ptr & (align - 1)) {
+				printf("%s: %p not aligned to %zx\n", __func__,
+				       ptr, align);
+				goto err;
+			}
+			if (tlsf_block_size(ptr) < size) {
+				printf("%s: block %p too small\n", __func__,
+				       ptr);
+				goto err;
+			}
+			slot->ptr = ptr;
+			slot->size = size;
+			slot->fill = test_rand(&seed);
+			test_fill_slot(slot, 0);
+		}
+		if (!(i % 256) && tlsf_check(tlsf)) {
+			printf("%s: pool corrupted after %d operations\n",
+			       __func__, i);
+			goto err;
+		}
+	}
+
+	tlsf_walk(tlsf, test_count_block, count);
+	tlsf_get_info(tlsf, &info);
+	if (count[0] != info.free_blocks || count[1] != info.used_blocks ||
+	    info.used + info.free != info.size) {
+		printf("%s: bad info\n", __func__);
+		goto err;
+	}
+
+	/* Freeing everything should leave a single free block */
+	for (i = 0; i < TEST_SLOTS; i++) {
+		slot = &slots[i];
+		if (slot->ptr && test_check_slot(slot))
+			goto err;
+		tlsf_free(tlsf, slot->ptr);
+	}
+	tlsf_get_info(tlsf, &info);
+	if (tlsf_check(tlsf) || info.used || info.used_blocks ||
+	    info.free_blocks != 1 || info.largest_free + sizeof(size_t) * 2 !=
+	    info.size) {
+		printf("%s: pool not empty at the end\n", __func__);
+		goto err;
+	}
+
+	/* Requests which cannot be met */
+	if (tlsf_malloc(tlsf, TEST_POOL_SIZE) ||
+	    tlsf_memalign(tlsf, TEST_POOL_SIZE, 16) ||
+	    tlsf_malloc(tlsf, -1UL)) {
+		printf("%s: oversized request succeeded\n", __func__);
+		goto err;
+	}
+	ret = 0;
+err:
+	free(pool);
+
+	return ret;
+}
+
+/* Check that malloc_heap_info() agrees with itself and sees allocations */
+static int test_heap_info(void)
+{
+	struct malloc_heap_info before, after;
+	void *ptr;
+
+	malloc_heap_info(&before);
+	ptr = malloc(1000);
+	if (!ptr)
+		return -ENOMEM;
+	malloc_heap_info(&after);
+	free(ptr);
+	if (before.used + before.free != before.size ||
+	    after.used + after.free != after.size ||
+	    after.used < before.used + 1000 ||
+	    after.used_blocks != before.used_blocks + 1) {
+		printf("%s: bad heap info\n", __func__);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+#if CONFIG_IS_ENABLED(SYS_MALLOC_F_POOL)
+static int test_simple_check(uint live)
+{
+	struct malloc_heap_info info;
+
+	malloc_simple_info(&info);
+	if (info.used_blocks != live || info.used + info.free != info.size ||
+	    gd->malloc_ptr > gd->malloc_limit) {
+		printf("%s: bad pool info\n", __func__);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Use the pool on a private arena, freeing and reusing memory */
+static int test_simple_pool_run(void)
+{
+	struct test_slot slots[SIMPLE_SLOTS];
+	struct test_slot *slot;
+	uint seed = 1, live = 0;
+	size_t size, align, start;
+	ulong high = 0;
+	void *ptr;
+	int i, op;
+
+	memset(slots, '\0', sizeof(slots));
+	for (i = 0; i < TEST_OPS; i++) {
+		slot = &slots[test_rand(&seed) % SIMPLE_SLOTS];
+		op = test_rand(&seed) % 4;
+		size = test_rand(&seed) % (test_rand(&seed) % 8 ? 100 : 600);
+		if (slot->ptr && test_check_slot(slot))
+			return -EINVAL;
+		if (op == 3 && slot->ptr) {
+			ptr = realloc_simple(slot->ptr, size);
+			if (!ptr)
+				continue;
+			slot->ptr = ptr;
+			slot->size = min(slot->size, size);
+			if (test_check_slot(slot))
+				return -EINVAL;
+			start = slot->size;
+			slot->size = size;
+			test_fill_slot(slot, start);
+		} else if (slot->ptr) {
+			free_simple(slot->ptr);
+			slot->ptr = NULL;
+			live--;
+		} else {
+			align = op == 2 ? 1 << (test_rand(&seed) % 8) : 0;
+			ptr = align ? memalign_simple(align, size) :
+				malloc_simple(size);
+			if (!ptr)
+				continue;
+			if ((ulong)ptr & (max_t(size_t, align, 8) - 1) ||
+			    !malloc_simple_owns(ptr) ||
+			    malloc_simple_usable_size(ptr) < size) {
+				printf("%s: bad block %p\n", __func__, ptr);
+				return -EINVAL;
+			}
+			slot->ptr = ptr;
+			slot->size = size;
+			slot->fill = test_rand(&seed);
+			test_fill_slot(slot, 0);
+			live++;
+		}
+		if (!(i % 256) && test_simple_check(live))
+			return -EINVAL;
+	}
+	for (i = 0; i < SIMPLE_SLOTS; i++) {
+		slot = &slots[i];
+		if (slot->ptr && test_check_slot(slot))
+			return -EINVAL;
+		free_simple(slot->ptr);
+	}
+	if (test_simple_check(0))
+		return -EINVAL;
+
+	/* Binding and unbinding the same thing should not use more memory */
+	for (i = 0; i < 1000; i++) {
+		ptr = malloc_simple(200);
+		free_simple(malloc_simple(40));
+		free_simple(ptr);
+		if (!i)
+			high = gd->malloc_ptr;
+	}
+	if (gd->malloc_ptr != high || test_simple_check(0)) {
+		printf("%s: memory not reused\n", __func__);
+		return -EINVAL;
+	}
+	if (malloc_simple(SIMPLE_POOL_SIZE)) {
+		printf("%s: oversized request succeeded\n", __func__);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int test_simple_pool(void)
+{
+	ulong base = gd->malloc_base, limit = gd->malloc_limit;
+	ulong ptr = gd->malloc_ptr;
+	struct malloc_f_pool *pool = gd->malloc_f_pool;
+	void *arena, *early, *moved;
+	int ret;
+
+	arena = malloc(SIMPLE_POOL_SIZE);
+	if (!arena)
+		return -ENOMEM;
+	gd->malloc_base = map_to_sysmem(arena);
+	gd->malloc_limit = SIMPLE_POOL_SIZE;
+	gd->malloc_ptr = 0;
+	gd->malloc_f_pool = NULL;
+	ret = test_simple_pool_run();
+	gd->malloc_base = base;
+	gd->malloc_limit = limit;
+	gd->malloc_ptr = ptr;
+	gd->malloc_f_pool = pool;
+	free(arena);
+	if (ret)
+		return ret;
+
+	/* realloc() moves memory from before relocation to the heap */
+	early = malloc_simple(16);
+	if (!early)
+		return 0;
+	strcpy(early, "early");
+	moved = realloc(early, 1000);
+	if (!moved || malloc_simple_owns(moved) || strcmp(moved, "early")) {
+		printf("%s: realloc() did not move memory to the heap\n",
+		       __func__);
+		ret = -EINVAL;
+	}
+	free(moved);
+
+	return ret;
+}
+#endif
+
+#ifdef CONFIG_MALLOC_TRACE
+/* Check that allocations are recorded against this function and removed */
+static noinline int test_trace(void)
+{
+	struct malloc_trace_rec rec;
+	ulong start = (ulong)test_trace;
+	void *ptr, *newptr;
+	int ret = -EINVAL;
+
+	ptr = malloc(100);
+	if (!ptr)
+		return -ENOMEM;
+	if (malloc_trace_get(ptr, &rec) || rec.size != 100 ||
+	    rec.caller <= start || rec.caller >= start + 0x400) {
+		printf("%s: malloc() not recorded\n", __func__);
+		goto err;
+	}
+	newptr = realloc(ptr, 5000);
+	if (!newptr)
+		goto err;
+	ptr = newptr;
+	if (malloc_trace_get(ptr, &rec) || rec.size != 5000) {
+		printf("%s: realloc() not recorded\n", __func__);
+		goto err;
+	}
+	ret = 0;
+err:
+	free(ptr);
+	if (!ret && malloc_trace_get(ptr, &rec) != -ENOENT) {
+		printf("%s: free() not recorded\n", __func__);
+		ret = -EINVAL;
+	}
+
+	return ret;
+}
+#endif
+
+/**
+ * struct bench_info - Results from replaying the trace on an empty heap
+ *
+ * @ns_per_op:	Average time for each operation
+ * @used:	Bytes used once the trace has run
+ * @frag:	Free bytes outside the largest free block
+ * @free_blocks: Free blocks
+ */
+struct bench_info {
+	ulong ns_per_op;
+	ulong used;
+	ulong frag;
+	uint free_blocks;
+};
+
+/**
+ * struct bench_args - Arguments for bench_replay_heap()
+ *
+ * @dma_align:	Minimum alignment for memalign()
+ * @bench:	Returns the results
+ */
+struct bench_args {
+	size_t dma_align;
+	struct bench_info *bench;
+};
+
+static void *bench_alloc(struct tlsf *tlsf, const struct malloc_trace_op *op,
+			 size_t dma_align)
+{
+	size_t align;
+	void *ptr;
+
+	switch (op->type) {
+	case MT_MALLOC:
+		return tlsf ? tlsf_malloc(tlsf, op->size) : malloc(op->size);
+	case MT_CALLOC:
+		if (!tlsf)
+			return calloc(1, op->size);
+		ptr = tlsf_malloc(tlsf, op->size);
+		if (ptr)
+			memset(ptr, '\0', op->size);
+		return ptr;
+	case MT_MEMALIGN:
+		align = max_t(size_t, op->align, dma_align);
+		return tlsf ? tlsf_memalign(tlsf, align, op->size) :
+			memalign(align, op->size);
+	}
+
+	return NULL;
+}
+
+static void bench_get_info(struct tlsf *tlsf, struct malloc_heap_info *info)
+{
+	struct tlsf_info tinfo;
+
+	if (!tlsf) {
+		malloc_heap_info(info);
+		return;
+	}
+	tlsf_get_info(tlsf, &tinfo);
+	info->used = tinfo.used;
+	info->free = tinfo.free;
+	info->largest_free = tinfo.largest_free;
+	info->free_blocks = tinfo.free_blocks;
+}
+
+/*
+ * Replay the trace on an empty pool or heap, returning the usage at the end
+ * of the first pass (before the allocations still live are freed)
+ */
+static int bench_replay(struct tlsf *tlsf, size_t dma_align,
+			struct bench_info *bench)
+{
+	const struct malloc_trace_op *op;
+	struct malloc_heap_info info;
+	void *slot[MALLOC_TRACE_SLOTS];
+	ulong start, ops = 0, us = 0;
+	void *ptr;
+	int loop, i;
+
+	for (loop = 0; loop < BENCH_LOOPS; loop++) {
+		memset(slot, '\0', sizeof(slot));
+		start = timer_get_us();
+		for (op = malloc_trace; op < malloc_trace +
+		     ARRAY_SIZE(malloc_trace); op++) {
+			switch (op->type) {
+			case MT_REALLOC:
+				ptr = tlsf ? tlsf_realloc(tlsf, slot[op->slot],
+							  op->size) :
+					realloc(slot[op->slot], op->size);
+				break;
+			case MT_FREE:
+				if (tlsf)
+					tlsf_free(tlsf, slot[op->slot]);
+				else
+					free(slot[op->slot]);
+				ptr = NULL;
+				break;
+			default:
+				ptr = bench_alloc(tlsf, op, dma_align);
+				break;
+			}
+			if (!ptr && op->type != MT_FREE) {
+				printf("%s: out of memory\n", __func__);
+				return -ENOMEM;
+			}
+			slot[op->slot] = ptr;
+		}
+		us += timer_get_us() - start;
+		ops += ARRAY_SIZE(malloc_trace);
+
+		if (!loop)
+			bench_get_info(tlsf, &info);
+
+		/* Free whatever the trace left allocated */
+		for (i = 0; i < MALLOC_TRACE_SLOTS; i++) {
+			if (tlsf)
+				tlsf_free(tlsf, slot[i]);
+			else
+				free(slot[i]);
+		}
+	}
+
+	bench->ns_per_op = us * 1000 / ops;
+	bench->used = info.used;
+	bench->free_blocks = info.free_blocks;
+	/* Free space outside the largest block is what fragmentation costs */
+	bench->frag = info.free - info.largest_free;
+
+	return 0;
+}
+
+/* Replay the trace through malloc(), run in a private heap */
+static int bench_replay_heap(void *priv)
+{
+	struct bench_args *args = priv;
+
+	return bench_replay(NULL, args->dma_align, args->bench);
+}
+
+static int bench_trace(size_t dma_align)
+{
+	struct bench_info dl, tl;
+	struct bench_args args;
+	struct tlsf *tlsf;
+	void *pool;
+	int ret;
+
+	pool = malloc(BENCH_POOL_SIZE);
+	if (!pool)
+		return -ENOMEM;
+	tlsf = tlsf_create(pool, BENCH_POOL_SIZE);
+	ret = tlsf ? bench_replay(tlsf, dma_align, &tl) : -EINVAL;
+	if (!ret && tlsf_check(tlsf))
+		ret = -EINVAL;
+
+	/* Then give malloc() the same memory, so both start empty */
+	args.dma_align = dma_align;
+	args.bench = &dl;
+	if (!ret)
+		ret = malloc_run_in_arena(pool, BENCH_POOL_SIZE,
+					  bench_replay_heap, &args);
+	free(pool);
+	if (ret)
+		return ret;
+
+	printf("%d operations, memalign() to at least %zu bytes:\n",
+	       (int)ARRAY_SIZE(malloc_trace), dma_align);
+	printf("%-10s %8s %10s %12s %12s\n", "", "ns/op", "used",
+	       "free blocks", "fragmented");
+	printf("%-10s %8lu %10lu %12u %12lu\n", "malloc()", dl.ns_per_op,
+	       dl.used, dl.free_blocks, dl.frag);
+	printf("%-10s %8lu %10lu %12u %12lu\n", "tlsf", tl.ns_per_op, tl.used,
+	       tl.free_blocks, tl.frag);
+
+	return 0;
+}
+
+int do_ut_malloc(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
+{
+	int ret = 0;
+
+	ret |= test_tlsf_random();
+	ret |= test_heap_info();
+#if CONFIG_IS_ENABLED(SYS_MALLOC_F_POOL)
+	ret |= test_simple_pool();
+#endif
+#ifdef CONFIG_MALLOC_TRACE
+	ret |= test_trace();
+#endif
+	ret |= bench_trace(1);
+	ret |= bench_trace(BENCH_DMA_ALIGN);
+
+	printf("Test %s\n", ret ? "failed" : "passed");
+
+	return ret ? CMD_RET_FAILURE : CMD_RET_SUCCESS;
+}
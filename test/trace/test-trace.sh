@@ -23,6 +23,11 @@ trace resume
 hash sha256 0 10000
 trace pause
 trace stats
+trace funclist 2000000 1000000
+trace calls
+host save hostfs - 2000000 ${trace_data} \${profoffset}
+bootstage chrome 4000000 100000
+host save hostfs - 4000000 ${bootstage_data} \${filesize}
 reset
 END
 }
@@ -54,11 +59,42 @@ check_results() {
 	fi
 }
 
+check_chrome() {
+	echo "Check Chrome trace"
+
+	# Merge the boot stages with the function trace, then check that the
+	# result is valid JSON containing both
+	./${OUTPUT_DIR}/tools/proftool -m ${OUTPUT_DIR}/System.map \
+		-p ${trace_data} -b ${bootstage_data} dump-chrome >${tmp} ||
+		fail "proftool error"
+	python -c "
+import json, sys
+events = json.load(open('${tmp}'))['traceEvents']
+cats = set(ev.get('cat') for ev in events)
+names = set(ev['name'] for ev in events)
+if 'bootstage' not in cats or 'function' not in cats:
+	sys.exit('missing events')
+if 'board_init_r' not in names or 'hash_command' not in names:
+	sys.exit('missing names')
+" || fail "Chrome trace error"
+
+	# The function list should count the 'hash' commands run while tracing
+	# was not paused
+	./${OUTPUT_DIR}/tools/proftool -m ${OUTPUT_DIR}/System.map \
+		-p ${trace_data} dump-funcs >${tmp} || fail "proftool error"
+	if ! grep -q "^ *2 .* hash_command$" ${tmp}; then
+		fail "function list error"
+	fi
+}
+
 echo "Simple trace test / sanity check using sandbox"
 echo
 tmp="$(tempfile)"
+trace_data="$(tempfile)"
+bootstage_data="$(tempfile)"
 build_uboot "${TRACE_OPT}"
 run_trace >${tmp}
 check_results ${tmp}
-rm ${tmp}
+check_chrome
+rm ${tmp} ${trace_data} ${bootstage_data}
 echo "Test passed"
@@ -28,6 +28,37 @@ reset'
 	fi
 }
 
+# Check that fit_check_sign rejects a FIT
+# Args:
+#	$1:	Test message
+#	$2:	FIT file to check
+check_sign_fails() {
+	echo -n "Test fit_check_sign: $1: "
+	if ${fit_check_sign} -f $2 -k sandbox-u-boot.dtb >${tmp} 2>&1; then
+		echo
+		echo "fit_check_sign accepted a bad FIT, output follows:"
+		cat ${tmp}
+		false
+	else
+		echo "OK"
+	fi
+}
+
+# Time repeated host-side verification of the signed configuration. This
+# only runs when BENCH is set to the number of runs, e.g. BENCH=20.
+# Args:
+#	$1:	Number of runs
+bench_check_sign() {
+	local start end
+
+	start=$(date +%s%N)
+	for i in $(seq $1); do
+		${fit_check_sign} -f test.fit -k sandbox-u-boot.dtb >/dev/null
+	done
+	end=$(date +%s%N)
+	echo "fit_check_sign: $(( (end - start) / $1 / 1000 )) us per run"
+}
+
 echo "Simple Verified Boot Test"
 echo "========================="
 echo
@@ -68,10 +99,16 @@ openssl genpkey -algorithm RSA -out ${keys}/dev.key \
 # Create a certificate containing the public key
 openssl req -batch -new -x509 -key ${keys}/dev.key -out ${keys}/dev.crt
 
+# Create a P-256 ECDSA key pair and certificate
+openssl ecparam -name prime256v1 -genkey -noout -out ${keys}/ecdev.key
+openssl req -batch -new -x509 -key ${keys}/ecdev.key -out ${keys}/ecdev.crt
+
 pushd ${dir} >/dev/null
 
+# Run the tests using sign-images-$algo.its and sign-configs-$algo.its, where
+# $sha is the hash algorithm used by those files
 function do_test {
-	echo do $sha test
+	echo do $algo test
 	# Compile our device tree files for kernel and U-Boot
 	dtc -p 0x1000 sandbox-kernel.dts -O dtb -o sandbox-kernel.dtb
 	dtc -p 0x1000 sandbox-u-boot.dts -O dtb -o sandbox-u-boot.dtb
@@ -81,7 +118,7 @@ function do_test {
 
 	# Build the FIT, but don't sign anything yet
 	echo Build FIT with signed images
-	${mkimage} -D "${dtc}" -f sign-images-$sha.its test.fit >${tmp}
+	${mkimage} -D "${dtc}" -f sign-images-$algo.its test.fit >${tmp}
 
 	run_uboot "unsigned signatures:" "dev-"
 
@@ -92,12 +129,18 @@ function do_test {
 
 	run_uboot "signed images" "dev+"
 
+	# The images have no hash nodes, so only their signatures protect them
+	cp test.fit test-bad.fit
+	data=$(fdtget -t bx test-bad.fit /images/kernel@1 data)
+	newbyte=$(printf %x $((0x${data:0:2} + 1)))
+	fdtput -t bx test-bad.fit /images/kernel@1 data ${newbyte} ${data:2}
+	check_sign_fails "tampered image without hash" test-bad.fit
 
 	# Create a fresh .dtb without the public keys
 	dtc -p 0x1000 sandbox-u-boot.dts -O dtb -o sandbox-u-boot.dtb
 
 	echo Build FIT with signed configuration
-	${mkimage} -D "${dtc}" -f sign-configs-$sha.its test.fit >${tmp}
+	${mkimage} -D "${dtc}" -f sign-configs-$algo.its test.fit >${tmp}
 
 	run_uboot "unsigned config" $sha"+ OK"
 
@@ -124,6 +167,14 @@ function do_test {
 			echo "OK"
 		fi
 	fi
+	if [ -n "${BENCH}" ]; then
+		bench_check_sign ${BENCH}
+	fi
+
+	cp test.fit test-bad.fit
+	fdtput -r test-bad.fit /images/fdt@1/hash@1
+	check_sign_fails "image with hash node removed" test-bad.fit
+	rm -f test-bad.fit
 
 	run_uboot "signed config" "dev+"
 
@@ -137,8 +188,13 @@ function do_test {
 }
 
 sha=sha1
+algo=sha1
+do_test
+sha=sha256
+algo=sha256
 do_test
 sha=sha256
+algo=ecdsa256
 do_test
 
 popd >/dev/null
@@ -0,0 +1,432 @@
+#!/usr/bin/env python
+#
+# SPDX-License-Identifier:      GPL-2.0+
+#
+# Device tree to C converter (dtoc)
+#
+# This converts a device tree into C structures, so that SPL can use the
+# information in it without needing libfdt or the device tree itself. See
+# doc/driver-model/of-plat.txt for details.
+
+from optparse import OptionParser
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.realpath(__file__)))
+import fdt
+
+# Properties which are not passed on to drivers
+IGNORE_PROPS = set([
+    '#address-cells',
+    '#gpio-cells',
+    '#size-cells',
+    'compatible',
+    'linux,phandle',
+    'phandle',
+    'status',
+    'u-boot,dm-pre-reloc',
+])
+
+# Properties which hold a list of phandles with arguments, with the name of
+# the property in the target node which gives the number of arguments
+PHANDLE_PROPS = {
+    'clocks': '#clock-cells',
+    'resets': '#reset-cells',
+}
+
+HEADER = '''/*
+ * DO NOT MODIFY
+ *
+ * This file was generated by dtoc from a .dtb (device tree binary) file.
+ */
+'''
+
+def ConvName(name):
+    """Convert a device tree name into a C identifier
+
+    Args:
+        name: Name to convert, e.g. 'fsl,imx21-uart' or 'serial@2020000'
+    Returns:
+        C identifier, e.g. 'fsl_imx21_uart' or 'serial_at_2020000'
+    """
+    name = name.replace('@', '_at_')
+    return ''.join([ch if ch.isalnum() else '_' for ch in name])
+
+def StrLiteral(value):
+    """Convert a string into a C string literal (without the quotes)"""
+    return value.replace('\\', '\\\\').replace('"', '\\"')
+
+def PhandleCellsProp(prop_name):
+    """Get the name of the property giving the number of phandle arguments
+
+    Args:
+        prop_name: Name of a property which may hold phandles
+    Returns:
+        Name of the '#...-cells' property, or None if this property does not
+        hold phandles
+    """
+    if prop_name in PHANDLE_PROPS:
+        return PHANDLE_PROPS[prop_name]
+    if prop_name == 'gpios' or prop_name.endswith('-gpios'):
+        return '#gpio-cells'
+    return None
+
+
+class DtbPlatdata:
+    """Generate C structures and platform data from a device tree
+
+    Attributes:
+        _fdt: Fdt object holding the device tree
+        _nodes: List of Nodes which are converted into devices
+        _cnames: Dict of C names for each node in _nodes, keyed by path
+        _structs: Dict of struct members, keyed by struct name. Each is a
+            dict of Prop objects, widened to hold the property from every
+            node which uses the struct, keyed by property name
+        _aliases: Dict of struct names, keyed by the alternative struct name
+            of each extra compatible string
+        _alias_users: Dict of lists of the struct names of the nodes which
+            have each extra compatible string, in device tree order, keyed
+            by the alternative struct name
+    """
+    def __init__(self, dtb_fname):
+        self._fdt = fdt.Fdt(dtb_fname)
+        self._nodes = []
+        self._cnames = {}
+        self._structs = {}
+        self._aliases = {}
+        self._alias_users = {}
+
+    def _ScanNode(self, node):
+        """Add the enabled nodes with a compatible string below a node
+
+        Args:
+            node: Node to scan the subnodes of
+        """
+        for subnode in node.subnodes:
+            status = subnode.props.get('status')
+            if status and status.value[0] not in ('okay', 'ok'):
+                continue
+            if 'compatible' in subnode.props:
+                self._nodes.append(subnode)
+            self._ScanNode(subnode)
+
+    def _SetCNames(self):
+        """Pick a C name for each node, adding the parent's if needed"""
+        counts = {}
+        for node in self._nodes:
+            name = ConvName(node.name)
+            counts[name] = counts.get(name, 0) + 1
+        for node in self._nodes:
+            name = ConvName(node.name)
+            if counts[name] > 1 and node.parent.parent:
+                name = ConvName(node.parent.name) + '_' + name
+            self._cnames[node.path] = name
+
+    def _GetPhandles(self, node, prop):
+        """Decode a property as a list of phandles with arguments
+
+        Args:
+            node: Node containing the property
+            prop: Prop object to decode
+        Returns:
+            List of (target Node, list of args), or None if the property
+            does not refer only to nodes which are converted
+        """
+        cells_prop = PhandleCellsProp(prop.name)
+        if not cells_prop or prop.type != fdt.TYPE_INT:
+            return None
+        result = []
+        value = prop.value
+        pos = 0
+        while pos < len(value):
+            target = self._fdt.phandles.get(value[pos])
+            if not target or target.path not in self._cnames:
+                return None
+            cells = target.props.get(cells_prop)
+            if cells:
+                if cells.type != fdt.TYPE_INT or len(cells.value) != 1:
+                    return None
+                num_args = cells.value[0]
+            else:
+                num_args = 0
+            if num_args > 3 or pos + 1 + num_args > len(value):
+                return None
+            result.append((target, value[pos + 1:pos + 1 + num_args]))
+            pos += 1 + num_args
+        return result
+
+    def _PhandleInfo(self, struct_name, prop_name):
+        """Get the struct used for a phandle property in a struct
+
+        A property is only converted into phandles if this works for every
+        node which uses the struct, and the number of arguments is the same
+        throughout.
+
+        Args:
+            struct_name: Name of the struct (without the 'dtd_' prefix)
+            prop_name: Name of the property
+        Returns:
+            Tuple (number of args, maximum number of phandles), or None
+        """
+        num_args = None
+        max_count = 0
+        for node in self._nodes:
+            if self._StructName(node) != struct_name:
+                continue
+            prop = node.props.get(prop_name)
+            if not prop:
+                continue
+            phandles = self._GetPhandles(node, prop)
+            if not phandles:
+                return None
+            for target, args in phandles:
+                if num_args is None:
+                    num_args = len(args)
+                elif num_args != len(args):
+                    return None
+            max_count = max(max_count, len(phandles))
+        if num_args is None:
+            return None
+        return num_args, max_count
+
+    def _StructName(self, node):
+        """Get the struct name for a node, from its first compatible string"""
+        return ConvName(node.props['compatible'].value[0])
+
+    def _ScanStructs(self):
+        """Work out the members of each struct from the nodes using it"""
+        for node in self._nodes:
+            name = self._StructName(node)
+            fields = self._structs.setdefault(name, {})
+            for prop_name, prop in node.props.items():
+                if prop_name in IGNORE_PROPS:
+                    continue
+                if prop_name in fields:
+                    fields[prop_name].Widen(prop)
+                else:
+                    fields[prop_name] = fdt.Prop(prop_name, prop.data)
+            for compat in node.props['compatible'].value[1:]:
+                alias = ConvName(compat)
+                users = self._alias_users.setdefault(alias, [])
+                if name not in users:
+                    users.append(name)
+                if alias not in self._structs:
+                    self._aliases.setdefault(alias, name)
+
+        # A struct may also be an alias of another; the struct wins
+        for alias in list(self._aliases.keys()):
+            if alias in self._structs:
+                del self._aliases[alias]
+
+    def _CheckAliases(self):
+        """Check that each compatible string stands for a single layout
+
+        A driver uses the struct named after a compatible string in its
+        of_match table, whichever node it binds to. Every node which has
+        that string must therefore use a struct with the same members.
+
+        Raises:
+            ValueError if nodes which share a compatible string have
+            structs with different members
+        """
+        for alias in sorted(self._alias_users):
+            names = list(self._alias_users[alias])
+            if alias in self._structs and alias not in names:
+                names.insert(0, alias)
+            layout = self._Members(names[0])
+            for name in names[1:]:
+                if self._Members(name) != layout:
+                    raise ValueError("Nodes with compatible string for "
+                                     "'dtd_%s' have different properties: "
+                                     "'dtd_%s' and 'dtd_%s' do not match" %
+                                     (alias, names[0], name))
+
+    def _MemberDecl(self, struct_name, prop):
+        """Get the declaration of a struct member
+
+        Args:
+            struct_name: Name of the struct (without the 'dtd_' prefix)
+            prop: Prop object giving the widened property type
+        Returns:
+            Tuple (type, name with any array size)
+        """
+        cname = ConvName(prop.name)
+        if prop.type == fdt.TYPE_INT:
+            info = self._PhandleInfo(struct_name, prop.name)
+            if info:
+                return ('struct phandle_%d_arg' % info[0],
+                        '%s[%d]' % (cname, info[1]))
+        if prop.type == fdt.TYPE_BOOL:
+            return 'bool', cname
+        elif prop.type == fdt.TYPE_INT:
+            count = len(prop.data) // 4
+            ctype = 'fdt32_t'
+        elif prop.type == fdt.TYPE_STRING:
+            count = len(prop.value)
+            ctype = 'const char *'
+        else:
+            count = len(prop.data)
+            ctype = 'unsigned char'
+        if count > 1 or ctype == 'unsigned char':
+            cname += '[%d]' % count
+        return ctype, cname
+
+    def _MemberValue(self, node, prop, decl_type, is_array):
+        """Get the C initialiser for a property
+
+        Args:
+            node: Node containing the property
+            prop: Prop object with the value
+            decl_type: Type of the struct member, from _MemberDecl()
+            is_array: True if the struct member is an array
+        Returns:
+            Initialiser as a string
+        """
+        if decl_type.startswith('struct phandle_'):
+            items = []
+            for target, args in self._GetPhandles(node, prop):
+                arg_str = ', '.join(['%d' % arg for arg in args])
+                items.append('{&%s%s, {%s}}' % ('dtv_',
+                             self._cnames[target.path], arg_str))
+            return '{%s}' % ', '.join(items)
+        elif decl_type == 'bool':
+            return 'true'
+        elif decl_type == 'fdt32_t' and prop.type == fdt.TYPE_INT:
+            vals = ['%#x' % val for val in prop.value]
+        elif decl_type == 'const char *' and prop.type == fdt.TYPE_STRING:
+            vals = ['"%s"' % StrLiteral(val) for val in prop.value]
+        else:
+            vals = ['%#x' % val for val in bytearray(prop.data)]
+        if not is_array:
+            return vals[0]
+        return '{%s}' % ', '.join(vals)
+
+    def _Members(self, struct_name):
+        """Get the sorted members of a struct
+
+        Returns:
+            List of (property name, type, name with any array size)
+        """
+        fields = self._structs[struct_name]
+        members = []
+        for prop_name in sorted(fields):
+            ctype, cname = self._MemberDecl(struct_name, fields[prop_name])
+            members.append((prop_name, ctype, cname))
+        return members
+
+    def Scan(self):
+        """Scan the device tree for nodes and work out the structs"""
+        self._ScanNode(self._fdt.root)
+        self._SetCNames()
+        self._ScanStructs()
+        self._CheckAliases()
+
+    def GenerateStructs(self, out):
+        """Write the C header with a struct for each compatible string
+
+        Args:
+            out: File to write to
+        """
+        out.write(HEADER)
+        out.write('\n#include <stdbool.h>\n#include <libfdt_env.h>\n')
+        for name in sorted(self._structs):
+            out.write('\nstruct dtd_%s {\n' % name)
+            for prop_name, ctype, cname in self._Members(name):
+                sep = '' if ctype.endswith('*') else ' '
+                out.write('\t%s%s%s;\n' % (ctype, sep, cname))
+            out.write('};\n')
+        if self._aliases:
+            out.write('\n')
+        for alias in sorted(self._aliases):
+            out.write('#define dtd_%s dtd_%s\n' % (alias,
+                                                    self._aliases[alias]))
+
+    def _OrderNodes(self):
+        """Order the nodes so that each comes after the nodes it refers to
+
+        Returns:
+            List of Nodes
+        """
+        ordered = []
+        done = set()
+
+        def _Add(node, visiting):
+            if node.path in done or node.path in visiting:
+                return
+            visiting.add(node.path)
+            for prop in node.props.values():
+                phandles = self._GetPhandles(node, prop)
+                for target, args in phandles or []:
+                    _Add(target, visiting)
+            done.add(node.path)
+            ordered.append(node)
+
+        for node in self._nodes:
+            _Add(node, set())
+        return ordered
+
+    def GeneratePlatdata(self, out):
+        """Write the C file with platform data and a device for each node
+
+        Args:
+            out: File to write to
+        """
+        out.write(HEADER)
+        out.write('\n#include <common.h>\n#include <dm.h>\n'
+                  '#include <dt-structs.h>\n')
+        for node in self._OrderNodes():
+            struct_name = self._StructName(node)
+            var_name = self._cnames[node.path]
+            out.write('\nstatic struct dtd_%s dtv_%s = {\n' %
+                      (struct_name, var_name))
+            for prop_name, ctype, cname in self._Members(struct_name):
+                prop = node.props.get(prop_name)
+                if not prop:
+                    continue
+                member = cname.split('[')[0]
+                value = self._MemberValue(node, prop, ctype, member != cname)
+                out.write('\t.%s\t= %s,\n' % (member, value))
+            out.write('};\n')
+
+            compat = ''.join(['%s\\0' % StrLiteral(val)
+                              for val in node.props['compatible'].value])
+            out.write('U_BOOT_DEVICE(%s) = {\n' % var_name)
+            out.write('\t.name\t\t= "%s",\n' % StrLiteral(node.name))
+            out.write('\t.compat\t\t= "%s",\n' % compat)
+            out.write('\t.platdata\t= &dtv_%s,\n' % var_name)
+            out.write('\t.platdata_size\t= sizeof(dtv_%s),\n' % var_name)
+            out.write('};\n')
+
+
+def Dtoc():
+    parser = OptionParser(usage='%prog [options] struct|platdata')
+    parser.add_option('-d', '--dtb-file', type='string', action='store',
+                    help='Specify the .dtb input file')
+    parser.add_option('-o', '--output', type='string', action='store',
+                    help='Select output filename (- for stdout)')
+    (options, args) = parser.parse_args()
+
+    if not options.dtb_file:
+        parser.error('Please specify the .dtb input file (-d)')
+    if len(args) != 1 or args[0] not in ('struct', 'platdata'):
+        parser.error("Please specify 'struct' or 'platdata'")
+
+    plat = DtbPlatdata(options.dtb_file)
+    try:
+        plat.Scan()
+    except ValueError as e:
+        sys.stderr.write('dtoc: %s: %s\n' % (options.dtb_file, e))
+        sys.exit(1)
+    if not options.output or options.output == '-':
+        out = sys.stdout
+    else:
+        out = open(options.output, 'w')
+    if args[0] == 'struct':
+        plat.GenerateStructs(out)
+    else:
+        plat.GeneratePlatdata(out)
+    if out != sys.stdout:
+        out.close()
+
+if __name__ == "__main__":
+    Dtoc()
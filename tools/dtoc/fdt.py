@@ -0,0 +1,193 @@
+#!/usr/bin/env python
+#
+# SPDX-License-Identifier:      GPL-2.0+
+#
+# Simple reader for flattened device tree (.dtb) files, used by dtoc. This
+# only needs the Python standard library, so dtoc works without the libfdt
+# Python bindings or the fdtget tool.
+
+import struct
+
+FDT_MAGIC = 0xd00dfeed
+
+FDT_BEGIN_NODE = 1
+FDT_END_NODE = 2
+FDT_PROP = 3
+FDT_NOP = 4
+FDT_END = 9
+
+# Property types, in the order that they are widened (see Prop.Widen())
+(TYPE_BOOL, TYPE_INT, TYPE_STRING, TYPE_BYTE) = range(4)
+
+def _IsPrintable(data):
+    """Check whether property data is a list of nul-terminated strings
+
+    Args:
+        data: Property value as bytes
+    Returns:
+        True if the data is one or more non-empty printable strings, each
+        followed by a nul character
+    """
+    if not data or data[-1:] != b'\0':
+        return False
+    for string in data[:-1].split(b'\0'):
+        if not string:
+            return False
+        for ch in bytearray(string):
+            if ch < 32 or ch > 126:
+                return False
+    return True
+
+
+class Prop:
+    """A device tree property
+
+    Attributes:
+        name: Property name
+        data: Raw property value as bytes
+        type: Property type (TYPE_...)
+        value: Property value: a list of ints for TYPE_INT, a list of
+            strings for TYPE_STRING, a list of byte values for TYPE_BYTE
+            and True for TYPE_BOOL
+    """
+    def __init__(self, name, data):
+        self.name = name
+        self.data = data
+        if not data:
+            self.type = TYPE_BOOL
+            self.value = True
+        elif _IsPrintable(data):
+            self.type = TYPE_STRING
+            self.value = [s.decode('ascii') for s in data[:-1].split(b'\0')]
+        elif len(data) % 4 == 0:
+            self.type = TYPE_INT
+            self.value = list(struct.unpack('>%dI' % (len(data) // 4), data))
+        else:
+            self.type = TYPE_BYTE
+            self.value = list(bytearray(data))
+
+    def Widen(self, other):
+        """Change this property so that it can also hold another's value
+
+        This is used to work out the type of a struct member from all the
+        nodes which have that property.
+
+        Args:
+            other: Prop with the same name from another node
+        """
+        if other.type == TYPE_BOOL:
+            return
+        if self.type == TYPE_BOOL:
+            self.type = other.type
+        elif self.type != other.type:
+            self.type = TYPE_BYTE
+        self.data = max(self.data, other.data, key=len)
+        if len(other.value) > len(self.value) or self.type == TYPE_BYTE:
+            self.value = other.value
+
+
+class Node:
+    """A device tree node
+
+    Attributes:
+        name: Node name, including any unit address
+        path: Full path to the node
+        offset: Offset of the node in the .dtb
+        parent: Parent Node, or None for the root node
+        props: Dict of Prop objects, keyed by property name
+        subnodes: List of child Nodes, in the order they appear
+    """
+    def __init__(self, name, path, offset, parent):
+        self.name = name
+        self.path = path
+        self.offset = offset
+        self.parent = parent
+        self.props = {}
+        self.subnodes = []
+
+
+class Fdt:
+    """A device tree read from a .dtb file
+
+    Attributes:
+        root: Root Node
+        phandles: Dict of Nodes, keyed by phandle
+    """
+    def __init__(self, fname):
+        with open(fname, 'rb') as fd:
+            self._data = fd.read()
+        self.phandles = {}
+        self.root = self._Parse()
+
+    def _Parse(self):
+        """Read the nodes and properties from the .dtb
+
+        Returns:
+            Root Node
+        """
+        data = self._data
+        if len(data) < 40:
+            raise ValueError('Device tree is truncated')
+        (magic, totalsize, off_struct, off_strings, _, _, _, _,
+         size_strings, size_struct) = struct.unpack('>10I', data[:40])
+        if magic != FDT_MAGIC or totalsize > len(data):
+            raise ValueError('Not a valid device tree')
+        strings = data[off_strings:off_strings + size_strings]
+
+        pos = off_struct
+        end = off_struct + size_struct
+        node = root = None
+        while pos < end:
+            tag, = struct.unpack('>I', data[pos:pos + 4])
+            offset = pos
+            pos += 4
+            if tag == FDT_BEGIN_NODE:
+                name_end = data.index(b'\0', pos)
+                name = data[pos:name_end].decode('ascii')
+                pos = (name_end + 4) & ~3
+                if node:
+                    path = node.path.rstrip('/') + '/' + name
+                else:
+                    path = '/'
+                new_node = Node(name, path, offset - off_struct, node)
+                if node:
+                    node.subnodes.append(new_node)
+                else:
+                    root = new_node
+                node = new_node
+            elif tag == FDT_END_NODE:
+                if not node:
+                    raise ValueError('Unexpected end of node at %#x' % pos)
+                node = node.parent
+            elif tag == FDT_PROP:
+                length, name_off = struct.unpack('>II', data[pos:pos + 8])
+                pos += 8
+                name_end = strings.index(b'\0', name_off)
+                name = strings[name_off:name_end].decode('ascii')
+                node.props[name] = Prop(name, data[pos:pos + length])
+                pos = (pos + length + 3) & ~3
+                if name in ('phandle', 'linux,phandle') and length == 4:
+                    phandle, = struct.unpack('>I', node.props[name].data)
+                    self.phandles[phandle] = node
+            elif tag == FDT_NOP:
+                pass
+            elif tag == FDT_END:
+                break
+            else:
+                raise ValueError('Bad tag %d at %#x' % (tag, offset))
+        if not root or node:
+            raise ValueError('Device tree is truncated')
+        return root
+
+    def Scan(self, node=None):
+        """Generate all the nodes in the tree, parents before children
+
+        Args:
+            node: Node to start from (None for the root node)
+        """
+        if not node:
+            node = self.root
+        yield node
+        for subnode in node.subnodes:
+            for child in self.Scan(subnode):
+                yield child
@@ -0,0 +1,85 @@
+#!/usr/bin/env python
+#
+# SPDX-License-Identifier:	GPL-2.0+
+#
+# Tests for dtoc, run over the device trees in the test/ directory. Set DTC
+# to use a device tree compiler other than 'dtc' from the path.
+
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import unittest
+
+our_path = os.path.dirname(os.path.realpath(__file__))
+sys.path.insert(0, our_path)
+
+import dtoc
+
+try:
+    from StringIO import StringIO
+except ImportError:
+    from io import StringIO
+
+
+class TestDtoc(unittest.TestCase):
+    """Test generating structs from a device tree"""
+    def setUp(self):
+        self._indir = tempfile.mkdtemp(prefix='dtoc.')
+
+    def tearDown(self):
+        shutil.rmtree(self._indir)
+
+    def _Compile(self, fname):
+        """Compile a test .dts file into a .dtb and scan it with dtoc
+
+        Args:
+            fname: Name of the .dts file in the test/ directory
+        Returns:
+            DtbPlatdata object, not yet scanned
+        """
+        dtb = os.path.join(self._indir, os.path.splitext(fname)[0] + '.dtb')
+        subprocess.check_call([os.environ.get('DTC', 'dtc'), '-I', 'dts',
+                               '-O', 'dtb', '-o', dtb,
+                               os.path.join(our_path, 'test', fname)])
+        return dtoc.DtbPlatdata(dtb)
+
+    def _Structs(self, plat):
+        out = StringIO()
+        plat.GenerateStructs(out)
+        return out.getvalue()
+
+    def testAliases(self):
+        """Test that extra compatible strings refer to the first struct"""
+        plat = self._Compile('dtoc_test_aliases.dts')
+        plat.Scan()
+        structs = self._Structs(plat)
+        self.assertIn('struct dtd_vendor_soc_a_uart {\n', structs)
+        self.assertIn('struct dtd_vendor_soc_b_uart {\n', structs)
+        self.assertIn('#define dtd_vendor_generic_uart dtd_vendor_soc_a_uart\n',
+                      structs)
+
+        # A compatible string with its own struct is not also an alias
+        self.assertIn('struct dtd_vendor_gpio {\n', structs)
+        self.assertNotIn('#define dtd_vendor_gpio ', structs)
+
+        # Both UART structs must have the same members as the alias
+        members = ('\tfdt32_t clock_frequency;\n'
+                   '\tfdt32_t reg[2];\n'
+                   '};\n')
+        self.assertIn('struct dtd_vendor_soc_a_uart {\n' + members, structs)
+        self.assertIn('struct dtd_vendor_soc_b_uart {\n' + members, structs)
+
+    def testAliasConflict(self):
+        """Test that nodes sharing a compatible string must match"""
+        plat = self._Compile('dtoc_test_alias_conflict.dts')
+        with self.assertRaises(ValueError) as e:
+            plat.Scan()
+        self.assertIn("'dtd_vendor_generic_uart'", str(e.exception))
+        self.assertIn("'dtd_vendor_soc_a_uart' and 'dtd_vendor_soc_b_uart'",
+                      str(e.exception))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -26,9 +26,10 @@
 
 void usage(char *cmdname)
 {
-	fprintf(stderr, "Usage: %s -f fit file -k key file\n"
+	fprintf(stderr, "Usage: %s -f fit file -k key file [-j threads]\n"
 			 "          -f ==> set fit file which should be checked'\n"
-			 "          -k ==> set key file which contains the key'\n",
+			 "          -k ==> set key file which contains the key'\n"
+			 "          -j ==> set number of threads used to hash images\n",
 		cmdname);
 	exit(EXIT_FAILURE);
 }
@@ -49,11 +50,14 @@ int main(int argc, char **argv)
 
 	strncpy(cmdname, *argv, sizeof(cmdname) - 1);
 	cmdname[sizeof(cmdname) - 1] = '\0';
-	while ((c = getopt(argc, argv, "f:k:")) != -1)
+	while ((c = getopt(argc, argv, "f:j:k:")) != -1)
 		switch (c) {
 		case 'f':
 			fdtfile = optarg;
 			break;
+		case 'j':
+			fit_set_hash_threads(strtoul(optarg, NULL, 0));
+			break;
 		case 'k':
 			keyfile = optarg;
 			break;
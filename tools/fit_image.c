@@ -53,6 +53,7 @@ static int fit_add_file_data(struct image_tool_params *params, size_t size_inc,
 		ret = fit_set_timestamp(ptr, 0, sbuf.st_mtime);
 
 	if (!ret) {
+		fit_set_hash_threads(params->hash_threads);
 		ret = fit_add_verification_data(params->keydir, dest_blob, ptr,
 						params->comment,
 						params->require_keys);
@@ -12,8 +12,198 @@
 #include "mkimage.h"
 #include <bootm.h>
 #include <image.h>
+#include <pthread.h>
 #include <version.h>
 
+/* Upper limit on the number of threads used to hash images */
+#define FIT_HASH_MAX_THREADS	64
+
+/* Number of threads used to hash images, 0 for one per online CPU */
+static int fit_hash_threads;
+
+/**
+ * struct fit_hash_job - a hash value to calculate for one hash node
+ *
+ * The image data is not copied: it points into the (mmap()ed) FIT, which
+ * must not be modified while the jobs are running.
+ *
+ * @image_noffset:	Offset of the component image node
+ * @noffset:		Offset of the hash node
+ * @algo:		Hash algorithm name, from the hash node
+ * @data:		Image data to hash
+ * @size:		Size of image data in bytes
+ * @value:		Returns the calculated hash value
+ * @value_len:		Returns the length of the hash value
+ * @ret:		Returns the result of calculate_hash()
+ */
+struct fit_hash_job {
+	int image_noffset;
+	int noffset;
+	char *algo;
+	const void *data;
+	size_t size;
+	uint8_t value[FIT_MAX_HASH_LEN];
+	int value_len;
+	int ret;
+};
+
+struct fit_hash_pool {
+	struct fit_hash_job **order;
+	int count;
+	int next;
+	pthread_mutex_t lock;
+};
+
+void fit_set_hash_threads(int threads)
+{
+	fit_hash_threads = threads;
+}
+
+static void *fit_hash_worker(void *arg)
+{
+	struct fit_hash_pool *pool = arg;
+	struct fit_hash_job *job;
+
+	for (;;) {
+		pthread_mutex_lock(&pool->lock);
+		job = pool->next < pool->count ? pool->order[pool->next++] :
+			NULL;
+		pthread_mutex_unlock(&pool->lock);
+		if (!job)
+			break;
+		job->ret = calculate_hash(job->data, job->size, job->algo,
+					  job->value, &job->value_len);
+	}
+
+	return NULL;
+}
+
+static int h_compare_job_size(const void *v1, const void *v2)
+{
+	const struct fit_hash_job *job1 = *(struct fit_hash_job **)v1;
+	const struct fit_hash_job *job2 = *(struct fit_hash_job **)v2;
+
+	if (job1->size == job2->size)
+		return 0;
+
+	return job1->size < job2->size ? 1 : -1;
+}
+
+/**
+ * fit_hash_run() - Calculate the hash values for a list of jobs
+ *
+ * The largest images are started first so that a big ramdisk does not end
+ * up being hashed on its own after everything else has finished. The
+ * calling thread takes part in the work, so with one thread (or one job)
+ * no threads are created at all.
+ *
+ * @jobs:	Jobs to run
+ * @count:	Number of jobs
+ * @return 0 if ok, -ENOMEM if out of memory
+ */
+static int fit_hash_run(struct fit_hash_job *jobs, int count)
+{
+	pthread_t threads[FIT_HASH_MAX_THREADS];
+	struct fit_hash_pool pool;
+	int nthreads, started;
+	int i;
+
+	if (!count)
+		return 0;
+	pool.order = malloc(count * sizeof(*pool.order));
+	if (!pool.order)
+		return -ENOMEM;
+	for (i = 0; i < count; i++)
+		pool.order[i] = &jobs[i];
+	qsort(pool.order, count, sizeof(*pool.order), h_compare_job_size);
+	pool.count = count;
+	pool.next = 0;
+	pthread_mutex_init(&pool.lock, NULL);
+
+	nthreads = fit_hash_threads;
+	if (nthreads <= 0)
+		nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+	if (nthreads > count)
+		nthreads = count;
+	if (nthreads > FIT_HASH_MAX_THREADS)
+		nthreads = FIT_HASH_MAX_THREADS;
+
+	/* If we cannot start a thread, the others just do more of the work */
+	for (started = 0; started < nthreads - 1; started++) {
+		if (pthread_create(&threads[started], NULL, fit_hash_worker,
+				   &pool))
+			break;
+	}
+	fit_hash_worker(&pool);
+	for (i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+
+	pthread_mutex_destroy(&pool.lock);
+	free(pool.order);
+
+	return 0;
+}
+
+/**
+ * fit_image_add_hash_jobs() - Add a job for each hash node of an image
+ *
+ * @fit:	Pointer to the FIT format image header
+ * @image_noffset: Component image node
+ * @jobsp:	Pointer to the job list, which is extended as needed
+ * @countp:	Pointer to the number of jobs in the list
+ * @return 0 if ok, -1 on error
+ */
+static int fit_image_add_hash_jobs(const void *fit, int image_noffset,
+				   struct fit_hash_job **jobsp, int *countp)
+{
+	struct fit_hash_job *job, *jobs;
+	const char *image_name;
+	const void *data;
+	size_t size;
+	int noffset;
+
+	if (fit_image_get_data(fit, image_noffset, &data, &size)) {
+		printf("Can't get image data/size\n");
+		return -1;
+	}
+	image_name = fit_get_name(fit, image_noffset, NULL);
+
+	/*
+	 * Check subnode name, must be equal to "hash". Multiple hash nodes
+	 * require unique unit node names, e.g. hash@1, hash@2, etc.
+	 */
+	for (noffset = fdt_first_subnode(fit, image_noffset);
+	     noffset >= 0;
+	     noffset = fdt_next_subnode(fit, noffset)) {
+		const char *node_name = fit_get_name(fit, noffset, NULL);
+
+		if (strncmp(node_name, FIT_HASH_NODENAME,
+			    strlen(FIT_HASH_NODENAME)))
+			continue;
+
+		jobs = realloc(*jobsp, (*countp + 1) * sizeof(*jobs));
+		if (!jobs) {
+			printf("Out of memory for hash of '%s' image node\n",
+			       image_name);
+			return -1;
+		}
+		*jobsp = jobs;
+		job = &jobs[(*countp)++];
+		memset(job, '\0', sizeof(*job));
+		job->image_noffset = image_noffset;
+		job->noffset = noffset;
+		job->data = data;
+		job->size = size;
+		if (fit_image_hash_get_algo(fit, noffset, &job->algo)) {
+			printf("Can't get hash algo property for '%s' hash node in '%s' image node\n",
+			       node_name, image_name);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
 /**
  * fit_set_hash_value - set hash value in requested has node
  * @fit: pointer to the FIT format image header
@@ -44,45 +234,50 @@ static int fit_set_hash_value(void *fit, int noffset, uint8_t *value,
 	return 0;
 }
 
+static int h_compare_job_offset(const void *v1, const void *v2)
+{
+	const struct fit_hash_job *job1 = v1;
+	const struct fit_hash_job *job2 = v2;
+
+	return job2->noffset - job1->noffset;
+}
+
 /**
- * fit_image_process_hash - Process a single subnode of the images/ node
+ * fit_image_write_hashes() - Store the calculated values in the hash nodes
  *
- * Check each subnode and process accordingly. For hash nodes we generate
- * a hash of the supplised data and store it in the node.
+ * Adding a property only moves the nodes which follow it in the FIT, so
+ * the jobs are written from the last node to the first, which keeps the
+ * node offsets recorded in the remaining jobs valid.
  *
  * @fit:	pointer to the FIT format image header
- * @image_name:	name of image being processes (used to display errors)
- * @noffset:	subnode offset
- * @data:	data to process
- * @size:	size of data in bytes
+ * @jobs:	Jobs which have been run by fit_hash_run()
+ * @count:	Number of jobs
  * @return 0 if ok, -1 on error
  */
-static int fit_image_process_hash(void *fit, const char *image_name,
-		int noffset, const void *data, size_t size)
+static int fit_image_write_hashes(void *fit, struct fit_hash_job *jobs,
+				  int count)
 {
-	uint8_t value[FIT_MAX_HASH_LEN];
-	const char *node_name;
-	int value_len;
-	char *algo;
-
-	node_name = fit_get_name(fit, noffset, NULL);
-
-	if (fit_image_hash_get_algo(fit, noffset, &algo)) {
-		printf("Can't get hash algo property for '%s' hash node in '%s' image node\n",
-		       node_name, image_name);
-		return -1;
-	}
-
-	if (calculate_hash(data, size, algo, value, &value_len)) {
-		printf("Unsupported hash algorithm (%s) for '%s' hash node in '%s' image node\n",
-		       algo, node_name, image_name);
-		return -1;
-	}
+	const char *node_name, *image_name;
+	struct fit_hash_job *job;
+
+	qsort(jobs, count, sizeof(*jobs), h_compare_job_offset);
+	for (job = jobs; job < jobs + count; job++) {
+		node_name = fit_get_name(fit, job->noffset, NULL);
+		image_name = fit_get_name(fit, job->image_noffset, NULL);
+		if (job->ret) {
+			printf("Unsupported hash algorithm (%s) for '%s' hash node in '%s' image node\n",
+			       job->algo, node_name, image_name);
+			return -1;
+		}
 
-	if (fit_set_hash_value(fit, noffset, value, value_len)) {
-		printf("Can't set hash value for '%s' hash node in '%s' image node\n",
-		       node_name, image_name);
-		return -1;
+		/* The algo pointer is invalid once the FIT is modified */
+		job->algo = NULL;
+		if (fit_set_hash_value(fit, job->noffset, job->value,
+				       job->value_len)) {
+			printf("Can't set hash value for '%s' hash node in '%s' image node\n",
+			       node_name, image_name);
+			return -1;
+		}
 	}
 
 	return 0;
@@ -249,26 +444,8 @@ static int fit_image_process_sig(const char *keydir, void *keydest,
 /**
  * fit_image_add_verification_data() - calculate/set verig. data for image node
  *
- * This adds hash and signature values for an component image node.
- *
- * All existing hash subnodes are checked, if algorithm property is set to
- * one of the supported hash algorithms, hash value is computed and
- * corresponding hash node property is set, for example:
- *
- * Input component image node structure:
- *
- * o image@1 (at image_noffset)
- *   | - data = [binary data]
- *   o hash@1
- *     |- algo = "sha1"
- *
- * Output component image node structure:
- *
- * o image@1 (at image_noffset)
- *   | - data = [binary data]
- *   o hash@1
- *     |- algo = "sha1"
- *     |- value = sha1(data)
+ * This adds signature values for an component image node. The hash values
+ * are added beforehand for all images at once, by fit_add_image_hashes().
  *
  * For signature details, please see doc/uImage.FIT/signature.txt
  *
@@ -297,7 +474,7 @@ int fit_image_add_verification_data(const char *keydir, void *keydest,
 
 	image_name = fit_get_name(fit, image_noffset, NULL);
 
-	/* Process all hash subnodes of the component image node */
+	/* Process all signature subnodes of the component image node */
 	for (noffset = fdt_first_subnode(fit, image_noffset);
 	     noffset >= 0;
 	     noffset = fdt_next_subnode(fit, noffset)) {
@@ -305,18 +482,14 @@ int fit_image_add_verification_data(const char *keydir, void *keydest,
 		int ret = 0;
 
 		/*
-		 * Check subnode name, must be equal to "hash" or "signature".
-		 * Multiple hash nodes require unique unit node
-		 * names, e.g. hash@1, hash@2, signature@1, etc.
+		 * Check subnode name, must be equal to "signature".
+		 * Multiple signature nodes require unique unit node
+		 * names, e.g. signature@1, signature@2, etc.
 		 */
 		node_name = fit_get_name(fit, noffset, NULL);
-		if (!strncmp(node_name, FIT_HASH_NODENAME,
-			     strlen(FIT_HASH_NODENAME))) {
-			ret = fit_image_process_hash(fit, image_name, noffset,
-						data, size);
-		} else if (IMAGE_ENABLE_SIGN && keydir &&
-			   !strncmp(node_name, FIT_SIG_NODENAME,
-				strlen(FIT_SIG_NODENAME))) {
+		if (IMAGE_ENABLE_SIGN && keydir &&
+		    !strncmp(node_name, FIT_SIG_NODENAME,
+			     strlen(FIT_SIG_NODENAME))) {
 			ret = fit_image_process_sig(keydir, keydest,
 				fit, image_name, noffset, data, size,
 				comment, require_keys);
@@ -652,6 +825,54 @@ static int fit_config_add_verification_data(const char *keydir, void *keydest,
 	return 0;
 }
 
+/**
+ * fit_add_image_hashes() - calculate and set the hash values of all images
+ *
+ * All hash subnodes of all component images are collected and hashed in
+ * parallel, then the values are stored in the FIT, for example:
+ *
+ * Input component image node structure:
+ *
+ * o image@1 (at image_noffset)
+ *   | - data = [binary data]
+ *   o hash@1
+ *     |- algo = "sha1"
+ *
+ * Output component image node structure:
+ *
+ * o image@1 (at image_noffset)
+ *   | - data = [binary data]
+ *   o hash@1
+ *     |- algo = "sha1"
+ *     |- value = sha1(data)
+ *
+ * @fit:	Pointer to the FIT format image header
+ * @images_noffset: Offset of the images parent node
+ * @return 0 if ok, -1 on error
+ */
+static int fit_add_image_hashes(void *fit, int images_noffset)
+{
+	struct fit_hash_job *jobs = NULL;
+	int count = 0;
+	int noffset;
+	int ret = 0;
+
+	for (noffset = fdt_first_subnode(fit, images_noffset);
+	     noffset >= 0 && !ret;
+	     noffset = fdt_next_subnode(fit, noffset))
+		ret = fit_image_add_hash_jobs(fit, noffset, &jobs, &count);
+
+	if (!ret && fit_hash_run(jobs, count)) {
+		printf("Out of memory hashing images\n");
+		ret = -1;
+	}
+	if (!ret)
+		ret = fit_image_write_hashes(fit, jobs, count);
+	free(jobs);
+
+	return ret;
+}
+
 int fit_add_verification_data(const char *keydir, void *keydest, void *fit,
 			      const char *comment, int require_keys)
 {
@@ -667,6 +888,10 @@ int fit_add_verification_data(const char *keydir, void *keydest, void *fit,
 		return images_noffset;
 	}
 
+	ret = fit_add_image_hashes(fit, images_noffset);
+	if (ret)
+		return ret;
+
 	/* Process its subnodes, print out component images details */
 	for (noffset = fdt_first_subnode(fit, images_noffset);
 	     noffset >= 0;
@@ -708,6 +933,87 @@ int fit_add_verification_data(const char *keydir, void *keydest, void *fit,
 }
 
 #ifdef CONFIG_FIT_SIGNATURE
+/**
+ * fit_config_check_images() - verify the images used by a configuration
+ *
+ * The hashes of the kernel, FDT and ramdisk are checked in parallel. Then
+ * any required signatures are checked for each of these images, whether
+ * or not it has hash nodes.
+ *
+ * @fit:	Pointer to the FIT format image header
+ * @cfg_noffset: Configuration node to check
+ * @return 0 if ok, -EPERM if a hash or signature did not match, other -ve
+ * on error
+ */
+static int fit_config_check_images(const void *fit, int cfg_noffset)
+{
+	static const char * const image_props[] = {
+		FIT_KERNEL_PROP,
+		FIT_FDT_PROP,
+		FIT_RAMDISK_PROP,
+	};
+	int image_noffsets[ARRAY_SIZE(image_props)];
+	struct fit_hash_job *jobs = NULL, *job;
+	int image_count = 0;
+	uint8_t *fit_value;
+	int fit_value_len;
+	const void *data;
+	size_t size;
+	int count = 0;
+	int no_sigs;
+	int i, ret;
+
+	for (i = 0, ret = 0; i < ARRAY_SIZE(image_props) && !ret; i++) {
+		int noffset;
+
+		noffset = fit_conf_get_prop_node(fit, cfg_noffset,
+						 image_props[i]);
+		if (noffset < 0)
+			continue;
+		image_noffsets[image_count++] = noffset;
+		ret = fit_image_add_hash_jobs(fit, noffset, &jobs, &count);
+	}
+	if (!ret)
+		ret = fit_hash_run(jobs, count);
+
+	for (job = jobs; job < jobs + count && !ret; job++) {
+		printf("   %s/%s: %s", fit_get_name(fit, job->image_noffset, NULL),
+		       fit_get_name(fit, job->noffset, NULL), job->algo);
+		if (job->ret) {
+			printf(" unsupported!\n");
+			ret = -EPERM;
+		} else if (fit_image_hash_get_value(fit, job->noffset,
+						    &fit_value,
+						    &fit_value_len)) {
+			printf(" no value!\n");
+			ret = -EPERM;
+		} else if (fit_value_len != job->value_len ||
+			   memcmp(job->value, fit_value, fit_value_len)) {
+			printf("- Bad hash value!\n");
+			ret = -EPERM;
+		} else {
+			printf("+\n");
+		}
+	}
+	free(jobs);
+
+	/* An image without a hash node still needs its required signatures */
+	for (i = 0; i < image_count && !ret; i++) {
+		if (fit_image_get_data(fit, image_noffsets[i], &data, &size)) {
+			printf("Can't get image data/size\n");
+			ret = -EINVAL;
+		} else if (fit_image_verify_required_sigs(fit,
+				image_noffsets[i], data, size, gd_fdt_blob(),
+				&no_sigs)) {
+			printf("Unable to verify required signature for '%s'\n",
+			       fit_get_name(fit, image_noffsets[i], NULL));
+			ret = -EPERM;
+		}
+	}
+
+	return ret;
+}
+
 int fit_check_sign(const void *fit, const void *key)
 {
 	int cfg_noffset;
@@ -721,7 +1027,13 @@ int fit_check_sign(const void *fit, const void *key)
 	ret = fit_config_verify(fit, cfg_noffset);
 	if (ret)
 		return ret;
-	ret = bootm_host_load_images(fit, cfg_noffset);
+	printf("OK\n");
+	ret = fit_config_check_images(fit, cfg_noffset);
+	if (ret)
+		return ret;
+
+	/* The images are verified above, so only load them as bootm would */
+	ret = bootm_host_load_images(fit, cfg_noffset, 0);
 
 	return ret;
 }
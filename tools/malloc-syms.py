@@ -0,0 +1,138 @@
+#!/usr/bin/env python
+#
+# SPDX-License-Identifier:      GPL-2.0+
+#
+# Add function names to the output of the 'malloc' command
+#
+# With CONFIG_MALLOC_TRACE, 'malloc info', 'malloc dump' and the report
+# printed before booting show caller addresses as [<address>], together with
+# the run-time address of malloc_trace_info(). This finds that function in
+# the U-Boot ELF file, works out how far U-Boot was moved (by relocation, or
+# by loading a position-independent sandbox build) and looks up each caller
+# with addr2line.
+#
+# Usage:
+#    tools/malloc-syms.py -e u-boot console.log
+#    ... | tools/malloc-syms.py -e u-boot
+
+from optparse import OptionParser
+import os
+import re
+import subprocess
+import sys
+
+RE_BASE = re.compile(r'malloc_trace_info\(\) at (0x[0-9a-fA-F]+)')
+RE_ADDR = re.compile(r'\[<([0-9a-fA-F]+)>\]')
+
+def GetSymbol(nm, elf, name):
+    """Get the address of a symbol in the ELF file
+
+    Args:
+        nm: nm tool to use
+        elf: Filename of ELF file
+        name: Symbol name to find
+    Returns:
+        Address of symbol, or None if not found
+    """
+    out = subprocess.check_output([nm, elf]).decode('utf-8', 'replace')
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) == 3 and parts[2] == name:
+            return int(parts[0], 16)
+    return None
+
+def LookupAddrs(addr2line, elf, addrs):
+    """Find the function, file and line for a list of addresses
+
+    Args:
+        addr2line: addr2line tool to use
+        elf: Filename of ELF file
+        addrs: List of addresses (in the ELF file) to look up
+    Returns:
+        Dict with the description of each address, keyed by address
+    """
+    if not addrs:
+        return {}
+    # Each is a return address, so look up the call before it
+    args = ['%x' % (addr - 1) for addr in addrs]
+    out = subprocess.check_output([addr2line, '-f', '-s', '-e', elf] +
+                                  args).decode('utf-8', 'replace')
+    lines = out.splitlines()
+    result = {}
+    for i, addr in enumerate(addrs):
+        func, where = lines[i * 2], lines[i * 2 + 1]
+        result[addr] = '%s (%s)' % (func, where)
+    return result
+
+def Symbolise(lines, elf, cross_compile):
+    """Add the function name after each caller address in a log
+
+    Args:
+        lines: List of lines from the log
+        elf: Filename of ELF file
+        cross_compile: Toolchain prefix, e.g. 'arm-linux-gnueabihf-'
+    Returns:
+        List of lines with function names added
+    """
+    base = GetSymbol(cross_compile + 'nm', elf, 'malloc_trace_info')
+    if base is None:
+        raise ValueError("Cannot find malloc_trace_info in '%s'; was it "
+                         "built with CONFIG_MALLOC_TRACE?" % elf)
+
+    # Work out the offset to use for each line, from the line before it
+    offsets = []
+    offset = None
+    for line in lines:
+        m = RE_BASE.search(line)
+        if m:
+            offset = int(m.group(1), 16) - base
+        offsets.append(offset)
+
+    wanted = set()
+    for line, offset in zip(lines, offsets):
+        if offset is not None:
+            for m in RE_ADDR.finditer(line):
+                wanted.add(int(m.group(1), 16) - offset)
+    names = LookupAddrs(cross_compile + 'addr2line', elf, sorted(wanted))
+
+    out = []
+    for line, offset in zip(lines, offsets):
+        if offset is not None:
+            found = [names[int(m.group(1), 16) - offset]
+                     for m in RE_ADDR.finditer(line)]
+            if found:
+                line = '%s  %s' % (line, ', '.join(found))
+        out.append(line)
+    return out
+
+def main():
+    parser = OptionParser(usage='%prog -e <u-boot ELF> [<log file>]')
+    parser.add_option('-c', '--cross-compile', type='string',
+                      default=os.environ.get('CROSS_COMPILE', ''),
+                      help='Toolchain prefix (default $CROSS_COMPILE)')
+    parser.add_option('-e', '--elf', type='string', default='u-boot',
+                      help='U-Boot ELF file which produced the log')
+    (options, args) = parser.parse_args()
+
+    if len(args) > 1:
+        parser.error('Only one log file is allowed')
+    # Read bytes, since text mode would turn a lone '\r' into a new line
+    if args:
+        with open(args[0], 'rb') as fd:
+            data = fd.read()
+    else:
+        data = getattr(sys.stdin, 'buffer', sys.stdin).read()
+    text = data.decode('utf-8', 'replace')
+    # Serial consoles may send '\r' before or after each '\n'
+    lines = text.replace('\r', '').splitlines()
+
+    try:
+        for line in Symbolise(lines, options.elf, options.cross_compile):
+            print(line)
+    except (ValueError, OSError, subprocess.CalledProcessError) as e:
+        sys.stderr.write('%s\n' % e)
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
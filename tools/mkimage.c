@@ -168,6 +168,11 @@ int main(int argc, char **argv)
 				params.type = IH_TYPE_FLATDT;
 				params.fflag = 1;
 				goto NXTARG;
+			case 'j':
+				if (--argc <= 0)
+					usage();
+				params.hash_threads = strtoul(*++argv, NULL, 0);
+				goto NXTARG;
 			case 'k':
 				if (--argc <= 0)
 					usage();
@@ -597,9 +602,10 @@ static void usage(void)
 			 "          -d ==> use image data from 'datafile'\n"
 			 "          -x ==> set XIP (execute in place)\n",
 		params.cmdname);
-	fprintf(stderr, "       %s [-D dtc_options] [-f fit-image.its|-F] fit-image\n",
+	fprintf(stderr, "       %s [-D dtc_options] [-j threads] [-f fit-image.its|-F] fit-image\n",
 		params.cmdname);
 	fprintf(stderr, "          -D => set all options for device tree compiler\n"
+			"          -j => number of threads used to hash images (default: one per CPU)\n"
 			"          -f => input filename for FIT source\n");
 #ifdef CONFIG_FIT_SIGNATURE
 	fprintf(stderr, "Signing / verified boot options: [-k keydir] [-K dtb] [ -c <comment>] [-r]\n"
@@ -23,6 +23,12 @@
 
 #define MAX_LINE_LEN 500
 
+/*
+ * Chrome trace thread ID for function calls. U-Boot uses 1 and 2 for boot
+ * stages and durations (see bootstage_chrome_trace())
+ */
+#define CHROME_TID_FUNCS	3
+
 enum {
 	FUNCF_TRACE	= 1 << 0,	/* Include this function in trace */
 };
@@ -32,6 +38,7 @@ struct func_info {
 	const char *name;
 	unsigned long code_size;
 	unsigned long call_count;
+	unsigned long time_us;	/* total time spent in the function */
 	unsigned flags;
 	/* the section this function is in */
 	struct objsection_info *objsection;
@@ -86,8 +93,11 @@ static void usage(void)
 		"\n"
 		"Commands\n"
 		"   dump-ftrace\t\tDump out textual data in ftrace format\n"
+		"   dump-chrome\t\tDump out Chrome trace-event JSON\n"
+		"   dump-funcs\t\tDump out call counts and times per function\n"
 		"\n"
 		"Options:\n"
+		"   -b <json>\tSpecify bootstage Chrome trace (from U-Boot)\n"
 		"   -m <map>\tSpecify Systen.map file\n"
 		"   -t <trace>\tSpecific trace data file (from U-Boot)\n"
 		"   -v <0-4>\tSpecify verbosity\n");
@@ -227,6 +237,32 @@ static int read_calls(FILE *fin, int count)
 	return 0;
 }
 
+static int read_funcs(FILE *fin, int count)
+{
+	struct trace_output_func rec;
+	struct func_info *func;
+	int missing_count = 0;
+	int i;
+
+	notice("function count: %d\n", count);
+	for (i = 0; i < count; i++) {
+		if (read_data(fin, &rec, sizeof(rec)))
+			return 1;
+		func = find_func_by_offset(rec.offset);
+		if (!func) {
+			debug("Cannot find function at %lx\n",
+			      text_offset + rec.offset);
+			missing_count++;
+			continue;
+		}
+		func->call_count = rec.call_count;
+		func->time_us = rec.time_us;
+	}
+	if (missing_count)
+		warn("%d functions not found in map file\n", missing_count);
+	return 0;
+}
+
 static int read_profile(FILE *fin, int *not_found)
 {
 	struct trace_output_hdr hdr;
@@ -243,7 +279,8 @@ static int read_profile(FILE *fin, int *not_found)
 
 		switch (hdr.type) {
 		case TRACE_CHUNK_FUNCS:
-			/* Ignored at present */
+			if (read_funcs(fin, hdr.rec_count))
+				return 1;
 			break;
 
 		case TRACE_CHUNK_CALLS:
@@ -533,9 +570,181 @@ static int make_ftrace(void)
 	return 0;
 }
 
+/* A function which has been entered but not yet exited */
+struct chrome_frame {
+	struct func_info *func;
+	ulong start;		/* time of entry in microseconds */
+};
+
+static void out_chrome_sep(int *countp)
+{
+	printf("%s\n", (*countp)++ ? "," : "");
+}
+
+static void out_chrome_func(struct chrome_frame *frame, ulong end, int *countp)
+{
+	out_chrome_sep(countp);
+	printf("{\"name\":\"%s\",\"cat\":\"function\",\"ph\":\"X\","
+	       "\"ts\":%lu,\"dur\":%lu,\"pid\":1,\"tid\":%d}",
+	       frame->func->name, frame->start, end - frame->start,
+	       CHROME_TID_FUNCS);
+}
+
+/*
+ * Copy the events from a Chrome trace written by 'bootstage chrome'. This
+ * relies on U-Boot writing one event per line.
+ */
+static int read_bootstage_chrome(const char *fname, int *countp)
+{
+	char buff[MAX_LINE_LEN];
+	FILE *fin;
+
+	fin = fopen(fname, "r");
+	if (!fin) {
+		error("Cannot open bootstage file '%s'\n", fname);
+		return -1;
+	}
+	while (fgets(buff, sizeof(buff), fin)) {
+		int len = strlen(buff);
+
+		if (strncmp(buff, "{\"name\":", 8))
+			continue;
+		while (len && strchr(",\r\n", buff[len - 1]))
+			buff[--len] = '\0';
+		out_chrome_sep(countp);
+		printf("%s", buff);
+	}
+	fclose(fin);
+
+	return 0;
+}
+
+/*
+ * {"traceEvents":[
+ * {"name":"board_init_f","cat":"function","ph":"X","ts":12,"dur":85,...},
+ * ...
+ * ]}
+ *
+ * Each function call becomes a 'complete' event, which the viewer nests
+ * according to its start time and duration.
+ */
+static int make_chrome(const char *bootstage_fname)
+{
+	struct chrome_frame *stack = NULL;
+	struct trace_call *call;
+	int depth = 0, alloced = 0;
+	int count = 0;
+	ulong time = 0;
+	int i;
+
+	printf("{\"traceEvents\":[");
+	if (bootstage_fname && read_bootstage_chrome(bootstage_fname, &count))
+		return -1;
+	if (call_count) {
+		out_chrome_sep(&count);
+		printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+		       "\"tid\":%d,\"args\":{\"name\":\"functions\"}}",
+		       CHROME_TID_FUNCS);
+	}
+	for (i = 0, call = call_list; i < call_count; i++, call++) {
+		struct func_info *func = find_func_by_offset(call->func);
+
+		if (TRACE_CALL_TYPE(call) != FUNCF_ENTRY &&
+		    TRACE_CALL_TYPE(call) != FUNCF_EXIT)
+			continue;
+		if (!func || !(func->flags & FUNCF_TRACE))
+			continue;
+		time = call->flags & FUNCF_TIMESTAMP_MASK;
+
+		if (TRACE_CALL_TYPE(call) == FUNCF_ENTRY) {
+			if (depth == alloced) {
+				alloced += 256;
+				stack = realloc(stack,
+						sizeof(*stack) * alloced);
+				assert(stack);
+			}
+			stack[depth].func = func;
+			stack[depth++].start = time;
+		} else {
+			int upto;
+
+			/*
+			 * The exit of a function at the depth limit is not
+			 * recorded, so close any functions which it called
+			 */
+			for (upto = depth - 1; upto >= 0; upto--) {
+				if (stack[upto].func == func)
+					break;
+			}
+			if (upto < 0) {
+				debug("Exit from '%s' without entry\n",
+				      func->name);
+				continue;
+			}
+			while (depth > upto)
+				out_chrome_func(&stack[--depth], time, &count);
+		}
+	}
+
+	/* Close anything still running at the end of the trace */
+	while (depth)
+		out_chrome_func(&stack[--depth], time, &count);
+	printf("\n],\"displayTimeUnit\":\"ms\"}\n");
+	free(stack);
+
+	return 0;
+}
+
+static int h_cmp_time(const void *v1, const void *v2)
+{
+	const struct func_info *f1 = *(struct func_info **)v1;
+	const struct func_info *f2 = *(struct func_info **)v2;
+
+	if (f1->time_us != f2->time_us)
+		return f1->time_us < f2->time_us ? 1 : -1;
+	if (f1->call_count != f2->call_count)
+		return f1->call_count < f2->call_count ? 1 : -1;
+	return 0;
+}
+
+/*
+ *      Calls     Time(us)  Function
+ *         12        13027  board_init_r
+ *       1234          120  memcpy
+ */
+static int make_funcs(void)
+{
+	struct func_info **list;
+	int count = 0;
+	int i;
+
+	list = calloc(func_count, sizeof(*list));
+	if (!list) {
+		error("Cannot allocate function list\n");
+		return -1;
+	}
+	for (i = 0; i < func_count; i++) {
+		struct func_info *func = &func_list[i];
+
+		if (func->call_count && (func->flags & FUNCF_TRACE))
+			list[count++] = func;
+	}
+	qsort(list, count, sizeof(*list), h_cmp_time);
+
+	printf("%11s %12s  %s\n", "Calls", "Time(us)", "Function");
+	for (i = 0; i < count; i++) {
+		printf("%11lu %12lu  %s\n", list[i]->call_count,
+		       list[i]->time_us, list[i]->name);
+	}
+	free(list);
+
+	return 0;
+}
+
 static int prof_tool(int argc, char * const argv[],
 		     const char *prof_fname, const char *map_fname,
-		     const char *trace_config_fname)
+		     const char *trace_config_fname,
+		     const char *bootstage_fname)
 {
 	int err = 0;
 
@@ -553,6 +762,10 @@ static int prof_tool(int argc, char * const argv[],
 
 		if (0 == strcmp(cmd, "dump-ftrace"))
 			err = make_ftrace();
+		else if (0 == strcmp(cmd, "dump-chrome"))
+			err = make_chrome(bootstage_fname);
+		else if (0 == strcmp(cmd, "dump-funcs"))
+			err = make_funcs();
 		else
 			warn("Unknown command '%s'\n", cmd);
 	}
@@ -565,11 +778,16 @@ int main(int argc, char *argv[])
 	const char *map_fname = "System.map";
 	const char *prof_fname = NULL;
 	const char *trace_config_fname = NULL;
+	const char *bootstage_fname = NULL;
 	int opt;
 
 	verbose = 2;
-	while ((opt = getopt(argc, argv, "m:p:t:v:")) != -1) {
+	while ((opt = getopt(argc, argv, "b:m:p:t:v:")) != -1) {
 		switch (opt) {
+		case 'b':
+			bootstage_fname = optarg;
+			break;
+
 		case 'm':
 			map_fname = optarg;
 			break;
@@ -596,5 +814,5 @@ int main(int argc, char *argv[])
 
 	debug("Debug enabled\n");
 	return prof_tool(argc, argv, prof_fname, map_fname,
-			 trace_config_fname);
+			 trace_config_fname, bootstage_fname);
 }